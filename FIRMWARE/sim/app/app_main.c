@@ -1,16 +1,17 @@
 
 /**
  * @file app_main.c
- * @brief Main application entry point for the F1 Steering Wheel simulator.
+ * @brief Main application entry point for the F1 Steering Wheel (simulator and S32K118 firmware).
  *
  * @details
  * This module initializes HAL drivers, executes the main real-time loop,
  * manages CAN communication with the ECU, debounces and interprets user inputs,
  * applies filtering (clutch & temperature), and updates the TFT display at ~60 FPS.
  *
- * The code supports:
- *  - PC simulation mode (SDL-based display)
- *  - Target MCU mode (ILI9341 TFT)
+ * The same file is built for both platforms (the target project links app/);
+ * what differs is behind the board HAL (hal_board.h) and the console HAL:
+ *  - PC simulation mode (SDL window, text on stdout)
+ *  - Target MCU mode (ILI9341 TFT when fitted, text on LPUART0)
  *  - CAN TX/RX status visualization
  *  - Button callbacks + message UI
  *  - Rotary switch reading
@@ -27,276 +28,590 @@
 
 #include "hal_adc.h"
 #include "hal_gpio.h"
-#include "hal_delay.h"      // HAL for the delay 
 #include "hal_spi.h"
-#include "TFT_LCD.h"        // driver OLED of the display
-#include "hal_lcd.h"        // HAL Displey [ONLY SIMULATION]
+#include "hal_log.h"        // Tokenized logging (decoded by tools/log_decode.py)
+#include "hal_board.h"      // Board bring-up: SOSC / SDL window stages, main-loop hooks, settings
+#include "hal_console.h"    // Debug text output: stdout or LPUART0 (dropped, not waited for, in the loop)
 
 #include "clutch.h"
 #include "rotary_switch.h"
 #include "buttons.h"        // Includes functions for reading and debouncing button inputs
 #include "can.h"            // Includes functions for receiving and sending CAN messages
+#include "can_tx_sched.h"     // Per-signal transmit policies for the SteeringWheel_Status frame
+#include "can_diag.h"         // CAN error counters, error state and bus load
+#include "can_rx_mon.h"       // Per-message receive timeouts (stale flags) and jitter
+#include "xcp.h"              // XCP-on-CAN slave: live calibration and DAQ measurement
+#include "isotp.h"            // ISO-TP transport: multi-frame messages from the tester
+#include "hal_boot.h"            // Bootloader handover (UDS programming session)
+#include "telemetry.h"           // Binary telemetry stream (tools/telem_view.py)
+#include "console.h"             // Command console on stdin: parameters and profiling
+#include "boot_seq.h"            // Timed init stages with overlapping waits
+#include "sig_store.h"           // Signal store: latest values and change notification
+#include "mem_pool.h"            // Static memory pools (no heap), RAM per subsystem
+#include "gear_pred.h"           // Predicted gear on a paddle press, reconciled with the ECU
+#include "page.h"                // Dashboard pages: static layer from flash, widgets bound to signals
+#include "layout.h"              // Layout blob: checks, widgets, download over ISO-TP
+#include "trend.h"               // Trend widgets: sampled every slot, one new column per period
+#include "dash_layout.h"         // Built-in layout (generated by tools/layout2c.py)
+#include "hal_flash.h"           // Flash data sectors (downloaded layout)
 
 #include <stdint.h>         // Includes standard integer types like uint8_t, uint32_t
 #include <stddef.h>       
 #include <math.h>           // include for fabsfs 
 #include <string.h>
-#include <stdio.h>          // include for prints [SIMULATION ONLY]
 
 
 /*==============================================================================
  *                         GLOBAL STATE VARIABLES
  *==============================================================================*/
 
-/** @brief Message displayed on screen (e.g., "GEAR UP"). */
-static const char *msg = "-";
+/*--- Display ---*/
+#define APP_LCD_FITTED  HAL_BOARD_LCD_FITTED    /**< 1: display boot stage and dashboard pages drawn. */
+
+/*--- Signal Store ---*/
+/**
+ * @brief Application signals (see sig_store.h).
+ *
+ * Published by the inputs, the button callbacks and CAN receive; read by CAN
+ * transmit, the LEDs and the display, which act only on the signals that changed.
+ */
+enum {
+    SIG_BUTTONS,            /**< Debounced button mask. */
+    SIG_ROTARY_POS,         /**< Rotary position. */
+    SIG_ROTARY_ADC,         /**< Rotary ADC counts. */
+    SIG_CLUTCH_ADC,         /**< Clutch ADC counts. */
+    SIG_CLUTCH_RAW,         /**< Clutch before the EMA (%, float). */
+    SIG_CLUTCH_FILT,        /**< Clutch after the EMA (%, float). */
+    SIG_CLUTCH_TX,          /**< Filtered clutch, 0.1 % units (display, CAN deadband). */
+    SIG_T1,                 /**< Displayed temperature 1 (°C, rate limited). */
+    SIG_T2,                 /**< Displayed temperature 2 (°C, rate limited). */
+    SIG_GEAR,               /**< Gear reported by the ECU. */
+    SIG_GEAR_SHOWN,         /**< Displayed gear: predicted while pending, else the ECU gear. */
+    SIG_GEAR_PENDING,       /**< Displayed gear predicted, not yet confirmed by the ECU. */
+    SIG_PIT_LIMITER,        /**< PIT limiter active. */
+    SIG_DRS,                /**< DRS active. */
+    SIG_LED_PIT,            /**< LED 1 requested by the ECU. */
+    SIG_LED_TEMP,           /**< LED 2 requested by the ECU (temperature alarm). */
+    SIG_CAN_ACTIVE,         /**< ECU_Status_Display fresh (see can_rx_mon.h). */
+    SIG_CAN_TX_PULSE,       /**< Frame sent in the last 50 ms. */
+    SIG_CAN_RX_PULSE,       /**< ECU frame received in the last 50 ms. */
+    SIG_BUS_LOAD,           /**< Bus load of the last diagnostics window (%). */
+    SIG_BUS_STATE,          /**< Fault confinement state (hal_can_err_state_t). */
+    SIG_BTN_MSG,            /**< Button message (BTN_MSG_*). */
+    SIG_BTN_MSG_VISIBLE,    /**< Blink phase of the button message. */
+    SIG_COUNT
+};
+
+static const SigDef_t sig_defs[SIG_COUNT] = {
+    [SIG_BUTTONS]         = { "buttons",     SIG_T_I32 },
+    [SIG_ROTARY_POS]      = { "rotary_pos",  SIG_T_I32 },
+    [SIG_ROTARY_ADC]      = { "rotary_adc",  SIG_T_I32 },
+    [SIG_CLUTCH_ADC]      = { "clutch_adc",  SIG_T_I32 },
+    [SIG_CLUTCH_RAW]      = { "clutch_raw",  SIG_T_F32 },
+    [SIG_CLUTCH_FILT]     = { "clutch_filt", SIG_T_F32 },
+    [SIG_CLUTCH_TX]       = { "clutch_tx",   SIG_T_I32 },
+    [SIG_T1]              = { "t1",          SIG_T_I32 },
+    [SIG_T2]              = { "t2",          SIG_T_I32 },
+    [SIG_GEAR]            = { "gear",        SIG_T_I32 },
+    [SIG_GEAR_SHOWN]      = { "gear_shown",  SIG_T_I32 },
+    [SIG_GEAR_PENDING]    = { "gear_pend",   SIG_T_I32 },
+    [SIG_PIT_LIMITER]     = { "pit_limiter", SIG_T_I32 },
+    [SIG_DRS]             = { "drs",         SIG_T_I32 },
+    [SIG_LED_PIT]         = { "led_pit",     SIG_T_I32 },
+    [SIG_LED_TEMP]        = { "led_temp",    SIG_T_I32 },
+    [SIG_CAN_ACTIVE]      = { "can_active",  SIG_T_I32 },
+    [SIG_CAN_TX_PULSE]    = { "can_tx",      SIG_T_I32 },
+    [SIG_CAN_RX_PULSE]    = { "can_rx",      SIG_T_I32 },
+    [SIG_BUS_LOAD]        = { "bus_load",    SIG_T_I32 },
+    [SIG_BUS_STATE]       = { "bus_state",   SIG_T_I32 },
+    [SIG_BTN_MSG]         = { "btn_msg",     SIG_T_I32 },
+    [SIG_BTN_MSG_VISIBLE] = { "btn_msg_vis", SIG_T_I32 },
+};
+
+/** @brief Button messages (SIG_BTN_MSG); their text is in the layout (drivers/dash_layout.json). */
+enum { BTN_MSG_NONE, BTN_MSG_GEAR_UP, BTN_MSG_GEAR_DOWN, BTN_MSG_DRS, BTN_MSG_PIT };
+
+/** @brief Built-in dashboard layout, used while no valid one was downloaded (see layout.h). */
+#define DASH_LAYOUT  ((const uint8_t *)dash_layout)
 
 /** @brief Indicates that a button event has occurred. */
 static bool Button_flag=false;
 
-/** @brief Counter to clear message after short time. */
-static int msg_clear_counter=0;
+/** @brief Paddle press to predict in this slot: +1 UP, -1 DOWN, 0 none (see gear_pred.h). */
+static int8_t gear_shift_req=0;
+
+#define GEAR_MAX    9u          /**< Highest gear (DBC range of Gear_Actual). */
+
+/** @name UI timers (ms), independent of the slot length */
+/**@{*/
+#define BTN_MSG_HOLD_MS   800u          /**< Button message shown this long after the last press. */
+#define BTN_MSG_BLINK_MS  160u          /**< Button message blink half period. */
+#define CAN_PULSE_MS      50u           /**< TX/RX indicator on time after a frame. */
+/**@}*/
 
 /*--- CAN Communication Visual Feedback ---*/
-static bool can_tx_pulse = false;      /**< True when a CAN TX pulse is active. */
-static bool can_rx_pulse = false;      /**< True when a CAN RX pulse is active. */
 static uint32_t can_tx_time = 0;       /**< Timestamp of last CAN TX frame. */
 static uint32_t can_rx_time = 0;       /**< Timestamp of last CAN RX frame. */
-static bool can_active = false;        /**< True if ECU communication is active. */
-
-
-/*==============================================================================
- *                           LOCAL UTILIY FUNCTIONS
- *==============================================================================*/
+static CanDiag_t can_diag_snap;        /**< Latest CAN diagnostics window (load, error state). */
 
+/*--- CAN Transmit Policies ---*/
 /**
- * @brief Prevents temperature values from jumping too fast on screen.
+ * @brief Transmit policies of the SteeringWheel_Status signals (see can_tx_sched.h).
  *
- * @param previous Last displayed temperature.
- * @param input    New raw temperature from CAN.
- * @param max_step Maximum allowed change per update (°C per frame).
- * @return Smoothed output temperature.
+ * Buttons and rotary are sent on every edge; the clutch (tenths of %, whole % on
+ * the wire) is streamed when it moves more than 1 %, the ClutchValue resolution,
+ * at most every 20 ms. Keep-alive every 200 ms.
  */
-static int temp_rate_limit(int previous, int input, int max_step)
-{
-    int diff = input - previous;
+static const TxPolicy_t tx_policies[TX_SIG_COUNT] = {
+    [TX_SIG_BUTTONS] = { .min_gap_ms = 0,  .max_silence_ms = 200, .deadband = 0, .force_on_edge = true  },
+    [TX_SIG_ROTARY]  = { .min_gap_ms = 0,  .max_silence_ms = 200, .deadband = 0, .force_on_edge = true  },
+    [TX_SIG_CLUTCH]  = { .min_gap_ms = 20, .max_silence_ms = 200, .deadband = 10, .force_on_edge = false },
+};
 
-    if (diff > max_step)
-        return previous + max_step;
-
-    if (diff < -max_step)
-        return previous - max_step;
+/*--- XCP Calibration & Measurement ---*/
+#define XCP_CAL_ADDR   0x00010000u     /**< XCP address of ::cal (read/write). */
+#define XCP_MEAS_ADDR  0x00020000u     /**< XCP address of ::meas (read-only). */
 
-    return input;   // small change -> accept it
-}
+/**
+ * @brief Calibration parameters, tunable live over XCP (applied every slot).
+ *
+ * The XCP address of a field is XCP_CAL_ADDR + offset; the layout is the same
+ * on the simulator and on the target (see CAN_DEVELOPMENT.md, "XCP").
+ */
+typedef struct {
+    float    clutch_tau_ms;         /**< +0x00 Clutch EMA time constant (ms), 0 = unfiltered. */
+    uint16_t clutch_deadband;       /**< +0x04 Clutch TX deadband (0.1 % units, >= 10: 1 % on the wire). */
+    uint16_t clutch_min_gap_ms;     /**< +0x06 Clutch TX minimum gap (ms). */
+    uint32_t display_period_ms;     /**< +0x08 Display timeout without input (ms). */
+    uint32_t ui_period_ms;          /**< +0x0C Serial debug UI period (ms), 0 = off. */
+    uint8_t  debounce_count;        /**< +0x10 Button debounce readings. */
+    uint32_t telem_period_ms;       /**< +0x14 Binary telemetry period (ms), 0 = off. */
+    float    temp_slew_c_per_s;     /**< +0x18 Displayed temperature slew rate (°C/s). */
+    uint32_t gear_pred_timeout_ms;  /**< +0x1C Predicted gear rolled back if unconfirmed (ms). */
+} AppCal_t;
 
-/*==============================================================================
- *                          DISPLAY RENDERING
- *==============================================================================*/
+/**
+ * @brief Measurement variables, sampled by the XCP DAQ lists at the end of every slot.
+ *
+ * The XCP address of a field is XCP_MEAS_ADDR + offset.
+ */
+typedef struct {
+    uint32_t now_ms;                /**< +0x00 Application time (ms). */
+    float    clutch_raw;            /**< +0x04 Clutch before the EMA (%). */
+    float    clutch_filt;           /**< +0x08 Clutch after the EMA (%). */
+    uint16_t clutch_adc;            /**< +0x0C Clutch ADC counts. */
+    uint16_t rotary_adc;            /**< +0x0E Rotary ADC counts. */
+    int16_t  t1;                    /**< +0x10 Displayed temperature 1 (°C). */
+    int16_t  t2;                    /**< +0x12 Displayed temperature 2 (°C). */
+    uint8_t  buttons;               /**< +0x14 Debounced button mask. */
+    uint8_t  position;              /**< +0x15 Rotary position. */
+    uint8_t  gear;                  /**< +0x16 Gear reported by the ECU. */
+    uint8_t  tx_reasons;            /**< +0x17 TX scheduler reasons of this slot. */
+} AppMeas_t;
+
+static AppCal_t cal = {
+    .clutch_tau_ms     = 90.0f,     // EMA factor 0.15 at a 16 ms slot
+    .clutch_deadband   = 10,        // ClutchValue is whole %: a smaller move may not change the frame
+    .clutch_min_gap_ms = 20,
+    .display_period_ms = 10000,     // 300000ms -> 5 minutes
+    .ui_period_ms      = HAL_BOARD_UI_PERIOD_MS,   // Text debug page: 500 ms on the host, off on the target
+    .debounce_count    = DEBOUNCE_COUNT,
+    .telem_period_ms   = 50,        // Telemetry record 20 Hz (F1_TELEM sink)
+    .temp_slew_c_per_s = 40.0f,     // 2 °C per ECU frame (50 ms)
+    .gear_pred_timeout_ms = 250,    // ECU cycle (50 ms) plus the shift itself
+};
+
+static AppMeas_t meas;
+
+/*--- ISO-TP Bulk Data ---*/
+#define TP_BUF_SIZE    HAL_BOARD_TP_BUF_SIZE    /**< Largest message accepted from the tester (bytes). */
 
 /**
- * @brief Render all dynamic information on the TFT display.
+ * @brief Receive buffer of the ISO-TP link (zero-copy: frames are written straight here).
  *
- * @param clutch        Current clutch percentage (0–100%).
- * @param pos           Rotary switch position.
- * @param temp1         ECU-reported temperature 1.
- * @param temp2         ECU-reported temperature 2.
- * @param gear          Current gear.
- * @param pit_a         PIT limiter active flag.
- * @param drs_a         DRS active flag.
- * @param temp_alarm    Temperature alarm flag.
- * @param msg           Message to display (from button events).
+ * A layout download (`34`/`36`/`37`, see layout.h) is answered from this
+ * buffer, in blocks of TP_BUF_SIZE - 2 bytes; the programming session request
+ * (`10 02`) hands over to the bootloader. Any other message is sent back to
+ * the tester from this same buffer (loopback), which is then armed again.
  */
-void lcd_update_status(float clutch, int pos, int temp1, int temp2, int gear, bool pit_a, bool drs_a, bool temp_alarm, const char * btn_msg){
+static uint8_t tp_buf[TP_BUF_SIZE];
+static bool tp_echo_pending = false;   /**< tp_buf is being sent back; re-arm when done. */
+static bool tp_boot_pending = false;   /**< Session response is being sent; then reset into the bootloader. */
 
-    /*-----------------Clear screen--------------------*/
-    LCD_fill_rectangle(0, 0, 320, 240, BLACK);
+/** @brief UDS DiagnosticSessionControl(programmingSession) and its response (P2 50 ms, P2* 5 s). */
+static const uint8_t tp_session_req[2] = { 0x10, 0x02 };
+static const uint8_t tp_session_rsp[6] = { 0x50, 0x02, 0x00, 0x32, 0x01, 0xF4 };
 
+/** @brief Memory reachable over XCP: nothing else can be read or written. */
+static const XcpSegment_t xcp_segments[] = {
+    { XCP_CAL_ADDR,  &cal,  sizeof(cal),  true  },
+    { XCP_MEAS_ADDR, &meas, sizeof(meas), false },
+};
 
-    /*------------------ECU & CAN Status --------------*/
-    int icon_center_x = 160;
-    int icon_center_y = 10;
-    int icon_radius = 3;
+/*--- Command Console ---*/
+#define LOOP_SLOT_US   16000u         /**< Main-loop slot; a longer busy time is an overrun. */
 
-    // ECU active/inactive text
-    LCD_draw_string(icon_center_x - 24, icon_center_y-3, "ECU", can_active ? GREEN : RED, BLACK, 1);
+/**
+ * @brief Main-loop profile, dumped and cleared with the console command `prof`.
+ */
+typedef struct {
+    uint32_t slots;                 /**< Slots measured. */
+    uint32_t busy_min_us;           /**< Shortest busy time (us). */
+    uint32_t busy_max_us;           /**< Longest busy time (us). */
+    uint64_t busy_sum_us;           /**< Sum of the busy times, for the average (us). */
+    uint32_t overruns;              /**< Slots busy longer than ::LOOP_SLOT_US. */
+} LoopProf_t;
+
+static LoopProf_t prof = { .busy_min_us = UINT32_MAX };
+
+static bool cmd_prof(int argc, char **argv);
+static bool cmd_boot(int argc, char **argv);
+static bool cmd_mem(int argc, char **argv);
+static bool cmd_gear(int argc, char **argv);
+static bool cmd_sig(int argc, char **argv);
+static bool cmd_page(int argc, char **argv);
+static bool cmd_canrx(int argc, char **argv);
+
+/** @brief Parameters reachable from the console: the ::cal fields, also tunable over XCP. */
+static const ConsoleParam_t console_params[] = {
+    { "clutch_tau_ms",     &cal.clutch_tau_ms,     CONSOLE_F32, 0.0f, 2000.0f,   "Clutch EMA time constant (ms)" },
+    { "clutch_deadband",   &cal.clutch_deadband,   CONSOLE_U16, 0.0f, 1000.0f,   "Clutch TX deadband (0.1 %, wire 1 %)" },
+    { "clutch_min_gap_ms", &cal.clutch_min_gap_ms, CONSOLE_U16, 0.0f, 1000.0f,   "Clutch TX minimum gap (ms)" },
+    { "display_period_ms", &cal.display_period_ms, CONSOLE_U32, 0.0f, 600000.0f, "Display timeout without input (ms)" },
+    { "ui_period_ms",      &cal.ui_period_ms,      CONSOLE_U32, 0.0f, 60000.0f,  "Text debug page period (ms), 0 = off" },
+    { "debounce_count",    &cal.debounce_count,    CONSOLE_U8,  1.0f, 50.0f,     "Button debounce readings" },
+    { "telem_period_ms",   &cal.telem_period_ms,   CONSOLE_U32, 0.0f, 10000.0f,  "Telemetry record period (ms), 0 = off" },
+    { "temp_slew_c_per_s", &cal.temp_slew_c_per_s, CONSOLE_F32, 1.0f, 1000.0f,   "Displayed temperature slew (degC/s)" },
+    { "gear_pred_timeout_ms", &cal.gear_pred_timeout_ms, CONSOLE_U32, 20.0f, 5000.0f, "Predicted gear confirmation timeout (ms)" },
+};
+
+static const ConsoleCmd_t console_cmds[] = {
+    { "prof", cmd_prof, "prof [reset]  main-loop busy time and overruns" },
+    { "boot", cmd_boot, "boot  init stage timeline" },
+    { "mem",  cmd_mem,  "mem  static pool usage per subsystem" },
+    { "gear", cmd_gear, "gear [reset]  predicted gear: confirmations, rollbacks, latency" },
+    { "sig",  cmd_sig,  "sig  signal store: values, changes, time of last change" },
+    { "page", cmd_page, "page [reset]  dashboard pages and layout: switch time and bytes" },
+    { "canrx", cmd_canrx, "canrx all|routed  RX filters: every ID (counts unknown IDs) or routed IDs only" },
+};
 
-    // TX (Blue) and RX (Green) indicators
-    if(can_tx_pulse){
-        LCD_fill_circle(icon_center_x, icon_center_y, icon_radius, BLUE); //Recent transmision
-    }else{
-        LCD_draw_circle(icon_center_x, icon_center_y, icon_radius, WHITE);
+/**
+ * @brief Console command `prof`: dumps the loop profile, or clears it with `prof reset`.
+ */
+static bool cmd_prof(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "reset") == 0) {
+        memset(&prof, 0, sizeof(prof));
+        prof.busy_min_us = UINT32_MAX;
+        return true;
     }
+    if (argc != 1) return false;
+
+    console_printf("Loop: %lu slots  busy min/avg/max %lu/%lu/%lu us  overruns %lu\r\n",
+                   (unsigned long)prof.slots,
+                   (unsigned long)(prof.slots ? prof.busy_min_us : 0u),
+                   (unsigned long)(prof.slots ? (uint32_t)(prof.busy_sum_us / prof.slots) : 0u),
+                   (unsigned long)prof.busy_max_us, (unsigned long)prof.overruns);
+    uint32_t tx_dropped, rx_lost;
+    hal_console_get_stats(&tx_dropped, &rx_lost);
+    console_printf("Console: TX dropped %lu  RX lost %lu\r\n", (unsigned long)tx_dropped, (unsigned long)rx_lost);
+    return true;
+}
 
-    if(can_rx_pulse){
-        LCD_fill_circle(icon_center_x+8, icon_center_y, icon_radius, GREEN); //Recent reception
-    }else{
-        LCD_draw_circle(icon_center_x+8, icon_center_y, icon_radius, WHITE);
+/**
+ * @brief Console command `boot`: prints the init stage timeline of this boot.
+ */
+static bool cmd_boot(int argc, char **argv) {
+    (void)argv;
+    if (argc != 1) return false;
+
+    for (uint8_t i = 0; i < boot_seq_count(); i++) {
+        const BootRecord_t *r = boot_seq_record(i);
+        console_printf("%-10s %8lu .. %8lu us  %s\r\n", r->name,
+                       (unsigned long)r->start_us, (unsigned long)r->end_us,
+                       (r->state == BOOT_STAGE_TIMEOUT) ? "TIMEOUT" : (r->waited ? "wait" : ""));
     }
-    
-
-    /*-----------Temperatures (Y=20)-------------------*/
-    LCD_draw_string(12, 20, "T1:", WHITE, BLACK, 2);
-    LCD_draw_number(48, 20, temp1, WHITE, BLACK, 2);
-    LCD_draw_string(85, 20, "C", WHITE, BLACK, 2);
-
-    LCD_draw_string(220, 20, "T2:", WHITE, BLACK, 2);
-    LCD_draw_number(256, 20, temp2, WHITE, BLACK, 2);
-    LCD_draw_string(292, 20, "C", WHITE, BLACK, 2);
-
-    
-    /*-----------Clutch Bar(Y=50)---------------------*/
-    int clutchY = 50;
-    LCD_draw_string(12, clutchY, "Clutch", WHITE, BLACK, 2);
-    int barX = 100, barY = clutchY, barW = 160, barH = 18;
-    LCD_draw_rectangle(barX, barY, barW, barH, WHITE);
-    int fillW = (int)((clutch / 100.0f) * barW);
-    if (fillW < 0) fillW = 0;
-    if (fillW > barW) fillW = barW;
-
-    //Color of the bar
-    uint16_t color_fill = GREEN;
-    if (clutch > 70.0f) color_fill = RED;
-    else if (clutch > 40.0f) color_fill = YELLOW;
-    LCD_fill_rectangle(barX, barY, fillW, barH, color_fill);
-
-    LCD_printf(barX + barW + 10, barY,WHITE,BLACK,2,"%d%%",(int)clutch);
-    
-    
-    /*-----------Rotary Setup (Y=80)-------------------*/
-    int setupY = 80;
-    LCD_draw_string(12, setupY, "SETUP:", WHITE, BLACK, 2);
-    LCD_draw_char(110, setupY, '[', WHITE, BLACK, 2);
-    LCD_draw_number(124, setupY, pos, WHITE, BLACK, 2);
-    LCD_draw_char(136 + (pos > 9 ? 6 : 0), setupY, ']', WHITE, BLACK, 2);
+    return true;
+}
 
-   
-    /*-------------Buttons messages-------------------*/
-    if (btn_msg && strcmp(btn_msg, "-") != 0) {
+/**
+ * @brief Console command `mem`: RAM taken from the static pools, per subsystem.
+ */
+static bool cmd_mem(int argc, char **argv) {
+    (void)argv;
+    if (argc != 1) return false;
+
+    for (uint8_t i = 0; i < mem_pool_count(); i++) {
+        const MemPool_t *p = mem_pool_get(i);
+        console_printf("%-10s %5lu / %5lu B  peak %5lu B  fails %u\r\n", p->name,
+                       (unsigned long)p->used, (unsigned long)p->size,
+                       (unsigned long)p->high_water, (unsigned)p->fails);
+    }
+    return true;
+}
+
+/**
+ * @brief Console command `gear`: predicted gear counters and latency, cleared with `gear reset`.
+ */
+static bool cmd_gear(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "reset") == 0) {
+        gear_pred_resetStats();
+        return true;
+    }
+    if (argc != 1) return false;
+
+    GearPredStats_t st;
+    gear_pred_getStats(&st);
+    console_printf("Predicted %lu  confirmed %lu  mismatches %lu  timeouts %lu\r\n",
+                   (unsigned long)st.predictions, (unsigned long)st.confirmed,
+                   (unsigned long)st.mismatches, (unsigned long)st.timeouts);
+    console_printf("Latency last/min/avg/max %lu/%lu/%lu/%lu us\r\n",
+                   (unsigned long)st.lat_last_us, (unsigned long)st.lat_min_us,
+                   (unsigned long)st.lat_avg_us, (unsigned long)st.lat_max_us);
+    return true;
+}
 
-        static int blink_counter = 0;
-        blink_counter++;
-        if (blink_counter > 1000000) blink_counter = 0; // Reset every ~16 seconds at 60FPS
+/**
+ * @brief Console command `canrx`: opens the RX filters to every ID, or restores the routed IDs.
+ */
+static bool cmd_canrx(int argc, char **argv) {
+    if (argc != 2) return false;
+    if (strcmp(argv[1], "all") != 0 && strcmp(argv[1], "routed") != 0) return false;
 
-        bool visible = (blink_counter / 10) % 2 == 0;   // Toggle every ~10 frames
+    if (CAN_SetRxAcceptAll(strcmp(argv[1], "all") == 0) != 0) {
+        console_printf("ERR filters unchanged\r\n");
+    }
+    return true;
+}
 
-        if (visible){
-            LCD_draw_string(180, setupY, btn_msg, YELLOW, BLACK, 2);
+/**
+ * @brief Console command `sig`: every signal of the store with its change count.
+ * Floats are printed in hundredths (no float printf in newlib-nano).
+ */
+static bool cmd_sig(int argc, char **argv) {
+    (void)argv;
+    if (argc != 1) return false;
+
+    for (uint8_t i = 0; i < sig_count(); i++) {
+        const SigDef_t *d = sig_def(i);
+        if (d->type == SIG_T_F32) {
+            console_printf("%-12s %10ld e-2", d->name, (long)(sig_get_f32(i) * 100.0f));
+        } else {
+            console_printf("%-12s %10ld    ", d->name, (long)sig_get_i32(i));
         }
+        console_printf("  changes %6lu  at %8lu ms\r\n", (unsigned long)sig_seq(i), (unsigned long)sig_time_ms(i));
     }
+    console_printf("Epoch: %lu changes\r\n", (unsigned long)sig_epoch());
+    return true;
+}
 
-  
-    /*--------------Gear box center-------------------*/
-    
-    // Position/Size
-    int gearBoxW = 54; // Reduced width for visual lateral centering
-    int gearBoxH = 60; // Adjusted height
-    int gearBoxX = (320 - gearBoxW) / 2; // Centered X: (320 - 54) / 2 = 133
-    int gearBoxY = 135; // Start Y position 
-    
-    int fontSize = 6;
-    int fontWidth = 6 * fontSize; // 36 pixels
-    int fontHeight = 6 * fontSize; // 36 pixels
-    
-    // "GEAR" label (size 2, Y=105)
-    LCD_draw_string(135, 105, "GEAR", WHITE, BLACK, 2); 
-    
-    // Gear box rectangle
-    LCD_draw_rectangle(gearBoxX, gearBoxY, gearBoxW, gearBoxH, WHITE);
-    
-    // Calculate character position within the 54x60px box
-    // X Offset = (54 - 36) / 2 = 9. -> charX = 133 + 9 = 142 (Mathematical Center)
-    int charX = gearBoxX + (gearBoxW - fontWidth) / 2; 
-    // Y Offset = (60 - 36) / 2 = 12. -> charY = 135 + 12 = 147 (Mathematical Center)
-    int charY = gearBoxY + (gearBoxH - fontHeight) / 2; 
-
-    // This is the critical adjustment section:
-    charX += 1; 
-    charY -= 1; 
-    
-    if (gear == 0)
-        LCD_draw_char(charX, charY, 'N', CYAN, BLACK, fontSize);
-    else
-        LCD_draw_number(charX, charY, gear, CYAN, BLACK, fontSize);
-
- 
-
-    /*--------------Bottom Status Boxes-------------------*/
-    
-    // Bottom rectangles definition
-    int cubeY = 215;
-    int cubeW = 106;
-    int cubeH = 25;
-
-    // DRS
-    LCD_draw_rectangle(0, cubeY, cubeW, cubeH, WHITE);
-    uint16_t drs_bg_color = BLACK;
-    if (drs_a) {
-        drs_bg_color = BLUE;
-        LCD_fill_rectangle(0, cubeY, cubeW, cubeH, drs_bg_color);
-    }
-    // Draw text AFTER fill to ensure contrast
-    LCD_draw_string(36, cubeY + 4, "DRS", WHITE, drs_bg_color, 2); 
-
-    // PIT
-    LCD_draw_rectangle(cubeW + 1, cubeY, cubeW, cubeH, WHITE);
-    uint16_t pit_bg_color = BLACK;
-    if (pit_a) {
-        pit_bg_color = GREEN;
-        LCD_fill_rectangle(cubeW + 1, cubeY, cubeW, cubeH, pit_bg_color);
+/**
+ * @brief Console command `page`: pages and the cost of the last switch, cleared with `page reset`.
+ */
+static bool cmd_page(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "reset") == 0) {
+        page_resetStats();
+        return true;
     }
-    // Draw text AFTER fill to ensure contrast
-    LCD_draw_string(cubeW + 36, cubeY + 4, "PIT", WHITE, pit_bg_color, 2);
-
-    // TEMP
-    LCD_draw_rectangle(2 * cubeW + 2, cubeY, cubeW, cubeH, WHITE);
-    uint16_t temp_bg_color = BLACK;
-    if (temp_alarm) {
-        temp_bg_color = RED;
-        LCD_fill_rectangle(2 * cubeW + 2, cubeY, cubeW, cubeH, temp_bg_color);
+    if (argc != 1) return false;
+
+    for (uint8_t i = 0; i < page_count(); i++) {
+        const LayoutPage_t *pg = page_get(i);
+        console_printf("%c %-8s layer %5lu B  widgets %u\r\n", (i == page_current()) ? '*' : ' ', pg->name,
+                       (unsigned long)pg->layer_size, (unsigned)pg->widget_count);
     }
-    // Draw text AFTER fill to ensure contrast
-    LCD_draw_string(2 * cubeW + 30, cubeY + 4, "TEMP", WHITE, temp_bg_color, 2);
+    const LayoutHeader_t *lh = (const LayoutHeader_t *)page_blob();
+    console_printf("Layout: %s, %lu B\r\n", layout_is_downloaded(page_blob()) ? "downloaded" : "built-in",
+                   (unsigned long)lh->size);
+    PageStats_t st;
+    page_getStats(&st);
+    console_printf("Switches %lu  last %lu us (layer %lu us)  max %lu us\r\n",
+                   (unsigned long)st.switches, (unsigned long)st.last_us,
+                   (unsigned long)st.layer_us, (unsigned long)st.max_us);
+    console_printf("Last switch: %lu B from flash, %lu B to the panel\r\n",
+                   (unsigned long)st.flash_bytes, (unsigned long)st.spi_bytes);
+    return true;
 }
 
-void ui_update(uint8_t btnmask, int pos, uint16_t raw_rot, float clutch, uint16_t raw_clutch, bool LED1, bool LED2, uint32_t now_ms){
-    /*---------------------Print Banner-------------------------*/
-    printf("\r\n==============================\r\n");
-    printf("  F1 Steering Wheel - DEBUG UI\r\n");
-    printf("  Target: NXP S32K118\r\n");
-    printf("  UART:   115200 8N1\r\n");
-    printf (" RUN Time: %u ms\r \n", now_ms);
-    printf("==============================\r\n\r\n");
+/**
+ * @brief Adds the busy time of one slot to the loop profile.
+ */
+static void prof_update(uint32_t busy_us) {
+    prof.slots++;
+    prof.busy_sum_us += busy_us;
+    if (busy_us < prof.busy_min_us) prof.busy_min_us = busy_us;
+    if (busy_us > prof.busy_max_us) prof.busy_max_us = busy_us;
+    if (busy_us > LOOP_SLOT_US) prof.overruns++;
+}
 
-    /*--------------------Periodic Status-------------------------*/
 
-    /*Buttons status*/
-    printf ("---BTNS---\n");
-    printf(" Buttons: 0x%02X\r\n", btnmask);
+/*==============================================================================
+ *                           LOCAL UTILIY FUNCTIONS
+ *==============================================================================*/
 
-    /*ADC*/
-    printf ("---ADC---\n");
-    printf(" Rotary : %u -> %u\r \n", raw_rot, pos);
+/**
+ * @brief Smoothing factor of a first-order low-pass filter for one step.
+ *
+ * @details
+ * alpha = dt / (tau + dt) keeps the same time constant whatever the slot
+ * length (0.15 for tau = 90 ms at 16 ms).
+ *
+ * @param dt_ms  Time since the previous step (ms).
+ * @param tau_ms Time constant (ms), 0 = no filtering.
+ * @return Weight of the new sample (0–1).
+ */
+static float ema_alpha(float dt_ms, float tau_ms)
+{
+    if (tau_ms <= 0.0f) return 1.0f;
+    return dt_ms / (tau_ms + dt_ms);
+}
 
-    printf(" Clutch : %u -> %.1f %%\r \n", raw_clutch, clutch);
+/**
+ * @brief Prevents displayed values from jumping too fast on screen.
+ *
+ * @param previous Last displayed value.
+ * @param input    Value to reach.
+ * @param max_step Maximum allowed change in this step (rate × dt).
+ * @return Rate-limited value.
+ */
+static float slew_limit(float previous, float input, float max_step)
+{
+    float diff = input - previous;
 
-    /*Led Status*/
-    printf ("---LED STATUS---\n");
-    printf (" Sent [%u] --> LED 1\r \n", LED1);
-    printf (" Sent [%u] --> LED 2\r \n", LED2);
+    if (diff > max_step)
+        return previous + max_step;
 
-    /*CAN*/
-    printf ("---CAN STATUS---\n");
-    printf ( " CAN: %s \r \n" , can_active ? "ACTIVE" : "INACTIVE");
-    printf ( " CAN TX: %ums ago \r \n", now_ms - can_tx_time);
+    if (diff < -max_step)
+        return previous - max_step;
 
-    printf ( " CAN RX: %ums ago \r \n", now_ms - can_rx_time);
+    return input;   // small change -> accept it
+}
 
+/**
+ * @brief Rounds to the nearest integer (halves away from zero).
+ */
+static int32_t round_i32(float x)
+{
+    return (int32_t)(x + (x >= 0.0f ? 0.5f : -0.5f));
+}
 
-    printf ( "\r -----------------------------\r \n");
+/*==============================================================================
+ *                          DISPLAY RENDERING
+ *==============================================================================*/
+
+/*
+ * The dashboard itself is described in drivers/dash_layout.json and drawn by
+ * page.c from the compiled blob (layout.h); only the debug view is code.
+ */
+
+/**
+ * @brief Render the dynamic information on the serial debug page (console HAL).
+ *
+ * @details
+ * Every value is read from the signal store; the clutch is printed in tenths
+ * of % (no float printf in newlib-nano).
+ *
+ * @param now_ms Actual tracking/run time ms.
+ */
+static void ui_update(uint32_t now_ms){
+    int32_t clutch_x10 = round_i32(sig_get_f32(SIG_CLUTCH_RAW) * 10.0f);
 
+    /*---------------------Print Banner-------------------------*/
+    console_printf("\r\n==============================\r\n");
+    console_printf("  F1 Steering Wheel - DEBUG UI\r\n");
+    console_printf("  Target: NXP S32K118\r\n");
+    console_printf("  UART:   115200 8N1\r\n");
+    console_printf(" RUN Time: %lu ms\r\n", (unsigned long)now_ms);
+    console_printf("==============================\r\n\r\n");
 
+    /*--------------------Periodic Status-------------------------*/
+
+    /*Buttons status*/
+    console_printf("---BTNS---\r\n");
+    console_printf(" Buttons: 0x%02X\r\n", (unsigned)sig_get_i32(SIG_BUTTONS));
+
+    /*ADC*/
+    console_printf("---ADC---\r\n");
+    console_printf(" Rotary : %u -> %u\r\n", (unsigned)sig_get_i32(SIG_ROTARY_ADC), (unsigned)sig_get_i32(SIG_ROTARY_POS));
+    console_printf(" Clutch : %u -> %ld.%ld %%\r\n", (unsigned)sig_get_i32(SIG_CLUTCH_ADC),
+        (long)(clutch_x10 / 10), (long)(clutch_x10 % 10));
+
+    /*Led Status*/
+    console_printf("---LED STATUS---\r\n");
+    console_printf(" Sent [%u] --> LED 1\r\n", (unsigned)(sig_get_i32(SIG_LED_PIT) != 0));
+    console_printf(" Sent [%u] --> LED 2\r\n", (unsigned)(sig_get_i32(SIG_LED_TEMP) != 0));
+
+    /*CAN*/
+    console_printf("---CAN STATUS---\r\n");
+    console_printf(" TEMPERATURE 1: %ld degC\r\n", (long)sig_get_i32(SIG_T1));
+    console_printf(" TEMPERATURE 2: %ld degC\r\n", (long)sig_get_i32(SIG_T2));
+    console_printf(" CAN: %s\r\n", sig_get_i32(SIG_CAN_ACTIVE) ? "ACTIVE" : "INACTIVE");
+    console_printf(" CAN TX: %lu ms ago\r\n", (unsigned long)(now_ms - can_tx_time));
+    console_printf(" CAN RX: %lu ms ago\r\n", (unsigned long)(now_ms - can_rx_time));
+    console_printf(" -GEAR: %ld\r\n", (long)sig_get_i32(SIG_GEAR));
+    console_printf(" -PL: %u\r\n", (unsigned)(sig_get_i32(SIG_PIT_LIMITER) != 0));
+    console_printf(" -DRS: %u\r\n", (unsigned)(sig_get_i32(SIG_DRS) != 0));
+
+    /*ECU message timing (bus arrival timestamps)*/
+    RxMsgStatus_t ecu_rx;
+    can_rx_mon_getStatus(RX_MSG_ECU_STATUS, &ecu_rx);
+    console_printf("---ECU RX TIMING---\r\n");
+    console_printf(" ECU_Status: %s  age %u ms  frames %u  timeouts %u\r\n",
+        ecu_rx.stale ? "STALE" : "FRESH", (unsigned)(ecu_rx.age_us / 1000u),
+        (unsigned)ecu_rx.frames, (unsigned)ecu_rx.timeouts);
+    console_printf(" Interval min/avg/max: %u/%u/%u us  jitter max %u us\r\n",
+        (unsigned)(ecu_rx.frames > 1u ? ecu_rx.itv_min_us : 0u), (unsigned)ecu_rx.itv_avg_us,
+        (unsigned)ecu_rx.itv_max_us, (unsigned)ecu_rx.jitter_max_us);
+
+    /*Receive dispatch: frames that reached no decoder (ignored / unknown: filters open, 'canrx all')*/
+    CanDispatchStats_t rx_disp;
+    CAN_GetDispatchStats(&rx_disp);
+    console_printf(" RX dispatched %u  bad DLC %u\r\n",
+        (unsigned)rx_disp.dispatched, (unsigned)rx_disp.bad_dlc);
+    if (rx_disp.accept_all) {
+        console_printf(" RX accept-all  ignored %u  unknown %u\r\n",
+            (unsigned)rx_disp.ignored, (unsigned)rx_disp.unknown);
+    }
+    for (uint8_t i = 0; i < rx_disp.unknown_ids; i++) {
+        console_printf("   unknown 0x%03X x%u\r\n", (unsigned)rx_disp.unknown_tab[i].id, (unsigned)rx_disp.unknown_tab[i].count);
+    }
 
+    /*CAN diagnostics (last 1000 ms window)*/
+    console_printf("---CAN DIAG---\r\n");
+    console_printf(" State: %s  TEC=%u REC=%u (changes %u, bus-off %u)\r\n",
+        can_diag_snap.err_state == HAL_CAN_ERR_ACTIVE ? "ACTIVE" :
+        can_diag_snap.err_state == HAL_CAN_ERR_PASSIVE ? "PASSIVE" : "BUS-OFF",
+        (unsigned)can_diag_snap.tx_err_count, (unsigned)can_diag_snap.rx_err_count,
+        (unsigned)can_diag_snap.state_changes, (unsigned)can_diag_snap.bus_off_events);
+    console_printf(" Load: %u.%u %% (peak %u.%u %%)  RX %u/s  TX %u/s\r\n",
+        (unsigned)(can_diag_snap.load_permille / 10u), (unsigned)(can_diag_snap.load_permille % 10u),
+        (unsigned)(can_diag_snap.load_peak_permille / 10u), (unsigned)(can_diag_snap.load_peak_permille % 10u),
+        (unsigned)can_diag_snap.rx_frames, (unsigned)can_diag_snap.tx_frames);
+    console_printf(" Overruns: %u  RX errors: %u  TX retries: %u  TX dropped: %u\r\n",
+        (unsigned)can_diag_snap.rx_overruns, (unsigned)can_diag_snap.rx_errors,
+        (unsigned)can_diag_snap.tx_retries, (unsigned)can_diag_snap.tx_dropped);
+
+    /*XCP slave*/
+    XcpStats_t xcp;
+    xcp_getStats(&xcp);
+    console_printf("---XCP---\r\n");
+    console_printf(" %s  cmds %u  errors %u  DAQ frames %u  DAQ lost %u\r\n",
+        xcp_isConnected() ? "CONNECTED" : "IDLE", (unsigned)xcp.commands, (unsigned)xcp.errors,
+        (unsigned)xcp.daq_frames, (unsigned)xcp.daq_overruns);
+
+    /*ISO-TP link*/
+    IsoTpStats_t tp;
+    isotp_getStats(&tp);
+    console_printf("---ISO-TP---\r\n");
+    console_printf(" RX %u msgs / %u B  TX %u msgs / %u B  errors RX %u (last %u) TX %u\r\n",
+        (unsigned)tp.rx_msgs, (unsigned)tp.rx_bytes, (unsigned)tp.tx_msgs, (unsigned)tp.tx_bytes,
+        (unsigned)tp.rx_errors, (unsigned)tp.rx_last_error, (unsigned)tp.tx_errors);
+
+    /*Console output: characters lost because the UART TX ring was full*/
+    uint32_t tx_dropped, rx_lost;
+    hal_console_get_stats(&tx_dropped, &rx_lost);
+    console_printf(" Console dropped: %lu\r\n", (unsigned long)tx_dropped);
+
+    console_printf("------------------------------\r\n");
 }
 
 /*==============================================================================
@@ -310,10 +625,10 @@ void ui_update(uint8_t btnmask, int pos, uint16_t raw_rot, float clutch, uint16_
  */
 void callback_Btn1(bool statebtn1) { 
 
-    printf ( "[BTN] #1: UP -> Press[%u] \r \n" , statebtn1);
-    msg="GEAR UP";
+    HAL_LOG("[BTN] #1: UP -> Press[%u] \r \n" , statebtn1);
+    sig_publish_i32(SIG_BTN_MSG, BTN_MSG_GEAR_UP);
+    if (statebtn1) gear_shift_req = 1;
     Button_flag=true;
-    msg_clear_counter=0;
 
 }
 
@@ -322,10 +637,10 @@ void callback_Btn1(bool statebtn1) {
  */
 void callback_Btn2(bool statebtn2) { 
    
-    printf ( "[BTN] #2: DOWN-> Press[%u] \r \n" , statebtn2);
-    msg="GEAR DOWN";
+    HAL_LOG("[BTN] #2: DOWN-> Press[%u] \r \n" , statebtn2);
+    sig_publish_i32(SIG_BTN_MSG, BTN_MSG_GEAR_DOWN);
+    if (statebtn2) gear_shift_req = -1;
     Button_flag=true;
-    msg_clear_counter=0;
 }
 
 /**
@@ -333,13 +648,12 @@ void callback_Btn2(bool statebtn2) {
  */
 void callback_Btn3(bool statebtn3) { 
     if (statebtn3){
-        printf("[BTN] #3: SPARE #1\n");
-        msg="DRS";
+        HAL_LOG("[BTN] #3: SPARE #1\n");
+        sig_publish_i32(SIG_BTN_MSG, BTN_MSG_DRS);
         Button_flag=true;
-        msg_clear_counter=0;
     }
     else{
-      printf("[BTN] #3: Realeased \n");  
+      HAL_LOG("[BTN] #3: Realeased \n");  
     }
 }
 
@@ -348,54 +662,102 @@ void callback_Btn3(bool statebtn3) {
  */
 void callback_Btn4(bool statebtn4) { 
     if (statebtn4) {
-        printf("[BTN] #4: SPARE #2\n");
-        msg="PIT";
+        HAL_LOG("[BTN] #4: SPARE #2\n");
+        sig_publish_i32(SIG_BTN_MSG, BTN_MSG_PIT);
         Button_flag=true;
-        msg_clear_counter=0;
     }else{
-        printf("[BTN] #4: Realeased \n"); 
+        HAL_LOG("[BTN] #4: Realeased \n"); 
     }
 }
 
 
 /*==============================================================================
- *                       MAIN APPLICATION FUNCTION
+ *                       BOOT SEQUENCE
  *==============================================================================*/
 
-/**
- * @brief Main application function for steering wheel simulation.
- *
- * @details
- * Initializes all modules, enters the main control loop, manages CAN
- * transmission/reception, and updates the display.
- */
-void app_main(void) {
-
-    /* --------------------------INITIALIZATION----------------------------------- */
-    // Initialize all the necessary modules before starting the main loop.
+// Init stages, in start order (see boot_seq.h)
+enum {
+    BOOT_CAN, BOOT_CLOCK, BOOT_GPIO, BOOT_INPUTS, BOOT_SPI,
+#if APP_LCD_FITTED
+    BOOT_DISPLAY,
+#endif
+    BOOT_APP, BOOT_STAGES
+};
+
+/** @brief CAN and the protocols on it: first, so the wheel is on the bus early. */
+static void boot_can(void) {
+    CAN_Init();                         // Initialize CAN communication channel
+    can_tx_sched_init(tx_policies);     // Event/change-driven TX scheduling
+    can_diag_init(0);                   // CAN error counters and bus load, 1 s windows
+    xcp_init(xcp_segments, sizeof(xcp_segments) / sizeof(xcp_segments[0]));   // XCP on 0x7E0/0x7E1
+    isotp_rx_arm(tp_buf, sizeof(tp_buf));                                      // ISO-TP on 0x7E4/0x7EC
+}
 
-    HAL_GPIO_Init();    //Initilize al GPIO 
+/** @brief Input drivers (the pins are configured by the GPIO stage). */
+static void boot_inputs(void) {
     buttons_init();     // Initialize the button driver and its underlying HAL.
-
     hal_adc_init();     // Initialize the ADC peripheral (HAL layer)
     clutch_Init();      // Initialize the clutch input driver
-    rotary_Init(10);    // Initialize the rotary switch with 10 discrete positions 
-
-    HAL_SPI_Init();     // Initilize the SPI comunication 
-
-    // Simulation / Target Display initialization
-    HAL_Display_Init();         // [ONLY SIMULATION]
-    //LCD_display9341_init();   // [TARGET ONLY]
-
+    rotary_Init(10);    // Initialize the rotary switch with 10 discrete positions
+}
 
-    CAN_Init();         // Initialize CAN communication channel
+/** @brief Signal store, telemetry, console and button callbacks. */
+static void boot_app(void) {
+    sig_init(sig_defs, SIG_COUNT);                                             // Signal store, every signal at 0
+    (void)hal_flash_init();                                                    // Downloaded layout (flash data sectors)
+    gear_pred_init(GEAR_MAX, cal.gear_pred_timeout_ms);                        // Optimistic gear display
+    sig_publish_i32(SIG_LED_PIT, 1);                                           // LEDs on until the first ECU frame
+    sig_publish_i32(SIG_LED_TEMP, 1);
+    telem_init(cal.telem_period_ms);                                           // Binary telemetry stream
+    console_init(console_params, (uint8_t)(sizeof(console_params) / sizeof(console_params[0])),
+                 console_cmds, (uint8_t)(sizeof(console_cmds) / sizeof(console_cmds[0])));    // "help" on stdin
 
-    
-    /*Register button callbacks*/
     buttons_registerCallback(0,callback_Btn1);
     buttons_registerCallback(1,callback_Btn2);
     buttons_registerCallback(2,callback_Btn3);
     buttons_registerCallback(3,callback_Btn4);
+}
+
+/**
+ * @brief Boot stages. The board clock (SOSC on the target, nothing on the
+ * host) starts while GPIO and inputs are configured; only the SPI, clocked
+ * from it, waits. The display (SDL window, or the ILI9341 reset and sleep-out
+ * waits) overlaps the rest.
+ */
+static const BootStage_t boot_stages[BOOT_STAGES] = {
+    [BOOT_CAN]     = { "can",     boot_can,                NULL,                    0u,      0u },
+    [BOOT_CLOCK]   = { "clock",   hal_board_clock_start,   hal_board_clock_ready,   50000u,  0u },
+    [BOOT_GPIO]    = { "gpio",    HAL_GPIO_Init,           NULL,                    0u,      0u },
+    [BOOT_INPUTS]  = { "inputs",  boot_inputs,             NULL,                    0u,      BOOT_AFTER(BOOT_GPIO) },
+    [BOOT_SPI]     = { "spi",     HAL_SPI_Init,            NULL,                    0u,      BOOT_AFTER(BOOT_CLOCK) },
+#if APP_LCD_FITTED
+    [BOOT_DISPLAY] = { "display", hal_board_display_start, hal_board_display_ready, 500000u, BOOT_AFTER(BOOT_SPI) | BOOT_AFTER(BOOT_GPIO) },
+#endif
+    [BOOT_APP]     = { "app",     boot_app,                NULL,                    0u,      BOOT_AFTER(BOOT_INPUTS) },
+};
+
+
+
+/*==============================================================================
+ *                       MAIN APPLICATION FUNCTION
+ *==============================================================================*/
+
+/**
+ * @brief Main application function for the steering wheel.
+ *
+ * @details
+ * Initializes all modules, enters the main control loop, manages CAN
+ * transmission/reception, and updates the display. Returns only on the
+ * host, when the window is closed.
+ */
+void app_main(void) {
+
+    /* --------------------------INITIALIZATION----------------------------------- */
+    // CAN first, then the rest; each stage is timed ("boot" on the console)
+    uint32_t boot_us = boot_seq_run(boot_stages, BOOT_STAGES);
+    boot_seq_report();
+    HAL_LOG("[BOOT] Init done in %lu us\r\n", (unsigned long)boot_us);
+    hal_board_dump();                           // Peripheral registers (target only)
 
 
     /*-----------------------MAIN LOOP VARIABLES---------------------------------*/
@@ -404,29 +766,29 @@ void app_main(void) {
     SteeringWheelStatus_t status = {0};
     ECUStatus_t ecu = {0};
 
-    uint32_t t_ms = 0, now_ms=0; 
-    uint32_t last_can_time = 0;
+    uint32_t now_ms = 0;                        // Application time (ms), from the bus timebase
+    uint32_t last_slot_us = hal_can_get_time_us();
+    uint32_t frac_us = 0;                       // Part of a millisecond carried to the next slot
     uint32_t last_display_time=0;
     uint32_t last_ui_time=0;
 
-    const uint32_t DISPLAY_PERIOD_MS= 10000;    // 300000ms -> 5 minutes
-    const uint32_t UI_PERIOD_MS= 500;         // Send Uart 500ms 
-    const uint32_t CAN_PERIOD_MS = 200;         // Sed every 200 ms (5 Hz) como keep-alive       // A simple counter to approximate elapsed milliseconds.
-    const float CLUTCH_THRESHOLD = 10.0f;       // % of minimun change to send the event
-   
-    
-    uint8_t rotary_prev=0xFF;                   // rotary Initial invalid value to force the 1st send
-    float clutch_prev = -1.0f;                  // clutch Initial invalid value to force the 1st send
     float clutch_filt   = 0.0f;                 // Smooth Persistent filtered value of the Clutch
-    const float clutch_alpha = 0.15f;           // Smoothing factor (0.1–0.3 recommended) for the clutch
+    uint32_t msg_time_ms = 0;                   // Last button press: message hold and blink phase
+    float t1_ecu = 0.0f, t2_ecu = 0.0f;         // Latest temperatures from the ECU
+    float t1_disp = 0.0f, t2_disp = 0.0f;       // Displayed temperatures, slew-limited
+    bool lcd_on         = false;                // Dashboard drawn (false: blanked by the display timeout)
 
-    uint8_t gear=0;
-    int t1=0, t2=0;
-    bool pit_l=0,drs=0, LED1_PL=0, LED2_T=0;
+    // Consumers of the signal store: each one takes only the signals that changed since its last run
+    uint8_t sub_tx   = sig_subscribe(SIG_BIT(SIG_BUTTONS) | SIG_BIT(SIG_ROTARY_POS) | SIG_BIT(SIG_CLUTCH_TX));
+    uint8_t sub_leds = sig_subscribe(SIG_BIT(SIG_LED_PIT) | SIG_BIT(SIG_LED_TEMP));
+    page_init(layout_select(DASH_LAYOUT));      // The display: downloaded layout if valid, only the widgets of the shown page
 
 
     int running = 1;                            // Loop control variable. Set to 0 to exit the loop.
 
+    // From here on a full TX ring drops debug output instead of stalling the slot
+    hal_console_set_blocking(false);
+
 
     /*============================== MAIN LOOP =============================*/
     while (running) {
@@ -434,156 +796,276 @@ void app_main(void) {
         // ---  WINDOW EVENT HANDLING ---
         // This is crucial for the SDL window on the host PC. It processes events
         // like closing the window. If the user clicks the 'X', this function will
-        // set the 'running' variable to 0, causing the loop to terminate.22
-        HAL_Poll_Events(&running);  //  [ONLY SIMULATION]
+        // set the 'running' variable to 0, causing the loop to terminate.
+        hal_board_poll(&running);
+        uint32_t slot_start_us = hal_can_get_time_us();   // Slot start: elapsed time, busy time (telemetry)
+
+        /* ------------------------CALIBRATION (XCP, CONSOLE) ---------------------------*/
+        // Parameters may have been changed by the XCP master in the previous slot,
+        // or by a console command now
+        console_poll();
+        TxPolicy_t clutch_policy = tx_policies[TX_SIG_CLUTCH];
+        clutch_policy.deadband   = cal.clutch_deadband;
+        clutch_policy.min_gap_ms = cal.clutch_min_gap_ms;
+        can_tx_sched_setPolicy(TX_SIG_CLUTCH, &clutch_policy);
+        buttons_setDebounce(cal.debounce_count);
+        telem_setPeriod(cal.telem_period_ms);
+        gear_pred_setTimeout(cal.gear_pred_timeout_ms);
+
+        /*------------------------------------ TIME LOGIC -----------------------------------*/
+
+        // Elapsed real time of the slot: filters and UI timers use it, not the slot count
+        uint32_t dt_us = slot_start_us - last_slot_us;      // Wrap-safe
+        last_slot_us = slot_start_us;
+        frac_us += dt_us;
+        now_ms += frac_us / 1000u;
+        frac_us %= 1000u;
+        float dt_ms = (float)dt_us / 1000.0f;
+        sig_set_time(now_ms);       // Time stamp of the changes published in this slot
 
         /* ------------------------INPUT STATE UPDATE ---------------------------*/
+        // Producers: every reading is published, the store keeps track of what changed
 
         /*---Buttons---*/
-        buttons_update();                               // Reads the raw hardware state and updates the internal debounce counters.
-        uint8_t s_button_val = buttons_getStable();     // Gets the stable, debounced state of all buttons as a bitmask (bit 0 for button 1, etc.).
-
-        /*---Rotary Switch---*/
-        uint16_t pos_adc=rotary_GetRawValue();          // Obtain the raw value[New]
-        uint8_t position=rotary_GetPosition();          // Determine the current position index
+        buttons_update();                               // Reads the raw hardware state and updates the internal debounce counters (callbacks publish the message).
+        sig_publish_i32(SIG_BUTTONS, buttons_getStable());  // Stable, debounced state of all buttons as a bitmask (bit 0 for button 1, etc.).
 
-        // Rotary Change detection
-        bool rotary_changed = (position != rotary_prev); 
-        if (rotary_changed) rotary_prev = position;
+        // A debounced paddle press moves the displayed gear at once, while the ECU link is up
+        if (gear_shift_req != 0) {
+            if (sig_get_i32(SIG_CAN_ACTIVE)) gear_pred_shift(gear_shift_req, slot_start_us);
+            gear_shift_req = 0;
+        }
 
-        //float clutch_percentage=100; // Get calibrated clutch position (0–100%)
-        //uint8_t position=2;  // Determine the current position index
+        /*---Rotary Switch---*/
+        sig_publish_i32(SIG_ROTARY_ADC, rotary_GetRawValue());  // Obtain the raw value[New]
+        sig_publish_i32(SIG_ROTARY_POS, rotary_GetPosition());  // Determine the current position index
 
         /*---Clutch---*/
-        uint16_t clutch_adc= clutch_GetRawValue();  // Obtain the adc raw value[New]
-        // Exponential Moving Average (EMA) Filter
+        sig_publish_i32(SIG_CLUTCH_ADC, clutch_GetRawValue());  // Obtain the adc raw value[New]
+        // Exponential Moving Average (EMA) Filter, weighted by the slot length
         float clutch_raw = clutch_GetPercentage(); // Raw ADC-based clutch value (0–100%)                
+        float clutch_alpha = ema_alpha(dt_ms, cal.clutch_tau_ms);
         clutch_filt = clutch_alpha * clutch_raw + (1.0f - clutch_alpha) * clutch_filt;
-        float clutch_percentage = clutch_filt;      // Get calibrated clutch position (0–100%)
-
-        // Clutch Change detection
-        bool clutch_changed = (fabsf(clutch_percentage - clutch_prev) > CLUTCH_THRESHOLD);
-        if (clutch_changed) clutch_prev = clutch_percentage;
-
-        /*------------------------------------ TIME LOGIC -----------------------------------*/
-
-        // This is a simple, approximate way to keep track of time.
-        t_ms += 16;                 // We assume each loop takes roughly 16ms due to hal_delay_ms(16).
-        now_ms = t_ms;
+        sig_publish_f32(SIG_CLUTCH_RAW, clutch_raw);
+        sig_publish_f32(SIG_CLUTCH_FILT, clutch_filt);
+        sig_publish_i32(SIG_CLUTCH_TX, (int32_t)(clutch_filt * 10.0f + 0.5f));   // 0.1 % units: the display resolution
         
         /*--------------------------------------CAN TRANSMIT----------------------------------*/
 
-        // If there exist an event like a botton was pressed, change position of rotary, a hughe change of the clutch
-        if (Button_flag || rotary_changed || clutch_changed) {
-            status.button_state = s_button_val;
-            status.rotary_position = position;
-            status.clutch_value = (int)clutch_percentage;
-    
-            CAN_SendSteeringStatus(&status);    // send only if were a change on Board Inputs
+        // Only the signals that changed reach the scheduler; it decides if this slot sends a frame
+        SigMask_t tx_changed = sig_changed(sub_tx);
+        if (tx_changed & SIG_BIT(SIG_BUTTONS))    can_tx_sched_update(TX_SIG_BUTTONS, sig_get_i32(SIG_BUTTONS));
+        if (tx_changed & SIG_BIT(SIG_ROTARY_POS)) can_tx_sched_update(TX_SIG_ROTARY, sig_get_i32(SIG_ROTARY_POS));
+        if (tx_changed & SIG_BIT(SIG_CLUTCH_TX))  can_tx_sched_update(TX_SIG_CLUTCH, sig_get_i32(SIG_CLUTCH_TX));
+
+        uint8_t tx_reasons = can_tx_sched_poll(now_ms);
+        if (tx_reasons != 0) {
+            status.button_state = (uint8_t)sig_get_i32(SIG_BUTTONS);
+            status.rotary_position = (uint8_t)sig_get_i32(SIG_ROTARY_POS);
+            status.clutch_value = (uint8_t)((sig_get_i32(SIG_CLUTCH_TX) + 5) / 10);   // Whole % (ClutchValue)
+
+            // One coalesced frame per slot; a refused frame stays due for the next slot
+            if (CAN_SendSteeringStatus(&status) == 0) {
+                can_tx_sched_commit(now_ms);
+                sig_publish_i32(SIG_CAN_TX_PULSE, 1);   // TX indicator on
+                can_tx_time = now_ms;               // Update the TX time when Frame is send it 
+            }
+        }
 
+        // An input event keeps the display active; a press restarts the button message
+        if (Button_flag) msg_time_ms = now_ms;
+        if (Button_flag || (tx_reasons & (TX_REASON_EDGE | TX_REASON_CHANGE))) {
             Button_flag=false;                  // Reset the Buttons Flag
-            last_can_time = now_ms;             // Update/Reset the temporizator for the CAN send
             last_display_time = now_ms;         // Update display time to mantain the active screen
-
-            can_tx_pulse = true;                // Set a Flag for TX can
-            can_tx_time = now_ms;               // Update the TX time when Frame is send it 
-        }
-
-        // Send frame peridically (keep-alive)
-        if ((now_ms - last_can_time) >= CAN_PERIOD_MS) {
-            status.button_state = s_button_val;
-            status.rotary_position = position;
-            status.clutch_value = (int)clutch_percentage;
-
-            CAN_SendSteeringStatus(&status);
-            last_can_time = now_ms;             // Update/Reset the temporizator for the CAN send
-
-            can_tx_pulse = true;                // Set a Flag for TX CAN
-            can_tx_time = now_ms;               //Update the TX time when Frame is send it 
         }
 
 
         /*---------------------------------CAN RECEIVE---------------------------------*/
-        if (CAN_ReceiveECUStatus(&ecu)==1){
+        CAN_Poll();                         // Route every pending frame to its decoder
+        if (CAN_GetECUStatus(&ecu)==1){
             
-            /* Smooth temperatures to avoid visual jumps */
-            t1 = temp_rate_limit(t1, (int)ecu.temp1, 2);   // limit ±2°C per frame
-            t2 = temp_rate_limit(t2, (int)ecu.temp2, 2);   // limit ±2°C per frame
+            t1_ecu = ecu.temp1;
+            t2_ecu = ecu.temp2;
 
             /* Direct values (no smoothing needed) */
-            gear=ecu.gear_actual;
-            pit_l=ecu.pit_limiter_active;
-            drs=ecu.drs_status;
-            LED1_PL=ecu.led_pit;
-            LED2_T=ecu.led_temp;
-
-            can_rx_pulse = true;              // Set a Flag for RX CAN
+            sig_publish_i32(SIG_GEAR, ecu.gear_actual);
+            RxMsgStatus_t ecu_rx;
+            can_rx_mon_getStatus(RX_MSG_ECU_STATUS, &ecu_rx);
+            gear_pred_ecu(ecu.gear_actual, ecu_rx.last_rx_us);      // Confirms or rolls back the predicted gear
+            sig_publish_i32(SIG_PIT_LIMITER, ecu.pit_limiter_active);
+            sig_publish_i32(SIG_DRS, ecu.drs_status);
+            sig_publish_i32(SIG_LED_PIT, ecu.led_pit);
+            sig_publish_i32(SIG_LED_TEMP, ecu.led_temp);
+
+            sig_publish_i32(SIG_CAN_RX_PULSE, 1);   // RX indicator on
             can_rx_time = now_ms;             //Update the RX time when Frame is send it 
         } 
         
 
-        // CAN activity timeout logic
-        if ((now_ms - can_rx_time) < 1000) { // 1 second timeout
-            can_active = true;
+        /* Smooth temperatures to avoid visual jumps: bounded °C per second, every slot */
+        float temp_step = cal.temp_slew_c_per_s * dt_ms / 1000.0f;
+        t1_disp = slew_limit(t1_disp, t1_ecu, temp_step);
+        t2_disp = slew_limit(t2_disp, t2_ecu, temp_step);
+        sig_publish_i32(SIG_T1, round_i32(t1_disp));
+        sig_publish_i32(SIG_T2, round_i32(t2_disp));
+
+        // ECU link supervision: bus arrival times against the 500 ms timeout
+        CAN_UpdateRxSupervision();
+        sig_publish_i32(SIG_CAN_ACTIVE, !can_rx_mon_isStale(RX_MSG_ECU_STATUS));
+
+        // Unconfirmed prediction rolled back after the timeout
+        gear_pred_update(hal_can_get_time_us());
+        sig_publish_i32(SIG_GEAR_SHOWN, gear_pred_shown());
+        sig_publish_i32(SIG_GEAR_PENDING, gear_pred_isPending());
+
+
+        /*---------------------------------ISO-TP (BULK DATA)---------------------------------*/
+        uint32_t tp_len;
+        if (isotp_rx_get(&tp_len) == 1) {
+            if (tp_len == sizeof(tp_session_req) && memcmp(tp_buf, tp_session_req, tp_len) == 0) {
+                // UDS programming session: answer, then reset into the bootloader
+                memcpy(tp_buf, tp_session_rsp, sizeof(tp_session_rsp));
+                isotp_send(tp_buf, sizeof(tp_session_rsp));
+                tp_boot_pending = true;
+            } else {
+                LayoutDl_t dl = layout_dl_request(tp_buf, &tp_len, sizeof(tp_buf));
+                if (dl == LAYOUT_DL_STARTED) {
+                    // The flash slot is rewritten: back to the built-in layout until the end
+                    page_init(DASH_LAYOUT);
+                    lcd_on = false;
+                } else if (dl == LAYOUT_DL_COMPLETE) {
+                    console_printf("[TP] Layout downloaded\r\n");
+                    page_init(layout_select(DASH_LAYOUT));
+                    lcd_on = false;
+                } else if (dl == LAYOUT_DL_NONE) {
+                    console_printf("[TP] %u bytes received\r\n", (unsigned)tp_len);
+                }
+                isotp_send(tp_buf, tp_len);     // Response or loopback, from the same buffer
+            }
+            tp_echo_pending = true;
+        }
+        if (tp_boot_pending && isotp_tx_result() != ISOTP_BUSY) {
+            console_printf("[BOOT] Programming session requested, resetting into the bootloader\r\n");
+            hal_console_flush();
+            hal_can_shutdown();                 // Waits for the response to leave
+            hal_boot_request();                 // Does not return
+        }
+        if (tp_echo_pending && isotp_tx_result() != ISOTP_BUSY) {
+            isotp_rx_arm(tp_buf, sizeof(tp_buf));
+            tp_echo_pending = false;
         }
-        else{
-            can_active = false;
-        } 
 
 
-        //printf("PitL= %u\n", pit_l);
-        //printf("DRS= %u\n", drs);
+        /*---------------------------------CAN DIAGNOSTICS---------------------------------*/
+        // Sampled every slot (bus timebase), published on the bus once per window
+        if (can_diag_update(now_ms)) {
+            can_diag_get(&can_diag_snap);
+            can_diag_send();
+            sig_publish_i32(SIG_BUS_LOAD, can_diag_snap.load_permille / 10u);
+            sig_publish_i32(SIG_BUS_STATE, can_diag_snap.err_state);
+        }
+
 
         /*-------------------------------LED CONTROL----------------------------------*/
 
-        HAL_GPIO_Write(GPIO_LED_S1, LED1_PL);   //ON/OFF LED PIT Limiter
-        HAL_GPIO_Write(GPIO_LED_S2, LED2_T);    //ON/OFF LED Temperature
+        // Pins written only when the ECU changes a request
+        SigMask_t led_changed = sig_changed(sub_leds);
+        if (led_changed & SIG_BIT(SIG_LED_PIT))  HAL_GPIO_Write(GPIO_LED_S1, sig_get_i32(SIG_LED_PIT) != 0);    //ON/OFF LED PIT Limiter
+        if (led_changed & SIG_BIT(SIG_LED_TEMP)) HAL_GPIO_Write(GPIO_LED_S2, sig_get_i32(SIG_LED_TEMP) != 0);   //ON/OFF LED Temperature
 
 
         /*-------------------------------MESSAGE TIMEOUT ----------------------------*/
 
-        msg_clear_counter++;
-
-        /*Evaluate the counter to erase the msg of the buttons (clear after ~50 ticks) */
-        if(msg_clear_counter>50){   
-            msg="-";
-            msg_clear_counter=0;
-        }
+        // Shown BTN_MSG_HOLD_MS after the last press, blinking every BTN_MSG_BLINK_MS
+        uint32_t msg_age_ms = now_ms - msg_time_ms;
+        if (msg_age_ms >= BTN_MSG_HOLD_MS) sig_publish_i32(SIG_BTN_MSG, BTN_MSG_NONE);
+        bool msg_blank = sig_get_i32(SIG_BTN_MSG) != BTN_MSG_NONE && (msg_age_ms / BTN_MSG_BLINK_MS) % 2u != 0u;
+        sig_publish_i32(SIG_BTN_MSG_VISIBLE, !msg_blank);
 
         /*-------------------------------PULSE TIMEOUT------------------------------*/
 
         // Short flash effect (50 ms visible)
-        if ((now_ms - can_tx_time) > 50) can_tx_pulse = false;
-        if ((now_ms - can_rx_time) > 50) can_rx_pulse = false;
+        if ((now_ms - can_tx_time) > CAN_PULSE_MS) sig_publish_i32(SIG_CAN_TX_PULSE, 0);
+        if ((now_ms - can_rx_time) > CAN_PULSE_MS) sig_publish_i32(SIG_CAN_RX_PULSE, 0);
 
         /*---------------------------------SERIAL DEBUG UI-------------------------------*/
         
-        if ((now_ms - last_ui_time) >= UI_PERIOD_MS) {
-            ui_update(s_button_val, position, pos_adc, clutch_raw, clutch_adc, LED1_PL, LED2_T, now_ms);
+        if (cal.ui_period_ms != 0 && (now_ms - last_ui_time) >= cal.ui_period_ms) {
+            ui_update(now_ms);
             last_ui_time = now_ms;
         }
 
        /*---------------------------------DISPLAY LOGIC-------------------------------*/
 
-       
-   
-        if ((now_ms - last_display_time) >= DISPLAY_PERIOD_MS) {
-
-            /*Shutdown Display*/
-            //printf("DISPLAY OFF\n");
-            LCD_fill_screen(BLACK);
-
-        }else{
-
-            /*Display Interface */
-            lcd_update_status(clutch_percentage, position, t1, t2, gear, pit_l, drs, LED2_T,msg);
-            
+        // The rotary switch selects the page. Blank once on timeout; on wake-up or on
+        // a page change, restore the static layer and draw every widget of the page
+        bool lcd_awake = (now_ms - last_display_time) < cal.display_period_ms;
+        uint8_t page_req = (uint8_t)((uint32_t)sig_get_i32(SIG_ROTARY_POS) % page_count());
+        trend_sample(now_ms);   // Trend history of every page, also while blanked
+        if (APP_LCD_FITTED) {
+            if (!lcd_awake) {
+                if (lcd_on) page_blank();
+                lcd_on = false;
+            } else if (!lcd_on || page_req != page_current()) {
+                page_show(page_req);
+                lcd_on = true;
+            } else {
+                page_update();      // Only the widgets whose signals changed
+            }
         }
 
+        /*---------------------------------XCP MEASUREMENT---------------------------------*/
+        // Snapshot of this slot, sampled by the DAQ lists bound to the main-loop event
+        meas.now_ms      = now_ms;
+        meas.clutch_raw  = clutch_raw;
+        meas.clutch_filt = clutch_filt;
+        meas.clutch_adc  = (uint16_t)sig_get_i32(SIG_CLUTCH_ADC);
+        meas.rotary_adc  = (uint16_t)sig_get_i32(SIG_ROTARY_ADC);
+        meas.t1          = (int16_t)sig_get_i32(SIG_T1);
+        meas.t2          = (int16_t)sig_get_i32(SIG_T2);
+        meas.buttons     = (uint8_t)sig_get_i32(SIG_BUTTONS);
+        meas.position    = (uint8_t)sig_get_i32(SIG_ROTARY_POS);
+        meas.gear        = (uint8_t)sig_get_i32(SIG_GEAR);
+        meas.tx_reasons  = tx_reasons;
+        xcp_event(XCP_EVENT_MAIN_LOOP);
+
         /*-----------------------------------PRESENT FRAME --------------------------------------*/
         // This is the final step of the loop.
-        HAL_Display_Present(); // [ONLY SIMULATION]
-        HAL_DelayMs(16); // Pauses for ~16 milliseconds to target a frame rate of ~60 FPS (1000ms / 60fps ≈ 16.6ms).
+        hal_board_present();
+
+        /*---------------------------------PROFILING / TELEMETRY---------------------------*/
+        // Busy time of the slot, then one binary record per period (drivers/telemetry.h)
+        uint32_t busy_us = hal_can_get_time_us() - slot_start_us;
+        prof_update(busy_us);
+
+        TelemSample_t telem = {
+            .now_ms            = now_ms,
+            .buttons           = (uint8_t)sig_get_i32(SIG_BUTTONS),
+            .position          = (uint8_t)sig_get_i32(SIG_ROTARY_POS),
+            .leds              = (uint8_t)((sig_get_i32(SIG_LED_PIT) ? TELEM_LED1 : 0u) | (sig_get_i32(SIG_LED_TEMP) ? TELEM_LED2 : 0u)),
+            .flags             = sig_get_i32(SIG_CAN_ACTIVE) ? TELEM_FLAG_CAN_ACTIVE : 0u,
+            .rotary_adc        = (uint16_t)sig_get_i32(SIG_ROTARY_ADC),
+            .clutch_adc        = (uint16_t)sig_get_i32(SIG_CLUTCH_ADC),
+            .clutch_raw        = clutch_raw,
+            .clutch_filt       = clutch_filt,
+            .t1                = (int16_t)sig_get_i32(SIG_T1),
+            .t2                = (int16_t)sig_get_i32(SIG_T2),
+            .gear              = (uint8_t)sig_get_i32(SIG_GEAR),
+            .loop_us           = busy_us,
+            .can_tx_age_ms     = now_ms - can_tx_time,
+            .can_rx_age_ms     = now_ms - can_rx_time,
+            .bus_load_permille = can_diag_snap.load_permille,
+        };
+        telem_update(&telem);
+
+        // Waits for the end of the 16 ms slot to target a frame rate of ~60 FPS (1000ms / 60fps ≈ 16.6ms):
+        // the slot period does not depend on the busy time. The bus is polled meanwhile (busy on the
+        // target, every millisecond on the host), so bulk ISO-TP transfers keep going: the next flow
+        // control leaves early.
+        while ((hal_can_get_time_us() - slot_start_us) < LOOP_SLOT_US) {
+            CAN_Poll();
+            hal_board_idle();
+        }
     }
 
     // --- SHUTDOWN ---
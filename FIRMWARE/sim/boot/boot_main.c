@@ -0,0 +1,79 @@
+/**
+ * @file boot_main.c
+ * @brief Entry point of the CAN bootloader (host simulation build).
+ *
+ * @details
+ * Same decision as the target bootloader (target/SW_BOOT/src/main.c): stay
+ * resident when the application asked for it or the slot holds no valid
+ * image, otherwise start the application. On the host the flash is the model
+ * file of hal_flash_host.c and "starting the application" ends the process.
+ *
+ * Build: `make boot` (output in build/host_pc/<CONFIG>/bin/f1_boot).
+ *
+ * Example, on the user-space bus, with a wrapper that starts the bootloader
+ * when the simulator exits with ::HAL_BOOT_EXIT_REQUEST:
+ * @code
+ *   export F1_CAN_IF=vbus:default
+ *   build/host_pc/Debug/bin/f1_steering_host_pc; [ $? -eq 3 ] && build/host_pc/Debug/bin/f1_boot
+ *   python3 tools/can_flash.py -i vbus:default app.bin
+ * @endcode
+ */
+
+/*----------------------------------INCLUDES---------------------------------------------*/
+#include "hal_can.h"
+#include "hal_boot.h"
+#include "hal_delay.h"
+#include "isotp.h"
+#include "bootloader.h"
+#include <stdio.h>
+
+/*----------------------------------CONSTANTS--------------------------------------------*/
+
+/** @brief Only the tester requests reach the bootloader. */
+static const hal_can_filter_t boot_filters[] = {
+    { ISOTP_RX_ID, HAL_CAN_STD_MASK },
+};
+
+/*-------------------------------------MAIN--------------------------------------------*/
+
+/**
+ * @brief Bootloader entry point.
+ *
+ * @return Never returns: the process ends when the application is started.
+ */
+int main(void) {
+    BootStats_t stats;
+    uint32_t reported_ms = 0;
+
+    bool requested = hal_boot_requested();
+
+    if (hal_can_init("vcan0") < 0) return 1;
+    hal_can_set_filters(boot_filters, sizeof(boot_filters) / sizeof(boot_filters[0]));
+    boot_init();
+
+    bool valid = boot_app_valid();
+    if (!requested && valid && !boot_entry_window()) {
+        hal_can_shutdown();
+        hal_boot_jump(BOOT_APP_BASE);
+    }
+
+    printf("[BOOT] Bootloader resident (%s), image %s\n",
+           requested ? "requested" : "tester", valid ? "valid" : "not valid");
+
+    for (;;) {
+        boot_poll();
+
+        // One line per completed download: the flashing time
+        boot_getStats(&stats);
+        if (stats.elapsed_ms != 0u && stats.elapsed_ms != reported_ms) {
+            reported_ms = stats.elapsed_ms;
+            printf("[BOOT] %u bytes in %u ms (%.1f kB/s), erase %u ms, program %u ms\n",
+                   (unsigned)stats.bytes, (unsigned)stats.elapsed_ms,
+                   (double)stats.bytes / (double)stats.elapsed_ms,
+                   (unsigned)stats.erase_ms, (unsigned)stats.program_ms);
+            fflush(stdout);
+        }
+
+        HAL_DelayUs(50);    // A frame lasts ~230 µs at 500 kbit/s: no reception is missed
+    }
+}
@@ -5,6 +5,8 @@
 #include "hal_spi.h"
 #include "hal_gpio.h"
 #include "hal_delay.h"
+#include "hal_ramfunc.h"
+#include "hal_time.h"
 #include <stdio.h>
 #include <stdarg.h>
 
@@ -31,6 +33,7 @@
 /* Defines and Variables */
 #define swap(a, b) { int16_t t = a; a = b; b = t; }
 static const uint8_t font[] = TFT_FONT;
+static uint32_t tx_bytes = 0;										/* Bytes sent to the panel (LCD_get_tx_bytes) */
 
 /* Private Function Prototypes */
 //void TFT_LCD_delay           	(uint32_t wait);
@@ -49,6 +52,7 @@ void TFT_LCD_set_address_window (int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 * @param[uint8_t Val] 8-bit data
 */
 
+HAL_RAMFUNC
 void TFT_LCD_transmit_8bits (uint8_t val)
 {
 	/* Dummy variable to store the response */
@@ -56,8 +60,10 @@ void TFT_LCD_transmit_8bits (uint8_t val)
 
     /* Slave response is not needed*/
     CS_LOW();
-    HAL_SPI_WriteData(&val, 1); //send val that is 1 byte of data
+    HAL_SPI_TransmitByte(val);
+    HAL_SPI_WaitTxDone();               /* Let the byte leave the FIFO before CS rises */
     CS_HIGH();
+    tx_bytes++;
 
     //(void)dummy;
 }
@@ -150,18 +156,25 @@ void TFT_LCD_set_address_window (int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 	TFT_LCD_write_8command(0x2C); 							/* ILI9341_RAMWR: Write to RAM */
 }
 
-/*------------ Public Function Prototypes------------------------ */
-void LCD_display9341_init (void)
-{
-	//LPSPI0_init_master();
-    //HAL_SPI_Init();
+/*------------ Display init sequence ------------------------------ */
+/* Each step sends commands and returns the wait before the next one (ms), so the
+ * same sequence runs blocking (LCD_display9341_init) or polled (LCD_display9341_start) */
 
-    // Reset físico
+static uint16_t lcd_init_reset_low (void)
+{
+    /* Hardware reset (the SPI is configured by HAL_SPI_Init) */
     HAL_GPIO_Write(PIN_RST, 0);
-    HAL_DelayMs(20);
+    return 20;
+}
+
+static uint16_t lcd_init_reset_high (void)
+{
     HAL_GPIO_Write(PIN_RST, 1);
-    HAL_DelayMs(120);
+    return 120;
+}
 
+static uint16_t lcd_init_config (void)
+{
     // Initialization (idéntica al driver NXP)
 	TFT_LCD_write_8command(0xEF);
 	TFT_LCD_write_8data(0x03);
@@ -267,10 +280,54 @@ void LCD_display9341_init (void)
 	TFT_LCD_write_8data(0x0F);
 
 	TFT_LCD_write_8command(0x11); 							/* ILI9341_SLPOUT  Exit Sleep */
-	HAL_DelayMs(60);//TFT_LCD_delay(1000000);     			/* Wait for 60ms */
+	return 120;												/* Supply settling: 60 ms was too short on the board */
+}
+
+static uint16_t lcd_init_on (void)
+{
 	TFT_LCD_write_8command(0x29); 							/* ILI9341_DISPON  Display On */
+	return 20;
+}
 
+static uint16_t lcd_init_clear (void)
+{
 	LCD_fill_screen(BLACK);
+	return 0;
+}
+
+static uint16_t (* const lcd_init_steps[])(void) = {
+    lcd_init_reset_low, lcd_init_reset_high, lcd_init_config, lcd_init_on, lcd_init_clear,
+};
+#define LCD_INIT_STEPS  (sizeof(lcd_init_steps) / sizeof(lcd_init_steps[0]))
+
+static uint8_t  lcd_init_step = LCD_INIT_STEPS;    /* Next step of the polled init */
+static uint32_t lcd_wait_start_us = 0;
+static uint32_t lcd_wait_us = 0;
+
+/*------------ Public Function Prototypes------------------------ */
+void LCD_display9341_init (void)
+{
+    for (uint8_t i = 0; i < LCD_INIT_STEPS; i++)
+    {
+        HAL_DelayMs(lcd_init_steps[i]());
+    }
+}
+
+void LCD_display9341_start (void)
+{
+    lcd_init_step = 0;
+    lcd_wait_us = 0;
+    (void)LCD_display9341_poll();   /* Reset low now */
+}
+
+bool LCD_display9341_poll (void)
+{
+    if (lcd_init_step >= LCD_INIT_STEPS) return true;
+    if ((hal_time_us() - lcd_wait_start_us) < lcd_wait_us) return false;
+
+    lcd_wait_us = 1000u * lcd_init_steps[lcd_init_step++]();
+    lcd_wait_start_us = hal_time_us();
+    return (lcd_init_step >= LCD_INIT_STEPS) && (lcd_wait_us == 0u);
 }
 
 /*---------GRAFIC FUNTIONS---------------*/
@@ -293,6 +350,7 @@ void LCD_fill_screen (uint16_t color)
 * @param[uint16_t color] Desired Color. Use the colors definitions in TFT_LCD.h
 * @param[uint32_t length] Number of pixels, starts from the origin.
 */
+HAL_RAMFUNC
 void LCD_flood (uint16_t color, uint32_t length)
 {
 	uint16_t blocks;
@@ -500,6 +558,7 @@ void LCD_draw_fast_vertical_line (int16_t x, int16_t y, int16_t length, uint16_t
 * @param[uint16_t bg_color] Background color (behind the character). Use the colors definitions in TFT_LCD.h
 * @param[uint8_t size] Character font. Use the fonts definitions in TFT_LCD.h
 */
+HAL_RAMFUNC
 void LCD_draw_char (int16_t x1, int16_t y1, int8_t chr, uint16_t fg_color, uint16_t bg_color, uint8_t size)
 {
 	int16_t x2, y2;
@@ -565,7 +624,7 @@ void LCD_draw_string (int16_t x1, int16_t y1, const char *chr, uint16_t fg_color
 void LCD_draw_number(uint16_t x1, uint16_t y1, int32_t num, uint16_t fg_color, uint16_t bg_color, uint8_t size)
 {
     char buffer[12]; // Reach at -2147483648
-    snprintf(buffer, sizeof(buffer), "%d", num);
+    snprintf(buffer, sizeof(buffer), "%ld", (long)num);
     LCD_draw_string(x1, y1, buffer, fg_color, bg_color, size);
 }
 
@@ -633,6 +692,135 @@ void LCD_draw_image (uint16_t pos_x, uint16_t pos_y, uint16_t size_x, uint16_t s
 	}
 }
 
+/*!
+* @brief Draw a run-length encoded image in one address window.
+*
+* @details
+* Each run is one byte: the palette index in the high nibble and the length
+* (1 to 15 pixels) in the low nibble. A length nibble of 0 means the length
+* follows as 16 bits, little endian. Runs go left to right, top to bottom
+* and may wrap to the next row. Generated by tools/layout2c.py.
+*
+* @param[int16_t x] Initial X Coordinate, image origin.
+* @param[int16_t y] Initial Y Coordinate, image origin.
+* @param[int16_t w] Image width.
+* @param[int16_t h] Image height.
+* @param[const uint16_t *palette] Colors of the image (up to 16).
+* @param[const uint8_t *rle] Encoded runs.
+* @param[uint32_t size] Bytes of rle.
+*/
+void LCD_draw_rle (int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *palette, const uint8_t *rle, uint32_t size)
+{
+	uint32_t i = 0, length;
+	uint8_t code;
+
+	TFT_LCD_set_address_window(x, y, x + w - 1, y + h - 1);
+
+	while (i < size)
+	{
+		code = rle[i++];
+		length = code & 0x0F;
+		if (length == 0)
+		{
+			length = (uint32_t)rle[i] | ((uint32_t)rle[i + 1] << 8);
+			i += 2;
+		}
+		if (length > 0)
+		{
+			LCD_flood(palette[code >> 4], length);
+		}
+	}
+}
+
+/*!
+* @brief Bytes sent to the panel since power-up (commands and pixel data).
+*
+* @return uint32_t Byte count, wraps around.
+*/
+uint32_t LCD_get_tx_bytes (void)
+{
+	return tx_bytes;
+}
+
+
+/*!
+* @brief Draw one column of a chart in a single address window.
+*
+* @details
+* The column is h pixels high from (x, y): background above top, the color
+* from top to bottom (both included), background below. Used by the trend
+* widgets to draw one new sample without touching the rest of the chart.
+*
+* @param[int16_t x] X Coordinate.
+* @param[int16_t y] Y Coordinate of the top of the column.
+* @param[int16_t h] Column height.
+* @param[int16_t top] First colored row (from y, 0 .. h-1).
+* @param[int16_t bottom] Last colored row (below top: no span).
+* @param[uint16_t color] Span color.
+* @param[uint16_t bg_color] Background color.
+*/
+void LCD_draw_column (int16_t x, int16_t y, int16_t h, int16_t top, int16_t bottom, uint16_t color, uint16_t bg_color)
+{
+	if ((h <= 0) || (x < 0) || (x >= width) || (y < 0) || (y + h > height)) return;
+	if (top < 0) top = 0;
+	if (bottom >= h) bottom = h - 1;
+
+	TFT_LCD_set_address_window(x, y, x, y + h - 1);
+	if (bottom < top)										/* No span: background only */
+	{
+		LCD_flood(bg_color, (uint32_t)h);
+		return;
+	}
+	if (top > 0) LCD_flood(bg_color, (uint32_t)top);		/* LCD_flood needs a length > 0 */
+	LCD_flood(color, (uint32_t)(bottom - top + 1));
+	if (bottom < h - 1) LCD_flood(bg_color, (uint32_t)(h - 1 - bottom));
+}
+
+
+/*!
+* @brief Define the vertical scrolling area (ILI9341 VSCRDEF).
+*
+* @details
+* The panel scrolls along its 320 gate lines. With TFT_ORIGIN 0x28 (MV set)
+* they are the screen columns: the area is a band of screen columns
+* [first, first + lines), always the full screen height, and scrolling moves
+* it left. The lines outside the band stay fixed.
+*
+* @param[uint16_t first] First line of the band (top fixed area).
+* @param[uint16_t lines] Lines of the band (first + lines <= 320).
+*/
+void LCD_scroll_area (uint16_t first, uint16_t lines)
+{
+	uint16_t bottom = (uint16_t)(TFT_HEIGHT - first - lines);
+
+	TFT_LCD_write_8command(0x33); 							/* ILI9341_VSCRDEF: Vertical Scrolling Definition */
+	TFT_LCD_write_8data((uint8_t)(first >> 8));
+	TFT_LCD_write_8data((uint8_t)first);    				/* TFA */
+	TFT_LCD_write_8data((uint8_t)(lines >> 8));
+	TFT_LCD_write_8data((uint8_t)lines);    				/* VSA */
+	TFT_LCD_write_8data((uint8_t)(bottom >> 8));
+	TFT_LCD_write_8data((uint8_t)bottom);   				/* BFA */
+}
+
+
+/*!
+* @brief Set the line shown first in the scrolling area (ILI9341 VSCRSADD).
+*
+* @details
+* Line `line` of the memory is shown at the start of the band, the following
+* ones after it, wrapping inside the band. LCD_scroll_to(first) shows the
+* memory unscrolled. Only the display moves: drawing still uses memory
+* coordinates.
+*
+* @param[uint16_t line] Memory line, inside the band of LCD_scroll_area.
+*/
+void LCD_scroll_to (uint16_t line)
+{
+	TFT_LCD_write_8command(0x37); 							/* ILI9341_VSCRSADD: Vertical Scrolling Start Address */
+	TFT_LCD_write_8data((uint8_t)(line >> 8));
+	TFT_LCD_write_8data((uint8_t)line);
+}
+
 
 /*!
 * @brief Draw a circle with the given ratio and given color.
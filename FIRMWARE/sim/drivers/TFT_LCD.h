@@ -3,6 +3,7 @@
 #define TFT_LCD_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /* TFT LCD Size */
 #define TFT_WIDTH		(240)
@@ -23,6 +24,7 @@
 #define MAGENTA         (0xF81F)
 #define YELLOW          (0xFFE0)
 #define WHITE           (0xFFFF)
+#define GRAY            (0x8410)
 
 /* LCD Font Array */
 #define TFT_FONT \
@@ -286,6 +288,8 @@
 
 /* Public Function Prototypes */
 void LCD_display9341_init  				(void);
+void LCD_display9341_start 				(void);		/* Non-blocking init: then LCD_display9341_poll() until true */
+bool LCD_display9341_poll  				(void);
 void LCD_fill_screen       				(uint16_t color);
 void LCD_flood            				(uint16_t color, uint32_t length);
 
@@ -301,6 +305,11 @@ void LCD_draw_float                     (uint16_t x1, uint16_t y1, float num, ui
 void LCD_printf                         (uint16_t x, uint16_t y, uint16_t color, uint16_t bg, uint8_t size, const char *fmt, ...);
 
 void LCD_draw_image         			(uint16_t pos_x, uint16_t pos_y, uint16_t size_x, uint16_t size_y, const uint8_t *image);
+void LCD_draw_rle           			(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *palette, const uint8_t *rle, uint32_t size);
+uint32_t LCD_get_tx_bytes       		(void);
+void LCD_draw_column        			(int16_t x, int16_t y, int16_t h, int16_t top, int16_t bottom, uint16_t color, uint16_t bg_color);
+void LCD_scroll_area        			(uint16_t first, uint16_t lines);
+void LCD_scroll_to          			(uint16_t line);
 void LCD_draw_circle        			(int16_t  x0, int16_t  y0, int16_t  r, uint16_t color);
 void LCD_draw_circle_helper  			(int16_t x0, int16_t y0, int16_t r, uint8_t corner_name, uint16_t color);
 void LCD_draw_square        			(int16_t x, int16_t y, int16_t l, uint16_t color);
@@ -315,4 +324,4 @@ void LCD_fill_rectangle    				(int16_t x1, int16_t y1, int16_t w, int16_t h, ui
 void LCD_fill_round_rectangle  			(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
 void LCD_fill_triangle  				(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
 
-#endif /* TFT_LCD_H*/
\ No newline at end of file
+#endif /* TFT_LCD_H*/
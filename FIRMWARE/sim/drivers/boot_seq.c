@@ -0,0 +1,110 @@
+/**
+ * @file boot_seq.c
+ * @brief Implementation of the boot sequencer.
+ *
+ * @details
+ * Each pass polls the waiting stages, then starts the first startable one,
+ * so a long wait is checked between two starts and its end time is exact to
+ * the duration of one start function.
+ */
+
+#include "boot_seq.h"
+#include "hal_time.h"
+#include "hal_log.h"
+#include <stddef.h>
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static BootRecord_t records[BOOT_SEQ_MAX_STAGES];
+static uint8_t      record_count = 0;
+
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+static bool finished(uint8_t i) {
+    return records[i].state == BOOT_STAGE_DONE || records[i].state == BOOT_STAGE_TIMEOUT;
+}
+
+/** @brief true when every stage of the mask is finished. */
+static bool deps_finished(uint32_t after, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        if ((after & BOOT_AFTER(i)) && !finished(i)) return false;
+    }
+    return true;
+}
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+uint32_t boot_seq_run(const BootStage_t *stages, uint8_t count) {
+    uint32_t boot_end_us = hal_time_us();
+
+    if (count > BOOT_SEQ_MAX_STAGES) count = BOOT_SEQ_MAX_STAGES;
+    uint8_t left = count;
+    record_count = count;
+    for (uint8_t i = 0; i < count; i++) {
+        records[i] = (BootRecord_t){ .name = stages[i].name, .state = BOOT_STAGE_PENDING };
+    }
+
+    while (left > 0u) {
+        bool busy = false;
+
+        /* Waiting stages first: their end time is taken as soon as possible */
+        for (uint8_t i = 0; i < count; i++) {
+            if (records[i].state != BOOT_STAGE_WAITING) continue;
+            busy = true;
+            uint32_t now = hal_time_us();
+            if (stages[i].poll()) {
+                records[i].state = BOOT_STAGE_DONE;
+            } else if (stages[i].timeout_us != 0u && (now - records[i].start_us) > stages[i].timeout_us) {
+                records[i].state = BOOT_STAGE_TIMEOUT;
+            } else {
+                continue;
+            }
+            records[i].end_us = hal_time_us();
+            left--;
+        }
+
+        /* Then one new stage, in table order */
+        for (uint8_t i = 0; i < count; i++) {
+            if (records[i].state != BOOT_STAGE_PENDING || !deps_finished(stages[i].after, count)) continue;
+            records[i].start_us = hal_time_us();
+            stages[i].start();
+            records[i].end_us = hal_time_us();
+            if (stages[i].poll != NULL) {
+                records[i].state = BOOT_STAGE_WAITING;
+                records[i].waited = true;
+            } else {
+                records[i].state = BOOT_STAGE_DONE;
+                left--;
+            }
+            busy = true;
+            break;
+        }
+
+        if (!busy) break;       /* `after` mask that can never be met: the rest stays PENDING */
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (records[i].end_us > boot_end_us) boot_end_us = records[i].end_us;
+    }
+    return boot_end_us;
+}
+
+uint8_t boot_seq_count(void) {
+    return record_count;
+}
+
+const BootRecord_t *boot_seq_record(uint8_t index) {
+    return (index < record_count) ? &records[index] : NULL;
+}
+
+void boot_seq_report(void) {
+    for (uint8_t i = 0; i < record_count; i++) {
+        const BootRecord_t *r = &records[i];
+        HAL_LOG("[BOOT] %-10s start %8lu us  end %8lu us  (%lu us)%s\r\n", r->name,
+                (unsigned long)r->start_us, (unsigned long)r->end_us,
+                (unsigned long)(r->end_us - r->start_us),
+                (r->state == BOOT_STAGE_TIMEOUT) ? "  TIMEOUT" : (r->waited ? "  wait" : ""));
+    }
+}
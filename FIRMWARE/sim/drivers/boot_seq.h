@@ -0,0 +1,99 @@
+/**
+ * @file boot_seq.h
+ * @brief Boot sequencer: runs the init stages with overlapping waits and times each one.
+ *
+ * @details
+ * Each stage has a start function, which configures the peripheral and
+ * returns at once, and optionally a poll function, which reports when the
+ * slow part (oscillator start-up, display reset delays) is over. While a
+ * stage waits, the sequencer starts the next ones, so the waits overlap
+ * instead of adding up. A stage starts only once the stages in its `after`
+ * mask are finished (e.g. SPI after the oscillator it is clocked from).
+ *
+ * The stages start in table order: put CAN first, so the wheel is on the
+ * bus as early as possible. A stage whose poll does not finish within its
+ * timeout is marked ::BOOT_STAGE_TIMEOUT and the boot goes on.
+ *
+ * Every stage records its start and end time (::hal_time_us, µs since
+ * main()). ::boot_seq_report logs the timeline:
+ *
+ *     [BOOT] can        start      412 us  end      655 us  (243 us)
+ *     [BOOT] sosc       start      655 us  end     2870 us  (2215 us)  wait
+ */
+
+#ifndef BOOT_SEQ_H
+#define BOOT_SEQ_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define BOOT_SEQ_MAX_STAGES  16u                    /**< Largest stage table. */
+#define BOOT_AFTER(i)        (1UL << (i))           /**< `after` bit of stage i. */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief One init stage.
+ */
+typedef struct {
+    const char *name;           /**< Name in the timeline. */
+    void      (*start)(void);   /**< Configures the stage; must not wait. */
+    bool      (*poll)(void);    /**< true once the stage is finished; NULL: finished by start. */
+    uint32_t    timeout_us;     /**< Longest poll phase (0 = no limit). */
+    uint32_t    after;          /**< Stages that must be finished first (::BOOT_AFTER bits). */
+} BootStage_t;
+
+/**
+ * @brief State of a stage.
+ */
+typedef enum {
+    BOOT_STAGE_PENDING = 0,     /**< Not started. */
+    BOOT_STAGE_WAITING,         /**< Started, poll not finished yet. */
+    BOOT_STAGE_DONE,            /**< Finished. */
+    BOOT_STAGE_TIMEOUT,         /**< Poll did not finish within timeout_us. */
+} BootStageState_t;
+
+/**
+ * @brief Timeline entry of a stage.
+ */
+typedef struct {
+    const char *name;           /**< Stage name. */
+    uint32_t    start_us;       /**< Start time (µs since main()). */
+    uint32_t    end_us;         /**< End of start, or end of the wait. */
+    uint8_t     state;          /**< ::BootStageState_t. */
+    bool        waited;         /**< The stage had a poll phase. */
+} BootRecord_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Runs the stage table until every stage is finished.
+ *
+ * @param[in] stages Stage table (kept by reference for the report).
+ * @param[in] count  Number of stages (up to ::BOOT_SEQ_MAX_STAGES).
+ * @return uint32_t Boot time: end of the last stage (µs since main()).
+ */
+uint32_t boot_seq_run(const BootStage_t *stages, uint8_t count);
+
+/**
+ * @brief Number of stages of the last run.
+ */
+uint8_t boot_seq_count(void);
+
+/**
+ * @brief Timeline entry of a stage.
+ *
+ * @param[in] index Stage index (table order).
+ * @return const BootRecord_t* Entry, NULL if index is out of range.
+ */
+const BootRecord_t *boot_seq_record(uint8_t index);
+
+/**
+ * @brief Logs the timeline (HAL_LOG), one line per stage.
+ */
+void boot_seq_report(void);
+
+#endif /* BOOT_SEQ_H */
@@ -0,0 +1,447 @@
+/**
+ * @file bootloader.c
+ * @brief Implementation of the resident CAN bootloader.
+ *
+ * @details
+ * Two message buffers alternate between ISO-TP reception and the flash
+ * writer. A TransferData block stays in its buffer until it is programmed
+ * and read back. The sector of a block is erased ahead, as soon as the
+ * writer is idle, so the writer usually only has phrases to program when the
+ * block arrives. A block is acknowledged once the other buffer is armed, so
+ * the next request (TransferData or a single frame) always finds room.
+ */
+
+#include "bootloader.h"
+#include "isotp.h"
+#include "hal_can.h"
+#include "hal_boot.h"
+#include <stddef.h>            /* For NULL */
+#include <string.h>
+
+/*--------------------------PROTOCOL CONSTANTS-----------------------------------*/
+
+/* UDS service identifiers (positive response: SID + 0x40) */
+#define SID_SESSION         0x10u
+#define SID_RESET           0x11u
+#define SID_DOWNLOAD        0x34u
+#define SID_TRANSFER        0x36u
+#define SID_EXIT            0x37u
+#define SID_TESTER_PRESENT  0x3Eu
+#define SID_NEGATIVE        0x7Fu
+#define POSITIVE(sid)       ((uint8_t)((sid) + 0x40u))
+
+/* Negative response codes */
+#define NRC_SERVICE         0x11u   /**< serviceNotSupported */
+#define NRC_SUBFUNCTION     0x12u   /**< subFunctionNotSupported */
+#define NRC_LENGTH          0x13u   /**< incorrectMessageLengthOrInvalidFormat */
+#define NRC_CONDITIONS      0x22u   /**< conditionsNotCorrect */
+#define NRC_SEQUENCE        0x24u   /**< requestSequenceError */
+#define NRC_RANGE           0x31u   /**< requestOutOfRange */
+#define NRC_PROGRAMMING     0x72u   /**< generalProgrammingFailure */
+#define NRC_BLOCK_SEQUENCE  0x73u   /**< wrongBlockSequenceCounter */
+
+#define SESSION_DEFAULT     0x01u
+#define SESSION_PROGRAMMING 0x02u
+#define RESET_HARD          0x01u
+#define SUPPRESS_RESPONSE   0x80u   /**< Sub-function bit: no positive response. */
+
+#define DOWNLOAD_FORMAT     0x44u   /**< addressAndLengthFormatIdentifier: 4-byte size and address. */
+#define MSG_SIZE            (2u + BOOT_BLOCK_SIZE)  /**< TransferData: SID, counter, block. */
+
+#define PROGRAM_STEP        (32u * HAL_FLASH_PHRASE_SIZE)  /**< Bytes programmed per boot_poll (~3 ms on the FTFC). */
+
+/*--------------------------PRIVATE TYPES-----------------------------------*/
+
+typedef enum {
+    BUF_FREE,               /**< Neither receiving nor queued. */
+    BUF_RX,                 /**< Armed for ISO-TP reception. */
+    BUF_FLASH               /**< Block waiting for or being programmed. */
+} buf_state_t;
+
+typedef struct {
+    uint32_t addr;          /**< Flash address of the block. */
+    uint32_t len;           /**< Bytes to program (padded to a phrase). */
+    uint32_t done;          /**< Bytes programmed. */
+} flash_job_t;
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+/* Link parameters: the loop polls continuously and stashes frames during flash commands */
+static const IsoTpConfig_t boot_isotp_cfg = {
+    .block_size = 32,       /* At most 32 frames (1 KB) arrive during one flash command */
+    .st_min     = 0,
+    .wft_max    = 8,
+    .padding    = 0xCC,
+    .n_bs_ms    = 1000,
+    .n_cr_ms    = 1000,
+};
+
+static uint8_t     msg_buf[2][MSG_SIZE];
+static buf_state_t buf_state[2];
+static flash_job_t buf_job[2];
+static int8_t      rx_idx = -1;         /**< Buffer armed for reception, -1: none. */
+static int8_t      job_q[2] = { -1, -1 };   /**< Blocks to program, in order. */
+
+/* --- Download --- */
+static bool     downloading = false;
+static uint32_t dl_size = 0;            /**< Announced image size. */
+static uint32_t dl_offset = 0;          /**< Bytes accepted. */
+static uint8_t  dl_seq = 1;             /**< Expected block sequence counter. */
+static uint32_t erased_end = 0;         /**< Sectors below this address are erased. */
+static bool     flash_failed = false;   /**< Erase, program or read-back failed. */
+static bool     exit_pending = false;   /**< RequestTransferExit waits for the writer. */
+static uint32_t exit_crc = 0;
+static uint32_t dl_start_us = 0;
+
+/* --- Responses --- */
+static uint8_t  rsp_next[8];            /**< Response waiting for the transmitter. */
+static uint8_t  rsp_next_len = 0;
+static uint8_t  rsp_tx[8];              /**< Response being sent (read in place by ISO-TP). */
+static bool     ack_pending = false;    /**< TransferData response waits for a free buffer. */
+static uint8_t  ack_seq = 0;
+static bool     reset_pending = false;  /**< Start the application once `51 01` is sent. */
+static bool     session_entered = false;
+
+static uint32_t crc_table[256];
+static bool     crc_ready = false;
+
+static BootStats_t stats;
+static uint32_t    erase_us = 0;        /**< Flash command times, summed in µs (one step is ~3 ms). */
+static uint32_t    program_us = 0;
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+static uint32_t rd32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static uint32_t ms_since(uint32_t t0_us) {
+    return (hal_can_get_time_us() - t0_us) / 1000u;
+}
+
+/** @brief Queues a response; sent as soon as the transmitter is free. */
+static void respond(const uint8_t *rsp, uint8_t len) {
+    memcpy(rsp_next, rsp, len);
+    rsp_next_len = len;
+    if (rsp[0] == SID_NEGATIVE) stats.last_nrc = rsp[2];
+}
+
+static void respond_nrc(uint8_t sid, uint8_t nrc) {
+    const uint8_t rsp[3] = { SID_NEGATIVE, sid, nrc };
+    respond(rsp, sizeof rsp);
+}
+
+static void send_response(void) {
+    if (rsp_next_len == 0u || isotp_tx_result() == ISOTP_BUSY) return;
+    memcpy(rsp_tx, rsp_next, rsp_next_len);
+    if (isotp_send(rsp_tx, rsp_next_len) == 0) rsp_next_len = 0;
+}
+
+/** @brief Arms a free buffer for the next message, if none is armed. */
+static void arm_free_buffer(void) {
+    if (rx_idx >= 0) return;
+    for (int8_t i = 0; i < 2; i++) {
+        if (buf_state[i] == BUF_FREE) {
+            buf_state[i] = BUF_RX;
+            rx_idx = i;
+            isotp_rx_arm(msg_buf[i], MSG_SIZE);
+            return;
+        }
+    }
+}
+
+static void abort_download(void) {
+    downloading = false;
+    exit_pending = false;
+    ack_pending = false;
+    job_q[0] = job_q[1] = -1;
+    for (int8_t i = 0; i < 2; i++) {
+        if (buf_state[i] == BUF_FLASH) buf_state[i] = BUF_FREE;
+    }
+}
+
+/** @brief Erases the sector at erased_end and moves the mark. */
+static bool erase_next(void) {
+    uint32_t t0 = hal_can_get_time_us();
+    int ret = hal_flash_erase_sector(erased_end);
+    erase_us += hal_can_get_time_us() - t0;
+    erased_end += HAL_FLASH_SECTOR_SIZE;
+    return ret == 0;
+}
+
+/**
+ * @brief One step of the flash writer.
+ *
+ * @details
+ * Programs ::PROGRAM_STEP bytes of the oldest queued block (erasing its
+ * sector first if needed), or erases the next sector of the download ahead.
+ * After the last phrase the block is read back and its buffer released.
+ */
+static void flash_step(void) {
+    int8_t b = job_q[0];
+
+    if (b < 0) {
+        /* Idle: erase ahead up to the end of the announced image */
+        if (downloading && !flash_failed &&
+            erased_end < BOOT_APP_BASE + dl_size && !erase_next()) flash_failed = true;
+        return;
+    }
+
+    flash_job_t *job = &buf_job[b];
+    const uint8_t *data = &msg_buf[b][2];
+
+    if (job->addr >= erased_end) {
+        if (!erase_next()) flash_failed = true;
+        return;
+    }
+
+    uint32_t n = job->len - job->done;
+    if (n > PROGRAM_STEP) n = PROGRAM_STEP;
+
+    uint32_t t0 = hal_can_get_time_us();
+    if (hal_flash_program(job->addr + job->done, &data[job->done], n) != 0) flash_failed = true;
+    program_us += hal_can_get_time_us() - t0;
+    job->done += n;
+
+    if (job->done >= job->len || flash_failed) {
+        if (!flash_failed && memcmp(hal_flash_ptr(job->addr), data, job->len) != 0) flash_failed = true;
+        stats.blocks++;
+        buf_state[b] = BUF_FREE;
+        job_q[0] = job_q[1];
+        job_q[1] = -1;
+    }
+}
+
+/** @brief Acknowledges the last block once a buffer is armed for the next request. */
+static void send_ack(void) {
+    if (!ack_pending || rx_idx < 0) return;
+    ack_pending = false;
+    const uint8_t rsp[2] = { POSITIVE(SID_TRANSFER), ack_seq };
+    respond(rsp, sizeof rsp);
+}
+
+/** @brief Ends a download once the writer is idle: CRC check and descriptor. */
+static void finish_download(void) {
+    if (!exit_pending || job_q[0] >= 0) return;
+    exit_pending = false;
+    downloading = false;
+
+    BootDescriptor_t desc = { BOOT_DESC_MAGIC, dl_size, 0u, 0xFFFFFFFFu };
+    desc.crc = boot_crc32(0u, hal_flash_ptr(BOOT_APP_BASE), dl_size);
+
+    if (flash_failed || desc.crc != exit_crc ||
+        hal_flash_program(BOOT_DESC_ADDR, (const uint8_t *)&desc, sizeof desc) != 0) {
+        respond_nrc(SID_EXIT, NRC_PROGRAMMING);
+        return;
+    }
+    stats.elapsed_ms = ms_since(dl_start_us);
+    const uint8_t rsp[1] = { POSITIVE(SID_EXIT) };
+    respond(rsp, sizeof rsp);
+}
+
+/*--------------------------SERVICES-----------------------------------*/
+
+static void on_session(const uint8_t *req, uint32_t len) {
+    if (len != 2u) { respond_nrc(SID_SESSION, NRC_LENGTH); return; }
+
+    uint8_t type = req[1] & (uint8_t)~SUPPRESS_RESPONSE;
+    if (type != SESSION_DEFAULT && type != SESSION_PROGRAMMING) {
+        respond_nrc(SID_SESSION, NRC_SUBFUNCTION);
+        return;
+    }
+    if (type == SESSION_PROGRAMMING) session_entered = true;
+    if (req[1] & SUPPRESS_RESPONSE) return;
+
+    /* P2server 50 ms, P2*server 5 s (10 ms units) */
+    const uint8_t rsp[6] = { POSITIVE(SID_SESSION), type, 0x00, 0x32, 0x01, 0xF4 };
+    respond(rsp, sizeof rsp);
+}
+
+static void on_tester_present(const uint8_t *req, uint32_t len) {
+    if (len != 2u) { respond_nrc(SID_TESTER_PRESENT, NRC_LENGTH); return; }
+    if (req[1] & SUPPRESS_RESPONSE) return;
+
+    const uint8_t rsp[2] = { POSITIVE(SID_TESTER_PRESENT), 0x00 };
+    respond(rsp, sizeof rsp);
+}
+
+static void on_download(const uint8_t *req, uint32_t len) {
+    if (len != 11u || req[2] != DOWNLOAD_FORMAT) { respond_nrc(SID_DOWNLOAD, NRC_LENGTH); return; }
+    if (downloading || job_q[0] >= 0) { respond_nrc(SID_DOWNLOAD, NRC_CONDITIONS); return; }
+
+    uint32_t addr = rd32(&req[3]);
+    uint32_t size = rd32(&req[7]);
+    if (addr != BOOT_APP_BASE || size == 0u || size > BOOT_APP_MAX) {
+        respond_nrc(SID_DOWNLOAD, NRC_RANGE);
+        return;
+    }
+
+    /* The old image is invalid from now on: a broken download keeps the bootloader resident */
+    if (hal_flash_erase_sector(BOOT_DESC_ADDR) != 0) {
+        respond_nrc(SID_DOWNLOAD, NRC_PROGRAMMING);
+        return;
+    }
+
+    downloading = true;
+    flash_failed = false;
+    dl_size = size;
+    dl_offset = 0;
+    dl_seq = 1;
+    erased_end = BOOT_APP_BASE;
+    dl_start_us = hal_can_get_time_us();
+    stats = (BootStats_t){ .bytes = size };
+    erase_us = program_us = 0;
+
+    const uint8_t rsp[4] = { POSITIVE(SID_DOWNLOAD), 0x20,
+                             (uint8_t)(MSG_SIZE >> 8), (uint8_t)MSG_SIZE };
+    respond(rsp, sizeof rsp);
+}
+
+/**
+ * @brief TransferData: hands the buffer to the writer.
+ * @return true if the buffer now belongs to the writer.
+ */
+static bool on_transfer(int8_t b, uint32_t len) {
+    const uint8_t *req = msg_buf[b];
+
+    if (!downloading || exit_pending) { respond_nrc(SID_TRANSFER, NRC_SEQUENCE); return false; }
+    if (flash_failed) {
+        abort_download();
+        respond_nrc(SID_TRANSFER, NRC_PROGRAMMING);
+        return false;
+    }
+    if (len < 3u) { respond_nrc(SID_TRANSFER, NRC_LENGTH); return false; }
+    if (req[1] != dl_seq) { respond_nrc(SID_TRANSFER, NRC_BLOCK_SEQUENCE); return false; }
+
+    uint32_t n = len - 2u;
+    uint32_t expected = dl_size - dl_offset;
+    if (expected > BOOT_BLOCK_SIZE) expected = BOOT_BLOCK_SIZE;
+    if (n != expected) { respond_nrc(SID_TRANSFER, NRC_LENGTH); return false; }
+
+    /* The last block is programmed up to the next phrase boundary */
+    uint32_t padded = (n + HAL_FLASH_PHRASE_SIZE - 1u) & ~(HAL_FLASH_PHRASE_SIZE - 1u);
+    memset(&msg_buf[b][2u + n], HAL_FLASH_ERASED, padded - n);
+
+    buf_job[b] = (flash_job_t){ .addr = BOOT_APP_BASE + dl_offset, .len = padded, .done = 0 };
+    buf_state[b] = BUF_FLASH;
+    job_q[(job_q[0] < 0) ? 0 : 1] = b;
+
+    dl_offset += n;
+    ack_seq = dl_seq++;
+    ack_pending = true;         /* Answered by send_ack() */
+    return true;
+}
+
+static void on_exit(const uint8_t *req, uint32_t len) {
+    if (len != 5u) { respond_nrc(SID_EXIT, NRC_LENGTH); return; }
+    if (!downloading || exit_pending || dl_offset != dl_size) {
+        respond_nrc(SID_EXIT, NRC_SEQUENCE);
+        return;
+    }
+    exit_crc = rd32(&req[1]);
+    exit_pending = true;        /* Answered by finish_download() */
+}
+
+static void on_reset(const uint8_t *req, uint32_t len) {
+    if (len != 2u) { respond_nrc(SID_RESET, NRC_LENGTH); return; }
+    if ((req[1] & (uint8_t)~SUPPRESS_RESPONSE) != RESET_HARD) { respond_nrc(SID_RESET, NRC_SUBFUNCTION); return; }
+    if (downloading || !boot_app_valid()) { respond_nrc(SID_RESET, NRC_CONDITIONS); return; }
+
+    reset_pending = true;
+    if (req[1] & SUPPRESS_RESPONSE) return;
+    const uint8_t rsp[2] = { POSITIVE(SID_RESET), RESET_HARD };
+    respond(rsp, sizeof rsp);
+}
+
+/** @brief Dispatches a received request; the buffer is re-armed unless it went to the writer. */
+static void on_request(int8_t b, uint32_t len) {
+    const uint8_t *req = msg_buf[b];
+    bool kept = false;
+
+    switch (req[0]) {
+        case SID_SESSION:        on_session(req, len);        break;
+        case SID_TESTER_PRESENT: on_tester_present(req, len); break;
+        case SID_DOWNLOAD:       on_download(req, len);       break;
+        case SID_TRANSFER:       kept = on_transfer(b, len);  break;
+        case SID_EXIT:           on_exit(req, len);           break;
+        case SID_RESET:          on_reset(req, len);          break;
+        default:                 respond_nrc(req[0], NRC_SERVICE); break;
+    }
+
+    if (!kept) buf_state[b] = BUF_FREE;
+    rx_idx = -1;
+    arm_free_buffer();
+}
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+void boot_init(void) {
+    (void)hal_flash_init();
+    isotp_init(&boot_isotp_cfg);
+    buf_state[0] = buf_state[1] = BUF_FREE;
+    rx_idx = -1;
+    abort_download();
+    arm_free_buffer();
+}
+
+bool boot_app_valid(void) {
+    const BootDescriptor_t *desc = (const BootDescriptor_t *)hal_flash_ptr(BOOT_DESC_ADDR);
+
+    if (desc == NULL || desc->magic != BOOT_DESC_MAGIC) return false;
+    if (desc->size == 0u || desc->size > BOOT_APP_MAX) return false;
+    return boot_crc32(0u, hal_flash_ptr(BOOT_APP_BASE), desc->size) == desc->crc;
+}
+
+bool boot_entry_window(void) {
+    uint32_t t0 = hal_can_get_time_us();
+
+    while ((hal_can_get_time_us() - t0) < BOOT_ENTRY_WINDOW_MS * 1000u) {
+        boot_poll();
+        if (session_entered) return true;
+    }
+    return false;
+}
+
+void boot_poll(void) {
+    hal_can_frame_t f;
+    uint32_t len;
+
+    while (hal_can_receive_frame(&f) > 0) {
+        if (f.id == ISOTP_RX_ID) isotp_on_frame(&f);
+    }
+    isotp_poll();
+
+    if (rx_idx >= 0 && isotp_rx_get(&len) == 1) on_request(rx_idx, len);
+
+    flash_step();
+    finish_download();
+    arm_free_buffer();
+    send_ack();
+    send_response();
+
+    if (reset_pending && rsp_next_len == 0u && isotp_tx_result() != ISOTP_BUSY) {
+        hal_can_shutdown();
+        hal_boot_jump(BOOT_APP_BASE);
+    }
+}
+
+void boot_getStats(BootStats_t *out) {
+    *out = stats;
+    out->erase_ms = erase_us / 1000u;
+    out->program_ms = program_us / 1000u;
+}
+
+uint32_t boot_crc32(uint32_t crc, const uint8_t *data, uint32_t len) {
+    if (!crc_ready) {
+        for (uint32_t i = 0; i < 256u; i++) {
+            uint32_t c = i;
+            for (uint8_t k = 0; k < 8u; k++) c = (c & 1u) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            crc_table[i] = c;
+        }
+        crc_ready = true;
+    }
+
+    crc = ~crc;
+    while (len--) crc = crc_table[(crc ^ *data++) & 0xFFu] ^ (crc >> 8);
+    return ~crc;
+}
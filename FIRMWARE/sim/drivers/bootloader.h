@@ -0,0 +1,148 @@
+/**
+ * @file bootloader.h
+ * @brief Resident CAN bootloader: field update of the application image.
+ *
+ * @details
+ * The bootloader owns the first 16 KB of the P-Flash and never rewrites it. The
+ * application image is placed behind it (::BOOT_APP_BASE). The last sector
+ * holds the image descriptor (size and CRC-32), which is written only after
+ * the whole image has been programmed and verified. The sectors just below
+ * it hold data written by the application (the display layout, layout.h);
+ * a download does not touch them:
+ *
+ * | Address        | Content                                        |
+ * |----------------|------------------------------------------------|
+ * | `0x00000000`   | Bootloader (vectors, flash configuration, code) |
+ * | `0x00004000`   | Application slot (vectors first), 222 KB        |
+ * | `0x0003B800`   | Application data (::BOOT_DATA_ADDR), 16 KB      |
+ * | `0x0003F800`   | Image descriptor (::BootDescriptor_t)           |
+ *
+ * **Fallback**: an interrupted or failed download leaves the descriptor erased.
+ * The bootloader then stays resident and waits for a new download. A valid
+ * image is only started when its CRC matches. A second slot (A/B) does not
+ * fit: the image may use almost all of the 256 KB.
+ *
+ * **Protocol**: UDS services (ISO 14229 subset) carried by ISO-TP
+ * (drivers/isotp.c) on the tester IDs 0x7E4 / 0x7EC:
+ *
+ * | Request                        | Positive response   | Action                                      |
+ * |--------------------------------|---------------------|---------------------------------------------|
+ * | `10 02`                        | `50 02`             | Programming session (the application resets into the bootloader) |
+ * | `3E 00`                        | `7E 00`             | Tester present (answered by the bootloader only) |
+ * | `34 00 44 addr32 size32`       | `74 20 len16`       | Start a download at ::BOOT_APP_BASE; invalidates the image |
+ * | `36 seq data...`               | `76 seq`            | One block (::BOOT_BLOCK_SIZE bytes, the last one shorter) |
+ * | `37 crc32`                     | `77`                | Ends the download, checks the CRC, writes the descriptor |
+ * | `11 01`                        | `51 01`             | Reset: start the application if it is valid |
+ *
+ * Errors are answered with `7F sid nrc`.
+ *
+ * **Pipelining**: a TransferData block is acknowledged as soon as it is
+ * queued and the second buffer is armed. It is programmed a few phrases per
+ * ::boot_poll call while ISO-TP already receives the next block, and the
+ * sectors ahead are erased whenever the writer is idle. The CAN bus (about
+ * 27 kB/s of ISO-TP payload at 500 kbit/s) is therefore the only limit on the
+ * download time. Flash commands run from RAM and stash incoming frames
+ * (::hal_can_rx_stash), so reception goes on during an erase.
+ */
+
+#ifndef BOOTLOADER_H
+#define BOOTLOADER_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal_flash.h"
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define BOOT_APP_BASE      0x00004000u  /**< Application vector table (bootloader: 16 KB below). */
+#define BOOT_DESC_ADDR     (HAL_FLASH_SIZE - HAL_FLASH_SECTOR_SIZE)  /**< Image descriptor sector. */
+#define BOOT_DATA_SIZE     (8u * HAL_FLASH_SECTOR_SIZE)              /**< Application data (16 KB). */
+#define BOOT_DATA_ADDR     (BOOT_DESC_ADDR - BOOT_DATA_SIZE)         /**< Application data, kept across downloads. */
+#define BOOT_APP_MAX       (BOOT_DATA_ADDR - BOOT_APP_BASE)          /**< Largest image (222 KB). */
+
+#define BOOT_BLOCK_SIZE    HAL_FLASH_SECTOR_SIZE  /**< TransferData payload: one sector per block. */
+#define BOOT_DESC_MAGIC    0x50413146u  /**< "F1AP": descriptor written. */
+
+#define BOOT_ENTRY_WINDOW_MS  20u       /**< Time after reset in which `10 02` keeps a valid image from starting. */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Image descriptor, last sector of the flash (two phrases).
+ */
+typedef struct {
+    uint32_t magic;     /**< ::BOOT_DESC_MAGIC. */
+    uint32_t size;      /**< Image size in bytes, from ::BOOT_APP_BASE. */
+    uint32_t crc;       /**< CRC-32 (IEEE 802.3) of the image. */
+    uint32_t reserved;  /**< 0xFFFFFFFF. */
+} BootDescriptor_t;
+
+/**
+ * @brief Download counters (diagnostics).
+ */
+typedef struct {
+    uint32_t bytes;         /**< Bytes of the last (or current) download. */
+    uint32_t blocks;        /**< Blocks programmed. */
+    uint32_t elapsed_ms;    /**< RequestDownload to positive RequestTransferExit. */
+    uint32_t erase_ms;      /**< Time spent in sector erase commands. */
+    uint32_t program_ms;    /**< Time spent in program commands. */
+    uint8_t  last_nrc;      /**< Last negative response code sent (0: none). */
+} BootStats_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Initializes the flash and the ISO-TP link of the bootloader.
+ *
+ * @details
+ * CAN (filter on ::ISOTP_RX_ID) must be initialized before.
+ */
+void boot_init(void);
+
+/**
+ * @brief Checks the image in the application slot against its descriptor.
+ *
+ * @return bool true if the descriptor is written and the CRC of the image matches.
+ */
+bool boot_app_valid(void);
+
+/**
+ * @brief Waits ::BOOT_ENTRY_WINDOW_MS for a programming session request.
+ *
+ * @details
+ * Lets a tester take over a valid image that no longer accepts the request
+ * (for example because it crashes): it sends `10 02` while the wheel is
+ * powered up.
+ *
+ * @return bool true if a tester asked for the programming session.
+ */
+bool boot_entry_window(void);
+
+/**
+ * @brief Runs the bootloader: CAN reception, UDS services and one flash step.
+ *
+ * @details
+ * Call continuously. After a positive `11 01` response the application is
+ * started (::hal_boot_jump) if it is valid.
+ */
+void boot_poll(void);
+
+/**
+ * @brief Returns the download counters.
+ *
+ * @param[out] stats Destination structure.
+ */
+void boot_getStats(BootStats_t *stats);
+
+/**
+ * @brief CRC-32 (IEEE 802.3, reflected, as zlib and the flasher compute it).
+ *
+ * @param[in] crc  Previous value (0 for the first chunk).
+ * @param[in] data Bytes.
+ * @param[in] len  Byte count.
+ * @return uint32_t Updated CRC.
+ */
+uint32_t boot_crc32(uint32_t crc, const uint8_t *data, uint32_t len);
+
+#endif /* BOOTLOADER_H */
@@ -17,7 +17,7 @@
 
 
 #include "buttons.h"
-#include "hal_gpio.h"           
+#include "hal_gpio.h"
 #include <stddef.h>            /* For NULL */
 
 /*--------------------------PRIVATE VARIABLES-----------------------------------*/
@@ -32,6 +32,9 @@ static uint8_t rawState = 0;
 /** @brief Debounce counter for each button. */
 static uint8_t counter[NUM_BUTTONS] = {0}; 
 
+/** @brief Debounce threshold in use (::DEBOUNCE_COUNT unless changed at run time). */
+static uint8_t debounceCount = DEBOUNCE_COUNT;
+
 /** @brief Registered callback functions for each button. */
 static ButtonCallback_t buttonCallbacks[NUM_BUTTONS];
 
@@ -65,7 +68,7 @@ static void button_process(uint8_t id, uint8_t raw) {
         counter[id]++;
 
         // Check if the counter has reached the debounce threshold.
-        if (counter[id] >= DEBOUNCE_COUNT) {
+        if (counter[id] >= debounceCount) {
 
             /* The change is considered stable. Update the stableState*/
             if (bit_raw) {
@@ -123,9 +126,8 @@ void buttons_update() {
     // Read the current raw state of all buttons from the HAL.
     uint8_t raw = buttons_getRaw();
 
-    // Optional: Invert raw bits if buttons are wired in pull-up configuration
-    // (where pressed = low voltage = 0, released = high voltage = 1).
-    // raw = ~raw; // Uncomment this line if using pull-up resistors.
+    // The bits are active-high (1 = pressed) on every platform: the HAL
+    // inverts the pull-up inputs of the target (hal_gpio.h).
 
     // Iterate through each button (0 to NUM_BUTTONS-1).
     for (uint8_t i = 0; i < NUM_BUTTONS; i++) {
@@ -181,3 +183,9 @@ void buttons_registerCallback(uint8_t buttonId, ButtonCallback_t cb) {
         buttonCallbacks[buttonId] = cb;
     }
 }
+
+
+void buttons_setDebounce(uint8_t count) {
+    // A threshold of 0 would accept every glitch; 1 means no filtering.
+    debounceCount = (count == 0) ? 1 : count;
+}
@@ -36,10 +36,10 @@
  * Used for indexing callback arrays and bit positions in state bitmasks.
  */
 typedef enum {
-    BTN_1,          /**< Button 1. */
-    BTN_2,          /**< Button 2. */
-    BTN_3,          /**< Button 3. */
-    BTN_4,          /**< Button 4. */
+    BTN_1,          /**< Button 1 (UP), read from ::GPIO_BTN_1. */
+    BTN_2,          /**< Button 2 (DOWN), read from ::GPIO_BTN_2. */
+    BTN_3,          /**< Button 3 (DRS), read from ::GPIO_BTN_3. */
+    BTN_4,          /**< Button 4 (PIT LIMITER), read from ::GPIO_BTN_4. */
     NUM_BUTTONS     /**< Total number of buttons. */
 } ButtonId_t;
 
@@ -117,4 +117,14 @@ uint8_t buttons_getRaw(void);
  */
 void buttons_registerCallback(uint8_t buttonId, ButtonCallback_t callback);
 
+/**
+ * @brief Changes the debounce threshold at run time (calibration).
+ *
+ * @details
+ * Takes effect at the next ::buttons_update. The power-on value is ::DEBOUNCE_COUNT.
+ *
+ * @param[in] count Consecutive identical readings required (0 is treated as 1).
+ */
+void buttons_setDebounce(uint8_t count);
+
 #endif /* BUTTONS_H */
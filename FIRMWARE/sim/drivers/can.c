@@ -11,22 +11,177 @@
  */
 
 #include "can.h"
-#include "../hal/hal_can.h"
+#include "can_rx_mon.h"
+#include "xcp.h"
+#include "isotp.h"
+#include "steering_wheel_dbc.h"   /* Generated from steering_wheel.dbc */
+#include "hal_can.h"
+#include "hal_log.h"
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 
-/* --- CAN Message Identifiers (11-bit standard IDs) --- */
-#define CAN_ID_STEERING_STATUS  0x101   /**< Message ID for Steering Wheel status frames. */
-#define CAN_ID_ECU_STATUS       0x201   /**< Message ID for ECU status frames. */
+/* --- CAN Message Identifiers (11-bit standard IDs, from the DBC) --- */
+#define CAN_ID_STEERING_STATUS  DBC_STEERINGWHEEL_STATUS_ID   /**< Message ID for Steering Wheel status frames. */
+#define CAN_ID_ECU_STATUS       DBC_ECU_STATUS_DISPLAY_ID   /**< Message ID for ECU status frames. */
+
+/**
+ * @brief CAN interface opened by CAN_Init() (platform default: "vcan0" on the
+ * host, "can0" on the target).
+ *
+ * Override at build time (-DCAN_INTERFACE_NAME=...) or, on the host, at run
+ * time with the environment variable F1_CAN_IF (e.g. "vbus:default" for the
+ * user-space virtual bus that needs no vcan kernel module).
+ */
+#ifndef CAN_INTERFACE_NAME
+#define CAN_INTERFACE_NAME      HAL_CAN_DEFAULT_IF
+#endif
+
+/** Maximum frames drained per CAN_Poll() call (bounds the loop time on a saturated bus). */
+#define CAN_RX_BUDGET           64
+
+/**
+ * @brief Receive acceptance filters: one exact-ID entry per route of ::can_rx_routes.
+ *
+ * Built by CAN_Init() from the routes (IDs from the generated dbc_message_id()),
+ * so a new route is accepted without a second table to keep in step. The same
+ * table becomes FlexCAN RX mailbox masks on the target and CAN_RAW_FILTER
+ * entries on the host, so unrouted IDs never reach the driver, unless
+ * CAN_SetRxAcceptAll() opens the filters to count them.
+ */
+static hal_can_filter_t can_rx_filters[HAL_CAN_MAX_FILTERS];
+static uint8_t can_rx_filter_count = 0;
+
+/**
+ * @brief Receive timing contracts, indexed by ::RxMsgId_t.
+ *
+ * The ECU sends ECU_Status_Display every 50 ms and answers every wheel frame;
+ * after 500 ms without it the ECU values on screen are stale.
+ */
+static const RxMsgTiming_t can_rx_timing[RX_MSG_COUNT] = {
+    [RX_MSG_ECU_STATUS] = { .period_ms = 50, .timeout_ms = 500 },
+};
+
+/**
+ * @brief ISO-TP link parameters (tester <-> wheel bulk transfers).
+ *
+ * Blocks of 8 frames without separation time. FlexCAN has one receive mailbox
+ * per filter and a CF arrives every ~230 us, far faster than a slot: the
+ * target empties the mailboxes from the RX interrupt into a 64-frame queue
+ * (::hal_can_rx_stash), which is what keeps a block from overrunning 0x7E4.
+ * The block size only bounds how far the tester runs ahead of isotp_poll().
+ */
+static const IsoTpConfig_t can_isotp_cfg = {
+    .block_size = 8,
+    .st_min     = 0,
+    .wft_max    = 8,
+    .padding    = 0xCC,
+    .n_bs_ms    = 1000,
+    .n_cr_ms    = 1000,
+};
+
+/** @brief Receive decoder: unpacks one message into its signal store. */
+typedef void (*can_rx_decoder_t)(const hal_can_frame_t *frame);
+
+/** @brief Receive route of one DBC message. */
+typedef struct {
+    can_rx_decoder_t decoder;   /**< NULL: message not consumed by this node. */
+    uint8_t          dlc;       /**< Minimum payload length (DBC DLC). */
+} can_rx_route_t;
+
+static void decode_ecu_status(const hal_can_frame_t *frame);
+static void route_xcp_cro(const hal_can_frame_t *frame);
+
+/**
+ * @brief Receive routing, indexed by the DBC message index (`DBC_<MSG>_IDX`).
+ *
+ * Registration is compile-time: adding a received message means adding it to
+ * the DBC, regenerating steering_wheel_dbc.h and adding one line here.
+ */
+static const can_rx_route_t can_rx_routes[DBC_MESSAGE_COUNT] = {
+    [DBC_ECU_STATUS_DISPLAY_IDX] = { decode_ecu_status, DBC_ECU_STATUS_DISPLAY_DLC },
+    [DBC_XCP_CRO_IDX]            = { route_xcp_cro, 1 },   /* XCP commands are 1..8 bytes */
+    [DBC_ISOTP_REQ_IDX]          = { isotp_on_frame, 1 },  /* ISO-TP frames are 1..8 bytes */
+};
+
+/* --- Signal store: latest decoded value of every received message --- */
+static ECUStatus_t ecu_latest;          /**< Latest ECU_Status_Display. */
+static bool ecu_updated = false;        /**< ecu_latest changed since the last CAN_GetECUStatus(). */
+
+/** Dispatch counters (unknown / ignored / truncated frames). */
+static CanDispatchStats_t dispatch_stats;
+
+
+/**
+ * @brief Fills ::can_rx_filters from the routes.
+ * @return false if the routes outnumber the filters (::HAL_CAN_MAX_FILTERS).
+ */
+static bool can_build_filters(void) {
+    can_rx_filter_count = 0;
+    for (uint8_t idx = 0; idx < DBC_MESSAGE_COUNT; idx++) {
+        if (can_rx_routes[idx].decoder == NULL) continue;
+        if (can_rx_filter_count >= HAL_CAN_MAX_FILTERS) return false;
+        can_rx_filters[can_rx_filter_count].id   = dbc_message_id(idx);
+        can_rx_filters[can_rx_filter_count].mask = HAL_CAN_STD_MASK;
+        can_rx_filter_count++;
+    }
+    return true;
+}
+
+
+/**
+ * @brief Decodes ECU_Status_Display (0x201) into the signal store.
+ */
+static void decode_ecu_status(const hal_can_frame_t *frame) {
+    dbc_ECU_Status_Display_t m;
+    dbc_unpack_ECU_Status_Display(&m, frame->data);
+
+    /* Apply scaling factor and offset according to DBC */
+    ecu_latest.temp1 = m.Temp1 * DBC_ECU_STATUS_DISPLAY_TEMP1_FACTOR + DBC_ECU_STATUS_DISPLAY_TEMP1_OFFSET;
+    ecu_latest.temp2 = m.Temp2 * DBC_ECU_STATUS_DISPLAY_TEMP2_FACTOR + DBC_ECU_STATUS_DISPLAY_TEMP2_OFFSET;
+
+    /* Digital status flags and feedback signals */
+    ecu_latest.pit_limiter_active = m.PitLimiter_Active;
+    ecu_latest.drs_status         = m.DRS_Status;
+    ecu_latest.led_pit            = m.LED2_PitLimiter;
+    ecu_latest.led_temp           = m.LED1_Temperature;
+    ecu_latest.gear_actual        = m.Gear_Actual;
+    ecu_latest.clutch_feedback    = m.Clutch_Feedback;
+    ecu_latest.rotary_feedback    = m.Rotary_Feedback;
+    ecu_latest.rx_timestamp_us    = frame->timestamp_us;
+    ecu_updated = true;
+
+    can_rx_mon_notify(RX_MSG_ECU_STATUS, frame->timestamp_us);
+}
+
+
+/**
+ * @brief Hands an XCP command (0x7E0) to the XCP slave, which answers on 0x7E1.
+ */
+static void route_xcp_cro(const hal_can_frame_t *frame) {
+    xcp_rx(frame->data, frame->len);
+}
 
 
 void CAN_Init(void) {
-    /* Initialize CAN channel through the HAL layer (VCAN0). */
-    hal_can_init("vcan0");
+    /* Initialize CAN channel through the HAL layer (HAL_CAN_DEFAULT_IF by default). */
+    hal_can_init(CAN_INTERFACE_NAME);
+    if (can_build_filters()) {
+        hal_can_set_filters(can_rx_filters, can_rx_filter_count);
+    } else {
+        HAL_LOG("[CAN] %u routes > %u filters: accepting every ID\r\n",
+                (unsigned)can_rx_filter_count, (unsigned)HAL_CAN_MAX_FILTERS);
+        can_rx_filter_count = 0;
+        hal_can_set_filters(NULL, 0);
+        dispatch_stats.accept_all = true;
+    }
+    can_rx_mon_init(can_rx_timing);
+    isotp_init(&can_isotp_cfg);
+    HAL_LOG("[CAN] INIT DONE\r\n");
 }
 
 
-void CAN_SendSteeringStatus(const SteeringWheelStatus_t *status) {
+int CAN_SendSteeringStatus(const SteeringWheelStatus_t *status) {
     uint8_t payload[8] = {0};
 
     /* Encode the steering wheel data into payload bytes */
@@ -35,44 +190,100 @@ void CAN_SendSteeringStatus(const SteeringWheelStatus_t *status) {
     payload[2] = status->clutch_value;             // Byte 2: clutch percentage (0–100%)
 
     // Remaining bytes are reserved and remain 0
-    hal_can_send(CAN_ID_STEERING_STATUS, payload, 8);
+    return hal_can_send(CAN_ID_STEERING_STATUS, payload, 8);
 }
 
 
-int CAN_ReceiveECUStatus(ECUStatus_t *ecu_status) {
-    uint8_t data[8];
-    uint8_t len;
-    uint32_t id;
-
-    int ret = hal_can_receive(&id, data, &len);
+/**
+ * @brief Routes one frame to its decoder in constant time (perfect hash on the ID).
+ */
+static void can_dispatch(const hal_can_frame_t *frame) {
+    uint8_t idx = dbc_message_index(frame->id);
 
-    if (ret <= 0) return ret; /* 0 = no data available */
+    if (idx == DBC_NO_MESSAGE) {
+        dispatch_stats.unknown++;
+        for (uint8_t i = 0; i < dispatch_stats.unknown_ids; i++) {
+            if (dispatch_stats.unknown_tab[i].id == frame->id) {
+                dispatch_stats.unknown_tab[i].count++;
+                return;
+            }
+        }
+        if (dispatch_stats.unknown_ids < CAN_UNKNOWN_TRACK) {
+            dispatch_stats.unknown_tab[dispatch_stats.unknown_ids].id = frame->id;
+            dispatch_stats.unknown_tab[dispatch_stats.unknown_ids].count = 1;
+            dispatch_stats.unknown_ids++;
+        }
+        return;
+    }
 
-    if (ret > 0) {
-        printf("RX Frame: ID=0x%03X, DLC=%d\n", id, len);
+    if (can_rx_routes[idx].decoder == NULL) {
+        dispatch_stats.ignored++;           /* In the DBC, but not for us (e.g. our own TX messages) */
+        return;
+    }
+    if (frame->len < can_rx_routes[idx].dlc) {
+        dispatch_stats.bad_dlc++;           /* Truncated payload: do not decode garbage */
+        return;
     }
-    
-    /* Mask off EFF/RTR/ERR bits and check for the expected ID */
-    if ((id & 0x1FFFFFFF) == CAN_ID_ECU_STATUS) { 
-        
-        /* Decode temperature values (int16, big-endian format) (For little endian chage position)*/
-        int16_t raw1 = (data[1] << 8) | data[0];
-        int16_t raw2 = (data[3] << 8) | data[2];
-
-        // Apply scaling factor and offset according to DBC
-        ecu_status->temp1 = (raw1 * 0.1f) - 40.0f;
-        ecu_status->temp2 = (raw2 * 0.1f) - 40.0f;
-
-        /* Decode digital status flags and feedback signals */
-        ecu_status->pit_limiter_active = (data[4] >> 0) & 0x01;
-        ecu_status->drs_status         = (data[4] >> 1) & 0x01;
-        ecu_status->led_pit            = (data[4] >> 6) & 0x01;
-        ecu_status->led_temp           = (data[4] >> 7) & 0x01;
-        ecu_status->gear_actual        = data[5];
-        ecu_status->clutch_feedback    = data[6];
-        ecu_status->rotary_feedback    = (data[7] & 0x0F);
-
-        return 1; // Successfully decoded
+
+    dispatch_stats.dispatched++;
+    can_rx_routes[idx].decoder(frame);
+}
+
+
+int CAN_Poll(void) {
+    hal_can_frame_t frame;
+    int n;
+
+    /* Drain everything pending (bounded) and route each frame to its decoder */
+    for (n = 0; n < CAN_RX_BUDGET; n++) {
+        int ret = hal_can_receive_frame(&frame);
+        if (ret < 0) return ret;
+        if (ret == 0) break; /* 0 = no more data available */
+
+#ifdef CAN_DEBUG_RX
+        HAL_LOG("RX Frame: ID=0x%03X, DLC=%d, t=%u us\n", frame.id, frame.len, frame.timestamp_us);
+#endif
+
+        can_dispatch(&frame);
     }
-    return 0; // No valid frame received
+
+    /* Transport timers and pending ISO-TP consecutive frames */
+    isotp_poll();
+    return n;
+}
+
+
+int CAN_GetECUStatus(ECUStatus_t *ecu_status) {
+    if (!ecu_updated) return 0;
+
+    *ecu_status = ecu_latest;
+    ecu_updated = false;
+    return 1;
+}
+
+
+int CAN_ReceiveECUStatus(ECUStatus_t *ecu_status) {
+    int ret = CAN_Poll();
+    if (ret < 0) return ret;
+    return CAN_GetECUStatus(ecu_status);
+}
+
+
+void CAN_GetDispatchStats(CanDispatchStats_t *stats) {
+    if (stats != NULL) *stats = dispatch_stats;
+}
+
+
+int CAN_SetRxAcceptAll(bool accept_all) {
+    if (!accept_all && can_rx_filter_count == 0) return -1;     /* Routes did not fit: stays open */
+
+    int ret = accept_all ? hal_can_set_filters(NULL, 0)
+                         : hal_can_set_filters(can_rx_filters, can_rx_filter_count);
+    if (ret == 0) dispatch_stats.accept_all = accept_all;
+    return ret;
+}
+
+
+void CAN_UpdateRxSupervision(void) {
+    can_rx_mon_update(hal_can_get_time_us());
 }
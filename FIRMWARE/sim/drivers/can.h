@@ -55,14 +55,42 @@ typedef struct {
     uint8_t gear_actual;        /**< Current gear value. */
     uint8_t clutch_feedback;    /**< Clutch feedback percentage (0–100%). */
     uint8_t rotary_feedback;    /**< Rotary switch feedback position (0–15). */
+    uint32_t rx_timestamp_us;   /**< Bus arrival time of the frame (µs, hal_can_get_time_us() timebase). */
 } ECUStatus_t;
 
+/** Distinct unknown IDs tracked individually by ::CanDispatchStats_t. */
+#define CAN_UNKNOWN_TRACK  8
+
+/**
+ * @brief Receive dispatch counters.
+ *
+ * @details
+ * Frames are routed by CAN ID through a perfect hash generated from the DBC
+ * (see steering_wheel_dbc.h). Frames that do not reach a decoder are counted
+ * here instead of being dropped silently. The acceptance filters only pass
+ * routed IDs, so `ignored` and `unknown` count only while the filters are
+ * open (::CAN_SetRxAcceptAll); `bad_dlc` counts in both modes.
+ */
+typedef struct {
+    bool     accept_all;        /**< Filters open (every ID reaches the dispatch). */
+    uint32_t dispatched;        /**< Frames routed to a decoder. */
+    uint32_t ignored;           /**< IDs in the DBC that this node does not consume (e.g. its own TX messages). */
+    uint32_t bad_dlc;           /**< Frames shorter than the DBC DLC (not decoded). */
+    uint32_t unknown;           /**< Frames whose ID is not in the DBC. */
+    uint8_t  unknown_ids;       /**< Entries used in unknown_tab. */
+    struct {
+        uint32_t id;            /**< Unknown CAN ID. */
+        uint32_t count;         /**< Frames received with this ID. */
+    } unknown_tab[CAN_UNKNOWN_TRACK];   /**< First distinct unknown IDs (later ones only count in `unknown`). */
+} CanDispatchStats_t;
+
 /**
  * @brief Initializes the CAN communication interface.
  *
  * @details
  * Configures the CAN channel by invoking the HAL initialization routine.
- * On PC simulation, this may connect to a virtual CAN interface (e.g., `vcan0`).
+ * On PC simulation, this may connect to a virtual CAN interface (e.g., `vcan0`)
+ * or, when `F1_CAN_IF=vbus:<name>` is set, to the user-space virtual bus.
  */
 void CAN_Init(void);
 
@@ -74,19 +102,76 @@ void CAN_Init(void);
  * and transmits it using a predefined message ID.
  *
  * @param[in] status Pointer to a ::SteeringWheelStatus_t structure containing the data to send.
+ * @return int 0 if the frame was queued for transmission, negative if refused
+ *         (all TX mailboxes busy, interface error): see ::hal_can_send.
+ */
+int  CAN_SendSteeringStatus(const SteeringWheelStatus_t *status);
+
+/**
+ * @brief Drains the receive path and dispatches every frame to its decoder.
+ *
+ * @details
+ * Processes all pending frames (up to a fixed budget per call). Each frame is
+ * routed by ID in constant time to the decoder of its message, which updates
+ * the latest decoded value (read it with the `CAN_Get...` functions) and the
+ * receive supervision. Then services the ISO-TP transport (timeouts, next
+ * burst of consecutive frames). Call at least once per main-loop slot; call it
+ * repeatedly in the idle part of the slot to run bulk transfers at bus speed.
+ *
+ * @return int Frames processed, negative on receive error.
+ */
+int  CAN_Poll(void);
+
+/**
+ * @brief Returns the latest decoded ECU status message.
+ *
+ * @param[out] ecu_status Destination, written only when a new message arrived.
+ * @return int 1 if a new ECU_Status_Display was decoded since the previous call, 0 otherwise.
  */
-void CAN_SendSteeringStatus(const SteeringWheelStatus_t *status);
+int  CAN_GetECUStatus(ECUStatus_t *ecu_status);
 
 /**
  * @brief Receives and decodes ECU status messages from the CAN bus.
  *
  * @details
- * Checks for new incoming frames, validates their ID and payload length,
- * and decodes ECU-related data according to the DBC format.
+ * Convenience wrapper: ::CAN_Poll followed by ::CAN_GetECUStatus. When several
+ * ECU frames are pending, the most recent one is kept.
  *
  * @param[out] ecu_status Pointer to a ::ECUStatus_t structure where decoded data will be stored.
  * @return int Returns 1 if a valid ECU message was received and decoded, 0 otherwise.
  */
 int  CAN_ReceiveECUStatus(ECUStatus_t *ecu_status);
 
+/**
+ * @brief Returns the receive dispatch counters (unknown IDs, truncated frames).
+ *
+ * @param[out] stats Destination structure.
+ */
+void CAN_GetDispatchStats(CanDispatchStats_t *stats);
+
+/**
+ * @brief Opens the acceptance filters to every ID, or restores the routed IDs.
+ *
+ * @details
+ * Diagnostic mode: with the filters open, frames of the DBC that this node
+ * does not consume and IDs outside the DBC reach the dispatch and are counted
+ * (::CanDispatchStats_t). The routed messages are decoded in both modes. On
+ * FlexCAN all IDs then share one RX mailbox, so keep it for bus surveys, not
+ * for bulk transfers.
+ *
+ * @param[in] accept_all true: accept every ID; false: routed IDs only.
+ * @return int 0 on success, negative if the filters could not be changed.
+ */
+int  CAN_SetRxAcceptAll(bool accept_all);
+
+/**
+ * @brief Evaluates the receive timeouts (stale flags) of every supervised message.
+ *
+ * @details
+ * Call once per main-loop slot, after the receive functions. Ages are measured
+ * in the HAL receive timebase; read the result with `can_rx_mon_isStale()` /
+ * `can_rx_mon_getStatus()` (see can_rx_mon.h).
+ */
+void CAN_UpdateRxSupervision(void);
+
 #endif /* CAN_H */
\ No newline at end of file
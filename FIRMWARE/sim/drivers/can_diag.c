@@ -0,0 +1,102 @@
+/**
+ * @file can_diag.c
+ * @brief Implementation of the CAN controller diagnostics.
+ *
+ * @details
+ * Every slot takes a ::hal_can_stats_t sample (this keeps the HAL bus timebase
+ * continuous and catches short-lived error states). At the end of the window
+ * the bit and frame counters are differenced against the sample taken at the
+ * start of the window.
+ */
+
+#include "can_diag.h"
+#include <stddef.h>            /* For NULL */
+#include <string.h>
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+/** @brief Latest HAL sample. */
+static hal_can_stats_t sample;
+
+/** @brief HAL sample taken when the current window was opened. */
+static hal_can_stats_t window_start;
+
+/** @brief Time the current window was opened. */
+static uint32_t window_start_ms = 0;
+
+/** @brief Published snapshot. */
+static CanDiag_t diag;
+
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+/** @brief Saturates a counter to 16 bits for the diagnostic frame. */
+static uint16_t sat16(uint32_t v) {
+    return (v > 0xFFFFu) ? 0xFFFFu : (uint16_t)v;
+}
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void can_diag_init(uint32_t now_ms) {
+    memset(&diag, 0, sizeof(diag));
+    memset(&sample, 0, sizeof(sample));
+    hal_can_get_stats(&sample);
+    window_start = sample;
+    window_start_ms = now_ms;
+    diag.err_state = sample.err_state;
+}
+
+bool can_diag_update(uint32_t now_ms) {
+    if (hal_can_get_stats(&sample) < 0) return false;
+
+    if (sample.err_state != diag.err_state) diag.state_changes++;
+    diag.tx_err_count   = sample.tx_err_count;
+    diag.rx_err_count   = sample.rx_err_count;
+    diag.err_state      = sample.err_state;
+    diag.bus_off_events = sample.bus_off_events;
+    diag.rx_overruns    = sample.rx_overruns;
+    diag.rx_errors      = sample.rx_errors;
+    diag.tx_retries     = sample.tx_retries;
+    diag.tx_dropped     = sample.tx_dropped;
+
+    if ((now_ms - window_start_ms) < CAN_DIAG_WINDOW_MS) return false;
+
+    /* Wrap-safe differences over the window */
+    uint32_t bits     = (sample.rx_bits - window_start.rx_bits) + (sample.tx_bits - window_start.tx_bits);
+    uint32_t bit_time = sample.bit_time - window_start.bit_time;
+    uint32_t permille = (bit_time > 0u) ? (uint32_t)(((uint64_t)bits * 1000u) / bit_time) : 0u;
+    if (permille > 1000u) permille = 1000u;    /* Worst-case stuffing can exceed the real bit count */
+
+    diag.load_permille = (uint16_t)permille;
+    if (diag.load_permille > diag.load_peak_permille) diag.load_peak_permille = diag.load_permille;
+    diag.rx_frames = sample.rx_frames - window_start.rx_frames;
+    diag.tx_frames = sample.tx_frames - window_start.tx_frames;
+
+    window_start = sample;
+    window_start_ms = now_ms;
+    return true;
+}
+
+void can_diag_get(CanDiag_t *out) {
+    if (out != NULL) *out = diag;
+}
+
+int can_diag_send(void) {
+    uint8_t payload[8];
+    uint8_t bus_off = (diag.bus_off_events > 63u) ? 63u : (uint8_t)diag.bus_off_events;
+    uint16_t overruns = sat16(diag.rx_overruns);
+    uint16_t retries  = sat16(diag.tx_retries);
+
+    /* SteeringWheel_CanDiag, Intel byte order (see steering_wheel.dbc) */
+    payload[0] = diag.tx_err_count;                                 /* TEC */
+    payload[1] = diag.rx_err_count;                                 /* REC */
+    payload[2] = (uint8_t)((diag.err_state & 0x03u) | (bus_off << 2)); /* ErrState | BusOffCount */
+    payload[3] = (uint8_t)(diag.load_permille / 5u);               /* BusLoad, 0.5 % per bit */
+    payload[4] = (uint8_t)(overruns & 0xFFu);                       /* RxOverruns */
+    payload[5] = (uint8_t)(overruns >> 8);
+    payload[6] = (uint8_t)(retries & 0xFFu);                        /* TxRetries */
+    payload[7] = (uint8_t)(retries >> 8);
+
+    return hal_can_send(CAN_DIAG_ID, payload, 8);
+}
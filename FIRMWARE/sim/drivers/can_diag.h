@@ -0,0 +1,96 @@
+/**
+ * @file can_diag.h
+ * @brief CAN controller diagnostics: error counters, fault confinement state and bus load.
+ *
+ * @details
+ * Samples the HAL health counters (::hal_can_get_stats) once per main-loop slot
+ * and aggregates them over a fixed window (::CAN_DIAG_WINDOW_MS):
+ *
+ * - **Error counters / state**: TEC, REC, error active / passive / bus off, and
+ *   the number of state changes (a flapping node shows up here even if it
+ *   recovers before the next print).
+ * - **Losses**: RX overruns, receive protocol errors, TX retries, frames dropped
+ *   because the transmit path was full, bus-off events.
+ * - **Bus load**: worst-case bits of the frames observed by this node (received
+ *   after acceptance filtering + transmitted) divided by the bus time elapsed in
+ *   the window, measured in bit times with the FlexCAN TIMER (CLOCK_MONOTONIC
+ *   on the host). Frames rejected by the acceptance filters are not observed,
+ *   so the value is a lower bound of the real bus load.
+ *
+ * At the end of every window the caller is told to publish the results: the
+ * `SteeringWheel_CanDiag` frame (::can_diag_send) and the debug UART.
+ */
+
+#ifndef CAN_DIAG_H
+#define CAN_DIAG_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal_can.h"
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define CAN_DIAG_WINDOW_MS   1000u   /**< Aggregation window and diagnostic frame period (ms). */
+#define CAN_DIAG_ID          0x301u  /**< SteeringWheel_CanDiag message ID (see steering_wheel.dbc). */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Diagnostics snapshot (counters are totals since ::can_diag_init).
+ */
+typedef struct {
+    uint8_t  tx_err_count;      /**< Transmit error counter (TEC). */
+    uint8_t  rx_err_count;      /**< Receive error counter (REC). */
+    uint8_t  err_state;         /**< Fault confinement state (::hal_can_err_state_t). */
+    uint16_t load_permille;     /**< Observed bus load in the last window (0.1 % units). */
+    uint16_t load_peak_permille;/**< Highest window load seen (0.1 % units). */
+    uint32_t state_changes;     /**< Fault confinement state transitions. */
+    uint32_t bus_off_events;    /**< Transitions to bus off. */
+    uint32_t rx_overruns;       /**< Frames lost before being read. */
+    uint32_t rx_errors;         /**< Receive protocol errors. */
+    uint32_t tx_retries;        /**< Transmissions repeated after an error / lost arbitration. */
+    uint32_t tx_dropped;        /**< Frames refused by a full transmit path. */
+    uint32_t rx_frames;         /**< Frames received in the last window. */
+    uint32_t tx_frames;         /**< Frames transmitted in the last window. */
+} CanDiag_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Resets the diagnostics and opens the first window.
+ *
+ * @details
+ * Must be called after `CAN_Init()`.
+ *
+ * @param[in] now_ms Current time in milliseconds.
+ */
+void can_diag_init(uint32_t now_ms);
+
+/**
+ * @brief Samples the controller; closes the window when it has elapsed.
+ *
+ * @details
+ * Call once per main-loop slot. A longer gap (a page switch) only widens the
+ * window: the HAL recovers the FlexCAN TIMER wraps from ::hal_time_us.
+ *
+ * @param[in] now_ms Current time in milliseconds.
+ * @return bool True when a window was closed (new load value, time to publish).
+ */
+bool can_diag_update(uint32_t now_ms);
+
+/**
+ * @brief Returns the latest diagnostics snapshot.
+ *
+ * @param[out] diag Destination structure.
+ */
+void can_diag_get(CanDiag_t *diag);
+
+/**
+ * @brief Transmits the `SteeringWheel_CanDiag` frame with the latest snapshot.
+ *
+ * @return int 0 on success, negative if the frame could not be queued.
+ */
+int can_diag_send(void);
+
+#endif /* CAN_DIAG_H */
@@ -0,0 +1,75 @@
+/**
+ * @file can_rx_mon.c
+ * @brief Implementation of the receive supervision.
+ *
+ * @details
+ * Intervals are computed between consecutive receive timestamps, so they
+ * reflect the sender and the bus, not how often the driver is polled.
+ */
+
+#include "can_rx_mon.h"
+#include <stddef.h>            /* For NULL */
+#include <string.h>
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+/** @brief Timing contract of each message. */
+static RxMsgTiming_t timing_cfg[RX_MSG_COUNT];
+
+/** @brief Supervision state of each message. */
+static RxMsgStatus_t status_tab[RX_MSG_COUNT];
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void can_rx_mon_init(const RxMsgTiming_t timing[RX_MSG_COUNT]) {
+    memcpy(timing_cfg, timing, sizeof(timing_cfg));
+    memset(status_tab, 0, sizeof(status_tab));
+    for (uint8_t i = 0; i < RX_MSG_COUNT; i++) {
+        status_tab[i].stale = true;
+        status_tab[i].itv_min_us = UINT32_MAX;
+    }
+}
+
+void can_rx_mon_notify(RxMsgId_t msg, uint32_t timestamp_us) {
+    if (msg >= RX_MSG_COUNT) return;
+    RxMsgStatus_t *st = &status_tab[msg];
+
+    if (st->frames > 0u) {
+        uint32_t itv = timestamp_us - st->last_rx_us;   /* Wrap-safe interval */
+        uint32_t period_us = timing_cfg[msg].period_ms * 1000u;
+        uint32_t jitter = (itv > period_us) ? (itv - period_us) : (period_us - itv);
+
+        if (itv < st->itv_min_us) st->itv_min_us = itv;
+        if (itv > st->itv_max_us) st->itv_max_us = itv;
+        if (jitter > st->jitter_max_us) st->jitter_max_us = jitter;
+        st->itv_avg_us = (st->frames == 1u) ? itv
+                       : st->itv_avg_us - (st->itv_avg_us >> 3) + (itv >> 3);
+    }
+
+    st->last_rx_us = timestamp_us;
+    st->age_us = 0;
+    st->stale = false;
+    st->frames++;
+}
+
+void can_rx_mon_update(uint32_t now_us) {
+    for (uint8_t i = 0; i < RX_MSG_COUNT; i++) {
+        RxMsgStatus_t *st = &status_tab[i];
+        if (st->frames == 0u) continue;            /* Never received: stays stale */
+
+        st->age_us = now_us - st->last_rx_us;
+        if ((int32_t)st->age_us < 0) st->age_us = 0;  /* Stamp a few µs ahead (host clock conversion) */
+        bool stale = st->age_us > timing_cfg[i].timeout_ms * 1000u;
+        if (stale && !st->stale) st->timeouts++;
+        st->stale = stale;
+    }
+}
+
+bool can_rx_mon_isStale(RxMsgId_t msg) {
+    return (msg < RX_MSG_COUNT) ? status_tab[msg].stale : true;
+}
+
+void can_rx_mon_getStatus(RxMsgId_t msg, RxMsgStatus_t *status) {
+    if (status != NULL && msg < RX_MSG_COUNT) *status = status_tab[msg];
+}
@@ -0,0 +1,98 @@
+/**
+ * @file can_rx_mon.h
+ * @brief Receive supervision: per-message age, timeout (stale) flags and period jitter.
+ *
+ * @details
+ * Every received message type has an expected period and a timeout. The CAN
+ * driver reports each decoded frame with its HAL receive timestamp
+ * (::can_rx_mon_notify); the application evaluates the timeouts once per slot
+ * (::can_rx_mon_update) and reads the stale flag of the messages whose signals
+ * it displays.
+ *
+ * All times are in the HAL receive timebase (::hal_can_get_time_us): the
+ * measured intervals are bus arrival intervals, free of the main-loop latency
+ * (up to one 16 ms slot) that an application-side timestamp would add.
+ *
+ * A message is stale until its first frame arrives.
+ */
+
+#ifndef CAN_RX_MON_H
+#define CAN_RX_MON_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------ENUMERATIONS-----------------------------------*/
+
+/**
+ * @brief Supervised receive messages.
+ */
+typedef enum {
+    RX_MSG_ECU_STATUS,  /**< ECU_Status_Display (0x201). */
+    RX_MSG_COUNT        /**< Number of supervised messages. */
+} RxMsgId_t;
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Timing contract of one message.
+ */
+typedef struct {
+    uint32_t period_ms;         /**< Nominal transmit period (reference for the jitter). */
+    uint32_t timeout_ms;        /**< Age after which the message and its signals are stale. */
+} RxMsgTiming_t;
+
+/**
+ * @brief Supervision state and timing statistics of one message.
+ */
+typedef struct {
+    bool     stale;             /**< No frame within the timeout (or never received). */
+    uint32_t last_rx_us;        /**< Receive timestamp of the latest frame. */
+    uint32_t age_us;            /**< Age of the latest frame at the last update. */
+    uint32_t frames;            /**< Frames received. */
+    uint32_t timeouts;          /**< Fresh -> stale transitions. */
+    uint32_t itv_min_us;        /**< Shortest interval between two frames. */
+    uint32_t itv_max_us;        /**< Longest interval between two frames. */
+    uint32_t itv_avg_us;        /**< Average interval (exponential, 1/8 weight). */
+    uint32_t jitter_max_us;     /**< Largest |interval - period| seen. */
+} RxMsgStatus_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Initializes the supervision; every message starts stale.
+ *
+ * @param[in] timing Array of ::RX_MSG_COUNT timing contracts, indexed by ::RxMsgId_t.
+ */
+void can_rx_mon_init(const RxMsgTiming_t timing[RX_MSG_COUNT]);
+
+/**
+ * @brief Records the arrival of a frame.
+ *
+ * @param[in] msg          Message identifier.
+ * @param[in] timestamp_us HAL receive timestamp of the frame.
+ */
+void can_rx_mon_notify(RxMsgId_t msg, uint32_t timestamp_us);
+
+/**
+ * @brief Evaluates the timeouts of all messages.
+ *
+ * @param[in] now_us Current time, ::hal_can_get_time_us timebase.
+ */
+void can_rx_mon_update(uint32_t now_us);
+
+/**
+ * @brief Returns true if the message (and every signal it carries) is stale.
+ */
+bool can_rx_mon_isStale(RxMsgId_t msg);
+
+/**
+ * @brief Returns the supervision state of a message.
+ *
+ * @param[in]  msg    Message identifier.
+ * @param[out] status Destination structure.
+ */
+void can_rx_mon_getStatus(RxMsgId_t msg, RxMsgStatus_t *status);
+
+#endif /* CAN_RX_MON_H */
@@ -0,0 +1,129 @@
+/**
+ * @file can_tx_sched.c
+ * @brief Implementation of the per-signal CAN transmit scheduler.
+ *
+ * @details
+ * Each slot (call to ::can_tx_sched_poll) compares the latest value of every
+ * signal with the value carried by the last frame and applies its policy.
+ * If any signal requests a frame, a single frame is requested for all of them
+ * (coalescing); the reference values move when ::can_tx_sched_commit reports
+ * that the frame was accepted.
+ */
+
+#include "can_tx_sched.h"
+#include <stddef.h>            /* For NULL */
+#include <string.h>
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+/** @brief Policy of each signal. */
+static TxPolicy_t policy[TX_SIG_COUNT];
+
+/** @brief Latest value of each signal. */
+static int32_t value_now[TX_SIG_COUNT];
+
+/** @brief Value carried by the last frame sent. */
+static int32_t value_sent[TX_SIG_COUNT];
+
+/** @brief Values of the frame requested by the last poll (the reference once committed). */
+static int32_t value_due[TX_SIG_COUNT];
+
+/** @brief Reasons of the frame requested by the last poll, 0 if none is waiting for its commit. */
+static uint8_t due_reasons = 0;
+
+/** @brief Signals that asked for the due frame (coalescing counter). */
+static uint8_t due_requesting = 0;
+
+/** @brief Time of the last frame sent. */
+static uint32_t last_tx_ms = 0;
+
+/** @brief True until the first frame has been sent. */
+static bool first_frame = true;
+
+/** @brief Diagnostics counters. */
+static TxSchedStats_t stats;
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void can_tx_sched_init(const TxPolicy_t policies[TX_SIG_COUNT]) {
+    memcpy(policy, policies, sizeof(policy));
+    memset(value_now, 0, sizeof(value_now));
+    memset(value_sent, 0, sizeof(value_sent));
+    memset(&stats, 0, sizeof(stats));
+    due_reasons = 0;
+    due_requesting = 0;
+    last_tx_ms = 0;
+    first_frame = true;
+}
+
+void can_tx_sched_setPolicy(TxSignalId_t sig, const TxPolicy_t *new_policy) {
+    if (sig < TX_SIG_COUNT && new_policy != NULL) policy[sig] = *new_policy;
+}
+
+void can_tx_sched_update(TxSignalId_t sig, int32_t value) {
+    if (sig < TX_SIG_COUNT) value_now[sig] = value;
+}
+
+uint8_t can_tx_sched_poll(uint32_t now_ms) {
+    uint32_t since = now_ms - last_tx_ms;   /* Wrap-safe elapsed time */
+    uint8_t reasons = first_frame ? TX_REASON_KEEPALIVE : 0u;
+    uint8_t requesting = 0;                 /* Signals asking for a frame in this slot */
+    bool deferred = false;
+
+    if (due_reasons != 0u) stats.refused++; /* The previous due frame was not committed */
+    due_reasons = 0;
+
+    for (uint8_t i = 0; i < TX_SIG_COUNT; i++) {
+        int32_t delta = value_now[i] - value_sent[i];
+        if (delta < 0) delta = -delta;
+
+        if (policy[i].force_on_edge && delta != 0) {
+            reasons |= TX_REASON_EDGE;
+            requesting++;
+        } else if (delta > (int32_t)policy[i].deadband) {
+            if (since >= policy[i].min_gap_ms) {
+                reasons |= TX_REASON_CHANGE;
+                requesting++;
+            } else {
+                deferred = true;            /* Will be sent once the gap has elapsed */
+            }
+        }
+
+        if (policy[i].max_silence_ms != 0u && since >= policy[i].max_silence_ms) {
+            reasons |= TX_REASON_KEEPALIVE;
+        }
+    }
+
+    if (reasons == 0u) {
+        if (deferred) stats.deferred++;
+        return 0u;
+    }
+
+    /* The frame carries these values; they become the reference only once it is accepted */
+    memcpy(value_due, value_now, sizeof(value_due));
+    due_reasons = reasons;
+    due_requesting = requesting;
+
+    return reasons;
+}
+
+void can_tx_sched_commit(uint32_t now_ms) {
+    if (due_reasons == 0u) return;
+
+    /* One frame carries every signal: all the references move together */
+    memcpy(value_sent, value_due, sizeof(value_sent));
+    last_tx_ms = now_ms;
+    first_frame = false;
+
+    stats.frames++;
+    if (due_reasons & TX_REASON_EDGE) stats.edge++;
+    if (due_reasons & TX_REASON_CHANGE) stats.change++;
+    if (due_reasons == TX_REASON_KEEPALIVE) stats.keepalive++;
+    if (due_requesting > 1u) stats.coalesced += (uint32_t)(due_requesting - 1u);
+    due_reasons = 0;
+}
+
+void can_tx_sched_getStats(TxSchedStats_t *out) {
+    if (out != NULL) *out = stats;
+}
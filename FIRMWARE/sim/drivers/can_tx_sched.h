@@ -0,0 +1,146 @@
+/**
+ * @file can_tx_sched.h
+ * @brief Event/change-driven transmit scheduler for the Steering Wheel status frame.
+ *
+ * @details
+ * Decides, once per main-loop slot, whether the `SteeringWheel_Status` frame must
+ * be sent. Every signal carried by the frame has its own policy:
+ *
+ * - **Deadband**: changes smaller than or equal to the deadband are ignored
+ *   (they still travel with the next frame sent for another reason).
+ * - **Minimum gap**: a change of this signal may not trigger a frame earlier than
+ *   `min_gap_ms` after the previous frame (rate limit while the value moves continuously).
+ * - **Maximum silence**: a frame is sent at least every `max_silence_ms` (keep-alive).
+ * - **Forced send on edge**: any change is sent in the current slot, bypassing
+ *   deadband and minimum gap (buttons, rotary).
+ *
+ * All pending changes are coalesced: at most one frame is produced per call to
+ * ::can_tx_sched_poll, and it always carries the latest value of every signal.
+ * The worst-case frame rate is therefore bounded by the smallest minimum gap
+ * (plus debounced edges), independently of how fast the inputs move.
+ *
+ * @note
+ * The scheduler does not transmit by itself: the caller sends the frame when
+ * ::can_tx_sched_poll returns a non-zero reason mask, then calls
+ * ::can_tx_sched_commit once the driver has accepted it. A frame refused (TX
+ * mailboxes busy) leaves the references untouched, so the next poll asks again.
+ */
+
+#ifndef CAN_TX_SCHED_H
+#define CAN_TX_SCHED_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------ENUMERATIONS-----------------------------------*/
+
+/**
+ * @brief Signals carried by the SteeringWheel_Status frame.
+ */
+typedef enum {
+    TX_SIG_BUTTONS,     /**< Debounced button bitmask. */
+    TX_SIG_ROTARY,      /**< Rotary switch position. */
+    TX_SIG_CLUTCH,      /**< Clutch position (%). */
+    TX_SIG_COUNT        /**< Number of scheduled signals. */
+} TxSignalId_t;
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+/** @name Transmission reasons (bitmask returned by ::can_tx_sched_poll)
+ *  @{ */
+#define TX_REASON_EDGE       0x01u  /**< A forced-on-edge signal changed. */
+#define TX_REASON_CHANGE     0x02u  /**< A signal moved beyond its deadband and its minimum gap elapsed. */
+#define TX_REASON_KEEPALIVE  0x04u  /**< Maximum silence reached (or first frame). */
+/** @} */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Transmission policy of one signal.
+ */
+typedef struct {
+    uint16_t min_gap_ms;      /**< Minimum time since the last frame before a change may trigger a new one. */
+    uint16_t max_silence_ms;  /**< Send at least this often (0 = no keep-alive requirement). */
+    uint16_t deadband;        /**< Changes <= deadband (signal units) do not trigger a frame. */
+    bool     force_on_edge;   /**< Any change triggers a frame immediately. */
+} TxPolicy_t;
+
+/**
+ * @brief Scheduler counters (diagnostics).
+ */
+typedef struct {
+    uint32_t frames;          /**< Frames sent (committed). */
+    uint32_t edge;            /**< Frames with ::TX_REASON_EDGE. */
+    uint32_t change;          /**< Frames with ::TX_REASON_CHANGE. */
+    uint32_t keepalive;       /**< Frames with ::TX_REASON_KEEPALIVE only. */
+    uint32_t deferred;        /**< Slots where a change was held back by the minimum gap. */
+    uint32_t coalesced;       /**< Extra signal changes merged into an already due frame. */
+    uint32_t refused;         /**< Due frames not committed (refused by the driver), asked again. */
+} TxSchedStats_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Initializes the scheduler with one policy per signal.
+ *
+ * @details
+ * The first call to ::can_tx_sched_poll always requests a frame.
+ *
+ * @param[in] policies Array of ::TX_SIG_COUNT policies, indexed by ::TxSignalId_t.
+ */
+void can_tx_sched_init(const TxPolicy_t policies[TX_SIG_COUNT]);
+
+/**
+ * @brief Replaces the policy of one signal at run time (calibration).
+ *
+ * @details
+ * The "last sent" reference and timers are kept; the new policy applies from
+ * the next ::can_tx_sched_poll.
+ *
+ * @param[in] sig    Signal identifier.
+ * @param[in] policy New policy.
+ */
+void can_tx_sched_setPolicy(TxSignalId_t sig, const TxPolicy_t *policy);
+
+/**
+ * @brief Stores the latest value of a signal.
+ *
+ * @param[in] sig   Signal identifier.
+ * @param[in] value Current value, in the same units as the policy deadband.
+ */
+void can_tx_sched_update(TxSignalId_t sig, int32_t value);
+
+/**
+ * @brief Evaluates all policies for the current slot.
+ *
+ * @details
+ * When a frame is due the caller transmits it with the current values and
+ * reports the acceptance with ::can_tx_sched_commit. Polling changes no
+ * reference: until the commit, every poll sees the same pending changes.
+ *
+ * @param[in] now_ms Current time in milliseconds.
+ * @return uint8_t Reason bitmask (`TX_REASON_*`), 0 if no frame is due.
+ */
+uint8_t can_tx_sched_poll(uint32_t now_ms);
+
+/**
+ * @brief Records that the frame requested by the last poll was accepted.
+ *
+ * @details
+ * The values of that poll become the "last sent" reference and `now_ms` the
+ * time of the last frame (minimum gap, maximum silence). Without a due frame
+ * since the previous commit the call does nothing.
+ *
+ * @param[in] now_ms Current time in milliseconds.
+ */
+void can_tx_sched_commit(uint32_t now_ms);
+
+/**
+ * @brief Returns the scheduler counters.
+ *
+ * @param[out] stats Destination structure.
+ */
+void can_tx_sched_getStats(TxSchedStats_t *stats);
+
+#endif /* CAN_TX_SCHED_H */
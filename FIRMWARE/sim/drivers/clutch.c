@@ -13,7 +13,7 @@
  * hardware abstraction between simulation and target MCU.
  */
 
-#include "../hal/hal_adc.h"
+#include "hal_adc.h"
 #include "clutch.h"
 #include <stdbool.h>
 
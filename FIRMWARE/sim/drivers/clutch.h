@@ -19,11 +19,13 @@
 #ifndef CLUTCH_H
 #define CLUTCH_H
 
+#include "hal_adc.h"
+
 /** @def CLUTCH_ADC_CHANNEL
  *  @brief Defines the ADC channel used for clutch pedal input.
- *  @note Change this value according to the actual hardware connection.
+ *  @note Set by the platform HAL (::HAL_ADC_CH_CLUTCH in hal_adc_port.h).
  */
-#define CLUTCH_ADC_CHANNEL 0 
+#define CLUTCH_ADC_CHANNEL HAL_ADC_CH_CLUTCH
 
 
 /**
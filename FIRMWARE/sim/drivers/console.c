@@ -0,0 +1,209 @@
+/**
+ * @file console.c
+ * @brief Implementation of the line-oriented command console.
+ *
+ * @details
+ * Characters are appended to a line buffer until CR or LF; the line is then
+ * split into words in place and dispatched. Backspace / DEL remove the last
+ * character. A line longer than ::CONSOLE_LINE_MAX is discarded whole.
+ */
+
+#include "console.h"
+#include "hal_console.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static const ConsoleParam_t *param_tab = NULL;
+static uint8_t               param_count = 0;
+static const ConsoleCmd_t   *cmd_tab = NULL;
+static uint8_t               cmd_count = 0;
+
+static char     line[CONSOLE_LINE_MAX + 1u];    /**< Line being received. */
+static uint32_t line_len = 0;
+static bool     line_overflow = false;          /**< Too long: discarded at its end. */
+
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+static const ConsoleParam_t *find_param(const char *name) {
+    for (uint8_t i = 0; i < param_count; i++) {
+        if (strcmp(param_tab[i].name, name) == 0) return &param_tab[i];
+    }
+    return NULL;
+}
+
+/** @brief Reads a parameter as a float (every type fits for range checks and printing). */
+static float param_get(const ConsoleParam_t *p) {
+    switch (p->type) {
+        case CONSOLE_U8:  return (float)*(const uint8_t *)p->value;
+        case CONSOLE_U16: return (float)*(const uint16_t *)p->value;
+        case CONSOLE_U32: return (float)*(const uint32_t *)p->value;
+        default:          return *(const float *)p->value;
+    }
+}
+
+/**
+ * @brief Formats a float with two decimals as a scaled integer.
+ *
+ * The target links newlib-nano without _printf_float, where %f / %g print
+ * nothing: values are rounded to hundredths and printed with %ld.
+ */
+static const char *fmt_f32(char *buf, size_t size, float f) {
+    float scaled = f * 100.0f;
+    if (scaled > 2.0e9f)  scaled = 2.0e9f;          /* Keeps the cast defined */
+    if (scaled < -2.0e9f) scaled = -2.0e9f;
+    long c = (long)(scaled + ((scaled < 0.0f) ? -0.5f : 0.5f));
+    unsigned long a = (unsigned long)((c < 0) ? -c : c);
+    snprintf(buf, size, "%s%lu.%02lu", (c < 0) ? "-" : "", a / 100u, a % 100u);
+    return buf;
+}
+
+static void param_print(const ConsoleParam_t *p) {
+    if (p->type == CONSOLE_F32) {
+        char v[16], lo[16], hi[16];
+        console_printf("%-18s %-10s [%s .. %s]  %s\r\n", p->name, fmt_f32(v, sizeof(v), param_get(p)),
+                       fmt_f32(lo, sizeof(lo), p->min), fmt_f32(hi, sizeof(hi), p->max), p->help);
+    } else {
+        uint32_t v = (p->type == CONSOLE_U8)  ? *(const uint8_t *)p->value :
+                     (p->type == CONSOLE_U16) ? *(const uint16_t *)p->value : *(const uint32_t *)p->value;
+        console_printf("%-18s %-10lu [%lu .. %lu]  %s\r\n", p->name, (unsigned long)v,
+                       (unsigned long)p->min, (unsigned long)p->max, p->help);
+    }
+}
+
+/** @brief Parses and stores a value; false (nothing written) if invalid or out of range. */
+static bool param_set(const ConsoleParam_t *p, const char *text) {
+    char *end;
+
+    if (p->type == CONSOLE_F32) {
+        float f = strtof(text, &end);
+        if (end == text || *end != '\0' || !(f >= p->min && f <= p->max)) return false;
+        *(float *)p->value = f;
+        return true;
+    }
+
+    if (text[0] == '-') return false;
+    unsigned long u = strtoul(text, &end, 0);      /* Decimal or 0x... */
+    if (end == text || *end != '\0' || (float)u < p->min || (float)u > p->max) return false;
+    switch (p->type) {
+        case CONSOLE_U8:  *(uint8_t *)p->value  = (uint8_t)u;  break;
+        case CONSOLE_U16: *(uint16_t *)p->value = (uint16_t)u; break;
+        default:          *(uint32_t *)p->value = (uint32_t)u; break;
+    }
+    return true;
+}
+
+static void cmd_help(void) {
+    console_printf("help | list | get <name> | set <name> <value>\r\n");
+    for (uint8_t i = 0; i < cmd_count; i++) {
+        console_printf("%s\r\n", cmd_tab[i].help);
+    }
+}
+
+/** @brief Splits the line into words and runs the command. */
+static void execute(char *text) {
+    char *argv[CONSOLE_ARGS_MAX];
+    int argc = 0;
+
+    for (char *tok = strtok(text, " \t"); tok != NULL; tok = strtok(NULL, " \t")) {
+        if (argc == (int)CONSOLE_ARGS_MAX) {
+            console_printf("ERR too many words\r\n");
+            return;
+        }
+        argv[argc++] = tok;
+    }
+    if (argc == 0) return;
+
+    if (strcmp(argv[0], "help") == 0) {
+        cmd_help();
+    } else if (strcmp(argv[0], "list") == 0) {
+        for (uint8_t i = 0; i < param_count; i++) param_print(&param_tab[i]);
+    } else if (strcmp(argv[0], "get") == 0 || strcmp(argv[0], "set") == 0) {
+        bool set = (argv[0][0] == 's');
+        if (argc != (set ? 3 : 2)) {
+            console_printf("ERR usage: %s\r\n", set ? "set <name> <value>" : "get <name>");
+            return;
+        }
+        const ConsoleParam_t *p = find_param(argv[1]);
+        if (p == NULL) {
+            console_printf("ERR unknown parameter '%s'\r\n", argv[1]);
+            return;
+        }
+        if (set && !param_set(p, argv[2])) {
+            console_printf("ERR invalid value '%s'\r\n", argv[2]);
+            return;
+        }
+        param_print(p);
+    } else {
+        uint8_t i;
+        for (i = 0; i < cmd_count; i++) {
+            if (strcmp(argv[0], cmd_tab[i].name) == 0) break;
+        }
+        if (i == cmd_count) {
+            console_printf("ERR unknown command '%s' (help)\r\n", argv[0]);
+            return;
+        }
+        if (!cmd_tab[i].handler(argc, argv)) {
+            console_printf("ERR usage: %s\r\n", cmd_tab[i].help);
+            return;
+        }
+    }
+    console_printf("OK\r\n");
+}
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void console_init(const ConsoleParam_t *params, uint8_t n_params,
+                  const ConsoleCmd_t *cmds, uint8_t n_cmds) {
+    param_tab = params;
+    param_count = n_params;
+    cmd_tab = cmds;
+    cmd_count = n_cmds;
+    line_len = 0;
+    line_overflow = false;
+}
+
+void console_poll(void) {
+    char rx[32];
+    uint32_t n;
+
+    while ((n = hal_console_read(rx, sizeof(rx))) > 0u) {
+        for (uint32_t i = 0; i < n; i++) {
+            char c = rx[i];
+            if (c == '\r' || c == '\n') {
+                if (line_overflow) {
+                    console_printf("ERR line too long\r\n");
+                } else if (line_len > 0u) {
+                    line[line_len] = '\0';
+                    execute(line);
+                }
+                line_len = 0;
+                line_overflow = false;
+            } else if (c == '\b' || c == 0x7F) {
+                if (line_len > 0u) line_len--;
+            } else if (line_len < CONSOLE_LINE_MAX) {
+                line[line_len++] = c;
+            } else {
+                line_overflow = true;
+            }
+        }
+    }
+}
+
+void console_printf(const char *fmt, ...) {
+    char buf[128];
+    va_list args;
+
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    if (len > 0) {
+        hal_console_write(buf, ((uint32_t)len < sizeof(buf)) ? (uint32_t)len : (uint32_t)sizeof(buf) - 1u);
+    }
+}
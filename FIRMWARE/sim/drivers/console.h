@@ -0,0 +1,105 @@
+/**
+ * @file console.h
+ * @brief Line-oriented command console for runtime tuning (UART on the target, stdin on the PC).
+ *
+ * @details
+ * ::console_poll collects the characters received since the previous slot
+ * (::hal_console_read) and executes each complete line. It never waits, so
+ * the console costs nothing while nobody types.
+ *
+ * The application registers a table of parameters (name, address, type and
+ * range) and a table of extra commands. Built-in commands:
+ *
+ * | Command              | Action                                          |
+ * |----------------------|-------------------------------------------------|
+ * | `help`               | Commands, built-in and registered               |
+ * | `list`               | Every parameter with its value and range        |
+ * | `get <name>`         | Value of one parameter                          |
+ * | `set <name> <value>` | New value, refused outside the range            |
+ *
+ * A parameter is a plain variable owned by the application (e.g. a field of
+ * the XCP calibration structure): a value set here is seen by XCP and the
+ * other way round. Replies end with `OK` or `ERR <reason>` so a script can
+ * drive the console. Lines are up to ::CONSOLE_LINE_MAX characters, ended
+ * by CR or LF; the console does not echo (enable local echo in the terminal).
+ */
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define CONSOLE_LINE_MAX   64u   /**< Longest command line (characters). */
+#define CONSOLE_ARGS_MAX   4u    /**< Words per command line. */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Storage type of a parameter.
+ */
+typedef enum {
+    CONSOLE_U8 = 0,     /**< uint8_t. */
+    CONSOLE_U16,        /**< uint16_t. */
+    CONSOLE_U32,        /**< uint32_t. */
+    CONSOLE_F32,        /**< float. */
+} ConsoleType_t;
+
+/**
+ * @brief One tunable parameter.
+ */
+typedef struct {
+    const char   *name;     /**< Name used by get / set. */
+    void         *value;    /**< Address of the variable. */
+    ConsoleType_t type;     /**< Storage type. */
+    float         min;      /**< Lowest accepted value. */
+    float         max;      /**< Highest accepted value. */
+    const char   *help;     /**< One-line description (unit). */
+} ConsoleParam_t;
+
+/**
+ * @brief One application command.
+ *
+ * @details
+ * argv[0] is the command name; the handler replies with ::console_printf and
+ * returns false to print `ERR usage` (with its help text).
+ */
+typedef struct {
+    const char *name;                           /**< Command word. */
+    bool      (*handler)(int argc, char **argv);/**< Executes the command. */
+    const char *help;                           /**< Usage and one-line description. */
+} ConsoleCmd_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Registers the parameter and command tables (kept by reference).
+ *
+ * @param[in] params   Parameter table.
+ * @param[in] n_params Number of parameters.
+ * @param[in] cmds     Application commands (may be NULL).
+ * @param[in] n_cmds   Number of commands.
+ */
+void console_init(const ConsoleParam_t *params, uint8_t n_params,
+                  const ConsoleCmd_t *cmds, uint8_t n_cmds);
+
+/**
+ * @brief Reads the pending input and executes the complete lines.
+ *
+ * @details
+ * Call once per main-loop slot. A command runs in the caller's context, so
+ * a parameter never changes in the middle of a slot.
+ */
+void console_poll(void);
+
+/**
+ * @brief printf-style reply (for the command handlers).
+ *
+ * @param[in] fmt Format string.
+ */
+void console_printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+#endif /* CONSOLE_H */
@@ -0,0 +1,300 @@
+/**
+ * @file dash_layout.h
+ * @brief Built-in dashboard layout generated from dash_layout.json.
+ *
+ * @details
+ * GENERATED FILE - DO NOT EDIT. Regenerate with `make layout`:
+ *     python3 tools/layout2c.py drivers/dash_layout.json app/app_main.c drivers/dash_layout.h
+ *
+ * Blob in the layout.h format, stored as words for its alignment:
+ * - race     static layer  1151 bytes, 14 widgets
+ * - temps    static layer  3009 bytes, 11 widgets
+ * - inputs   static layer  1387 bytes, 16 widgets
+ */
+
+#ifndef DASH_LAYOUT_H
+#define DASH_LAYOUT_H
+
+#include <stdint.h>
+
+#define DASH_LAYOUT_SIZE  8780u  /**< Bytes of the blob. */
+
+static const uint32_t dash_layout[DASH_LAYOUT_SIZE / 4u] = {
+    0x594C3146, 0x00200002, 0x0000224C, 0x237C2D4D, 0x00F00140, 0x00001703, 0x000000EC, 0x00000020,
+    0x74747562, 0x00736E6F, 0x61746F72, 0x705F7972, 0x7200736F, 0x7261746F, 0x64615F79, 0x6C630063,
+    0x68637475, 0x6364615F, 0x756C6300, 0x5F686374, 0x00776172, 0x74756C63, 0x665F6863, 0x00746C69,
+    0x74756C63, 0x745F6863, 0x31740078, 0x00327400, 0x72616567, 0x61656700, 0x68735F72, 0x006E776F,
+    0x72616567, 0x6E65705F, 0x69700064, 0x696C5F74, 0x6574696D, 0x72640072, 0x656C0073, 0x69705F64,
+    0x656C0074, 0x65745F64, 0x6300706D, 0x615F6E61, 0x76697463, 0x61630065, 0x78745F6E, 0x6E616300,
+    0x0078725F, 0x5F737562, 0x64616F6C, 0x73756200, 0x6174735F, 0x62006574, 0x6D5F6E74, 0x62006773,
+    0x6D5F6E74, 0x765F6773, 0x00007369, 0x65636172, 0x00000000, 0x000009A4, 0x0000047F, 0x000009A0,
+    0x0000014C, 0x007FBDC2, 0x00000E02, 0x706D6574, 0x00000073, 0x00000F80, 0x00000BC1, 0x00000F78,
+    0x00000424, 0x001FB180, 0x00000B03, 0x75706E69, 0x00007374, 0x00001BE8, 0x0000056B, 0x00001BE0,
+    0x00000660, 0x007FB04F, 0x00001003, 0x0101FF00, 0x00000000, 0x00070088, 0x00070088, 0x00080012,
+    0x000007E0, 0x00010000, 0x00000E24, 0x00000E30, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00011104, 0xFFFF0000, 0x000A00A0, 0x0007009D, 0x00070007, 0x0000001F, 0x00020000, 0x00000E34,
+    0x00000000, 0x00000000, 0x00000003, 0x00000000, 0x00000000, 0x00011204, 0xFFFF0000, 0x000A00A8,
+    0x000700A5, 0x00070007, 0x000007E0, 0x00040000, 0x00000E34, 0x00000000, 0x00000000, 0x00000003,
+    0x00000000, 0x00000000, 0x02011301, 0x00000000, 0x000700B2, 0x000700B2, 0x00080030, 0x000007E0,
+    0x00180000, 0x00000E34, 0x00000E4C, 0x00000E51, 0x00000001, 0x00000000, 0x00000000, 0x01020701,
+    0x00000000, 0x0014000C, 0x0014000C, 0x00100054, 0x0000FFFF, 0x00010080, 0x00000E54, 0x00000E60,
+    0x00000E64, 0x00000001, 0x00000000, 0x00000000, 0x01020801, 0x00000000, 0x001400DC, 0x001400DC,
+    0x00100054, 0x0000FFFF, 0x00010100, 0x00000E68, 0x00000E74, 0x00000E64, 0x00000001, 0x00000000,
+    0x00000000, 0x02010603, 0xFFFF0001, 0x00320064, 0x00320064, 0x001200A0, 0x000007E0, 0x00000040,
+    0x00000E78, 0x00000000, 0x00000000, 0x00000000, 0x000003E8, 0x00000000, 0x00020601, 0x00000000,
+    0x0032010E, 0x0032010E, 0x00100030, 0x0000FFFF, 0x00000040, 0x00000E90, 0x00000E90, 0x00000E51,
+    0x0000000A, 0x00000000, 0x00000000, 0x00020101, 0x00000000, 0x0050006E, 0x0050006E, 0x00100030,
+    0x0000FFFF, 0x00000002, 0x00000E94, 0x00000E94, 0x00000E96, 0x00000001, 0x00000000, 0x00000000,
+    0x01021502, 0x00000000, 0x005000B4, 0x005000B4, 0x0010006C, 0x0000FFE0, 0x00600000, 0x00000E98,
+    0x00000EC0, 0x00000000, 0x00000005, 0x00000000, 0x00000000, 0x02060A02, 0x00000000, 0x0092008E,
+    0x00880086, 0x003A0034, 0x000007FF, 0x00010C00, 0x00000ED4, 0x00000F00, 0x00000000, 0x0000000A,
+    0x00000000, 0x00000000, 0x0202FF00, 0xFFFF0001, 0x00DB0023, 0x00D70000, 0x0019006A, 0x001FFFFF,
+    0x00012000, 0x00000F28, 0x00000EB6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0202FF00,
+    0xFFFF0001, 0x00DB008E, 0x00D7006B, 0x0019006A, 0x07E0FFFF, 0x00011000, 0x00000F40, 0x00000EBA,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0202FF00, 0xFFFF0001, 0x00DB00F3, 0x00D700D6,
+    0x0019006A, 0xF800FFFF, 0x00018000, 0x00000F58, 0x00000F70, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x0101FF00, 0x00000000, 0x00070088, 0x00070088, 0x00080012, 0x000007E0, 0x00010000,
+    0x00001B44, 0x00000E30, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00011104, 0xFFFF0000,
+    0x000A00A0, 0x0007009D, 0x00070007, 0x0000001F, 0x00020000, 0x00001B50, 0x00000000, 0x00000000,
+    0x00000003, 0x00000000, 0x00000000, 0x00011204, 0xFFFF0000, 0x000A00A8, 0x000700A5, 0x00070007,
+    0x000007E0, 0x00040000, 0x00001B50, 0x00000000, 0x00000000, 0x00000003, 0x00000000, 0x00000000,
+    0x02011301, 0x00000000, 0x000700B2, 0x000700B2, 0x00080030, 0x000007E0, 0x00180000, 0x00001B50,
+    0x00000E4C, 0x00000E51, 0x00000001, 0x00000000, 0x00000000, 0x02050701, 0x00000000, 0x00500014,
+    0x00500014, 0x00280060, 0x0000FFFF, 0x00018080, 0x00001B68, 0x00000E90, 0x00000000, 0x00000001,
+    0x00000000, 0x00000000, 0x02050801, 0x00000000, 0x005000AF, 0x005000AF, 0x00280060, 0x0000FFFF,
+    0x00018100, 0x00001B80, 0x00000E90, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00010705,
+    0x84100000, 0x00000000, 0x009C000B, 0x0035008F, 0x000007FF, 0x00000000, 0x00001B98, 0x00000000,
+    0x00000000, 0xFFFFFFEC, 0x0000003C, 0x000001F4, 0x00010805, 0x84100000, 0x00000000, 0x009C00A6,
+    0x0035008F, 0x0000FFE0, 0x00000000, 0x00001B98, 0x00000000, 0x00000000, 0x0000003C, 0x000000A0,
+    0x000001F4, 0x0202FF00, 0xFFFF0001, 0x00DB0023, 0x00D70000, 0x0019006A, 0x001FFFFF, 0x00012000,
+    0x00001B98, 0x00000EB6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0202FF00, 0xFFFF0001,
+    0x00DB008E, 0x00D7006B, 0x0019006A, 0x07E0FFFF, 0x00011000, 0x00001BB0, 0x00000EBA, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0202FF00, 0xFFFF0001, 0x00DB00F3, 0x00D700D6, 0x0019006A,
+    0xF800FFFF, 0x00018000, 0x00001BC8, 0x00000F70, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0101FF00, 0x00000000, 0x00070088, 0x00070088, 0x00080012, 0x000007E0, 0x00010000, 0x00002154,
+    0x00000E30, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00011104, 0xFFFF0000, 0x000A00A0,
+    0x0007009D, 0x00070007, 0x0000001F, 0x00020000, 0x00002160, 0x00000000, 0x00000000, 0x00000003,
+    0x00000000, 0x00000000, 0x00011204, 0xFFFF0000, 0x000A00A8, 0x000700A5, 0x00070007, 0x000007E0,
+    0x00040000, 0x00002160, 0x00000000, 0x00000000, 0x00000003, 0x00000000, 0x00000000, 0x02011301,
+    0x00000000, 0x000700B2, 0x000700B2, 0x00080030, 0x000007E0, 0x00180000, 0x00002160, 0x00000E4C,
+    0x00000E51, 0x00000001, 0x00000000, 0x00000000, 0x0202FF00, 0xFFFF0001, 0x002C001D, 0x00260004,
+    0x001C004B, 0x0000FFFF, 0x00000001, 0x00002178, 0x00002190, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x0202FF00, 0xFFFF0001, 0x002C0060, 0x00260053, 0x001C004B, 0x0000FFFF, 0x00000001,
+    0x00002194, 0x000021AC, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0202FF00, 0xFFFF0001,
+    0x002C00B5, 0x002600A2, 0x001C004B, 0x0000FFFF, 0x00000001, 0x000021B4, 0x00000EB6, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0202FF00, 0xFFFF0001, 0x002C0104, 0x002600F1, 0x001C004B,
+    0x0000FFFF, 0x00000001, 0x000021CC, 0x00000EBA, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00020301, 0x00000000, 0x005E003C, 0x005E003C, 0x00100054, 0x0000FFFF, 0x00000008, 0x000021E4,
+    0x00000E90, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00020601, 0x00000000, 0x005E00D4,
+    0x005E00D4, 0x00100060, 0x0000FFFF, 0x00000040, 0x000021E4, 0x00000E90, 0x00000E51, 0x0000000A,
+    0x00000001, 0x00000000, 0x00020101, 0x00000000, 0x008A003C, 0x008A003C, 0x00100054, 0x0000FFFF,
+    0x00000002, 0x000021E4, 0x00000E90, 0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x00020201,
+    0x00000000, 0x008A00D4, 0x008A00D4, 0x00100060, 0x0000FFFF, 0x00000004, 0x000021E4, 0x00000E90,
+    0x00000000, 0x00000001, 0x00000000, 0x00000000, 0x01021502, 0x00000000, 0x00B6000C, 0x00B6000C,
+    0x0010006C, 0x0000FFE0, 0x00600000, 0x000021E4, 0x000021F0, 0x00000000, 0x00000005, 0x00000000,
+    0x00000000, 0x0202FF00, 0xFFFF0001, 0x00DB0023, 0x00D70000, 0x0019006A, 0x001FFFFF, 0x00012000,
+    0x00002204, 0x00000EB6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0202FF00, 0xFFFF0001,
+    0x00DB008E, 0x00D7006B, 0x0019006A, 0x07E0FFFF, 0x00011000, 0x0000221C, 0x00000EBA, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0202FF00, 0xFFFF0001, 0x00DB00F3, 0x00D700D6, 0x0019006A,
+    0xF800FFFF, 0x00018000, 0x00002234, 0x00000F70, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0xFFFF0000, 0x163E8E00, 0x16001406, 0x12001200, 0x04001200, 0x14061601, 0x12001600, 0x12001200,
+    0x12010200, 0x12061206, 0x12001600, 0x12001200, 0x12010200, 0x12061206, 0x12001600, 0x12001200,
+    0x12010200, 0x1206120E, 0x1A021206, 0x12041604, 0xFC001402, 0x120E1200, 0x12061206, 0x16041A02,
+    0x14021204, 0x1200FC00, 0x1206120E, 0x12061206, 0x12061206, 0x12041402, 0x1200FA00, 0x1206120E,
+    0x12061206, 0x12061206, 0x12041402, 0x1200FA00, 0x1206120E, 0x12061206, 0x120A1206, 0xFA001206,
+    0x120E1200, 0x12061206, 0x12061206, 0x1206120A, 0x1200FA00, 0x12061206, 0x14041206, 0x12021206,
+    0x12061202, 0x12061202, 0x1200FA00, 0x12061206, 0x14041206, 0x12021206, 0x12061202, 0x12061202,
+    0x1600FC00, 0x14061606, 0x12081202, 0x12041606, 0xFC001206, 0x16061600, 0x12021406, 0x16061208,
+    0x12061204, 0x1614FC00, 0x1A021A04, 0x12061202, 0x0A001802, 0x1A041601, 0x12021A02, 0x18021206,
+    0x12010800, 0x12021206, 0x1202120A, 0x12021202, 0x12021206, 0x06001206, 0x12061201, 0x120A1202,
+    0x12021202, 0x12061202, 0x12061202, 0x12010600, 0x120E120A, 0x12061206, 0x12061202, 0xFE001206,
+    0x120A1200, 0x1206120E, 0x12021206, 0x12061206, 0x16010000, 0x12081804, 0x12061206, 0x0A001802,
+    0x18041601, 0x12061208, 0x18021206, 0x12011000, 0x120E1202, 0x12061206, 0x120E1202, 0x12010600,
+    0x120E1202, 0x12061206, 0x120E1202, 0x1200FE00, 0x12021206, 0x1206120E, 0x12021206, 0x12010E00,
+    0x12021206, 0x1206120E, 0x12021206, 0x16011000, 0x12061A04, 0x12041608, 0x16011000, 0x12061A04,
+    0x12041608, 0x180F4B00, 0x12061A02, 0x16001806, 0x1A021801, 0x18061206, 0x12011400, 0x12021206,
+    0x1202120C, 0x12061204, 0x12011200, 0x12021206, 0x1202120C, 0x12061204, 0x12011200, 0x120A120A,
+    0x12021206, 0x12001206, 0x120A1201, 0x1206120A, 0x12061202, 0x12011200, 0x1204180A, 0x18021206,
+    0x12011400, 0x1204180A, 0x18021206, 0x12011400, 0x12021404, 0x12021A0A, 0x16001202, 0x14041201,
+    0x1A0A1202, 0x12021202, 0x12011600, 0x12021206, 0x1206120A, 0x12041202, 0x12011400, 0x12021206,
+    0x1206120A, 0x12041202, 0x18011600, 0x12021A02, 0x12021206, 0x14001206, 0x1A021801, 0x12061202,
+    0x12061202, 0x10151000, 0x0A000036, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101,
+    0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x34001101, 0x0A001100, 0x00361001,
+    0x0038C500, 0x00000010, 0x00000000, 0x0000F800, 0x00554345, 0x00000014, 0x00000001, 0x0000FFE0,
+    0x00000114, 0x00000000, 0x0000F800, 0x20535542, 0x00002500, 0x00000010, 0x00000000, 0x00008410,
+    0x003A3154, 0x00000043, 0x00000010, 0x00000000, 0x00008410, 0x003A3254, 0x00000206, 0x000002BC,
+    0x0000F800, 0x00000206, 0x00000190, 0x0000FFE0, 0x00000000, 0x005D005B, 0x00000016, 0x00000000,
+    0x00000000, 0x52414547, 0x00505520, 0x52414547, 0x574F4420, 0x5244004E, 0x49500053, 0x00000054,
+    0x00000E90, 0x00000EA4, 0x00000EAC, 0x00000EB6, 0x00000EBA, 0x0000010B, 0x00000000, 0x0000FFE0,
+    0x00000010, 0x00000000, 0x00008410, 0x0031004E, 0x00330032, 0x00350034, 0x00370036, 0x00390038,
+    0x00000EEC, 0x00000EEE, 0x00000EF0, 0x00000EF2, 0x00000EF4, 0x00000EF6, 0x00000EF8, 0x00000EFA,
+    0x00000EFC, 0x00000EFE, 0x0001000D, 0x00000000, 0x00000000, 0x00010010, 0x00000000, 0x00008410,
+    0x0001000C, 0x00000000, 0x00000000, 0x00010010, 0x00000000, 0x00008410, 0x0001000F, 0x00000000,
+    0x00000000, 0x00010010, 0x00000000, 0x00008410, 0x504D4554, 0x00000000, 0xFFFF0000, 0x00008410,
+    0x15078C00, 0x11011501, 0x14011103, 0x14011502, 0x15031104, 0x11031101, 0x15021401, 0x1100FF00,
+    0x11011101, 0x12051101, 0x11011201, 0x11011103, 0x11031105, 0x11011102, 0x11011102, 0x11011101,
+    0x11011103, 0x11011103, 0x11010500, 0x11051103, 0x11011101, 0x11031101, 0x11051101, 0x11011103,
+    0x11031103, 0x11031103, 0x11031101, 0x05001101, 0x14031101, 0x11011102, 0x14011101, 0x14021402,
+    0x11031102, 0x11031103, 0x14011103, 0x02001402, 0x11031101, 0x11011105, 0x11011101, 0x11051105,
+    0x15031101, 0x11031103, 0x11011103, 0x11031101, 0x11010500, 0x11051103, 0x11011103, 0x11051105,
+    0x11021102, 0x11031103, 0x11031103, 0x11021101, 0x05001102, 0x15031101, 0x11031101, 0x15051101,
+    0x11031101, 0x11031101, 0x13041103, 0x11031102, 0xB3001501, 0x01402009, 0x100B4A00, 0x100A0091,
+    0x14000091, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100,
+    0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100,
+    0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100,
+    0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00,
+    0x11001400, 0x12061A09, 0x11007400, 0x1A09110A, 0x72001604, 0x14001100, 0x1A091100, 0x74001206,
+    0x110A1100, 0x16041A09, 0x11007200, 0x11001400, 0x12021209, 0x14041202, 0x11007400, 0x1209110A,
+    0x12021202, 0x12061202, 0x11007000, 0x11001400, 0x12021209, 0x14041202, 0x11007400, 0x1209110A,
+    0x12021202, 0x12061202, 0x11007000, 0x11001400, 0x120A120D, 0x11007400, 0x120D110A, 0x7000120E,
+    0x14001100, 0x120D1100, 0x7400120A, 0x110A1100, 0x120E120D, 0x11007000, 0x11001400, 0x120A120D,
+    0x11007400, 0x120D110A, 0x72001608, 0x14001100, 0x120D1100, 0x7400120A, 0x110A1100, 0x1608120D,
+    0x11007200, 0x11001400, 0x120A120D, 0x11007400, 0x120D110A, 0x78001206, 0x14001100, 0x120D1100,
+    0x7400120A, 0x110A1100, 0x1206120D, 0x11007800, 0x11001400, 0x120A120D, 0x11007400, 0x120D110A,
+    0x78001206, 0x14001100, 0x120D1100, 0x7400120A, 0x110A1100, 0x1206120D, 0x11007800, 0x11001400,
+    0x1608120D, 0x11007200, 0x120D110A, 0x70001A06, 0x14001100, 0x120D1100, 0x72001608, 0x110A1100,
+    0x1A06120D, 0x11007000, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100,
+    0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00,
+    0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400,
+    0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00,
+    0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A,
+    0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100,
+    0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100,
+    0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100,
+    0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00,
+    0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400,
+    0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00,
+    0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A,
+    0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100,
+    0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100,
+    0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100,
+    0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00,
+    0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400,
+    0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00,
+    0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x19007200, 0x11001400,
+    0x7200110A, 0x14001900, 0x14001100, 0x72001100, 0x14001900, 0x110A1100, 0x19007200, 0x11001400,
+    0x11001400, 0x19007200, 0x11001400, 0x7200110A, 0x14001900, 0x14001100, 0x6F001100, 0x13091300,
+    0x11001100, 0x6F00110A, 0x13091300, 0x11001100, 0x11001400, 0x13006F00, 0x11001309, 0x110A1100,
+    0x13006F00, 0x11001309, 0x14001100, 0x6F001100, 0x13091300, 0x11001100, 0x6F00110A, 0x13091300,
+    0x11001100, 0x11001400, 0x13006F00, 0x11001D00, 0x6F00110A, 0x1D001300, 0x14001100, 0x6F001100,
+    0x1D001300, 0x110A1100, 0x13006F00, 0x11001D00, 0x11001400, 0x13006F00, 0x11001D00, 0x6F00110A,
+    0x1D001300, 0x14001100, 0x6F001100, 0x1D001300, 0x110A1100, 0x13006F00, 0x11001D00, 0x11001400,
+    0x13006F00, 0x11001D00, 0x6F00110A, 0x1D001300, 0x14001100, 0x6F001100, 0x1D001300, 0x110A1100,
+    0x13006F00, 0x11001D00, 0x11001400, 0x13006F00, 0x11001D00, 0x6F00110A, 0x1D001300, 0x14001100,
+    0x6F001100, 0x1D001300, 0x110A1100, 0x13006F00, 0x11001D00, 0x11001400, 0x13006F00, 0x11001D00,
+    0x6F00110A, 0x1D001300, 0x14001100, 0x6F001100, 0x13091300, 0x11001100, 0x6F00110A, 0x13091300,
+    0x11001100, 0x11001400, 0x13006F00, 0x11001309, 0x110A1100, 0x13006F00, 0x11001309, 0x14001100,
+    0x6F001100, 0x13091300, 0x11001100, 0x6F00110A, 0x13091300, 0x11001100, 0x11001400, 0x19007200,
+    0x11001400, 0x7200110A, 0x14001900, 0x14001100, 0x72001100, 0x14001900, 0x110A1100, 0x19007200,
+    0x11001400, 0x11001400, 0x19007200, 0x11001400, 0x7200110A, 0x14001900, 0x14001100, 0x8F001100,
+    0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100,
+    0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00,
+    0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400,
+    0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00,
+    0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A,
+    0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100,
+    0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100,
+    0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100,
+    0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00,
+    0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400,
+    0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00,
+    0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A,
+    0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100,
+    0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x00911000,
+    0x0091100A, 0x10065400, 0x100A0091, 0x14000091, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400,
+    0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00,
+    0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A,
+    0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100,
+    0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100,
+    0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100,
+    0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00,
+    0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400,
+    0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00,
+    0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A,
+    0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100,
+    0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100,
+    0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100,
+    0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00,
+    0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400,
+    0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00,
+    0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A,
+    0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100,
+    0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100,
+    0x110A1100, 0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100,
+    0x11008F00, 0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00,
+    0x11001400, 0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400,
+    0x11008F00, 0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x11001400, 0x11008F00,
+    0x8F00110A, 0x14001100, 0x8F001100, 0x110A1100, 0x11008F00, 0x10001400, 0x100A0091, 0x8A000091,
+    0x00000025, 0x00000010, 0x00000000, 0x0000F800, 0x00000014, 0x00000001, 0x0000FFE0, 0x00000114,
+    0x00000000, 0x0000F800, 0x00000010, 0x00000000, 0x00008410, 0x0000010F, 0x00000000, 0x0000F800,
+    0x00000010, 0x00000000, 0x00008410, 0x0000010F, 0x00000000, 0x0000F800, 0x0001000D, 0x00000000,
+    0x00000000, 0x00010010, 0x00000000, 0x00008410, 0x0001000C, 0x00000000, 0x00000000, 0x00010010,
+    0x00000000, 0x00008410, 0x0001000F, 0x00000000, 0x00000000, 0x00010010, 0x00000000, 0x00008410,
+    0xFFFF0000, 0x00008410, 0x13078D00, 0x11031102, 0x11021401, 0x15011103, 0x20001302, 0x11031101,
+    0x11011103, 0x11011103, 0x11011103, 0x11011101, 0x11031101, 0x11011F00, 0x11021203, 0x11031101,
+    0x11031101, 0x11031103, 0x11012300, 0x11011103, 0x14011101, 0x11031102, 0x13041103, 0x11012000,
+    0x12021103, 0x11051101, 0x11031103, 0x1F001107, 0x11031101, 0x11011103, 0x11031105, 0x11031103,
+    0x1E001103, 0x11021301, 0x11011103, 0x11041306, 0xD2001304, 0x01402009, 0x24064C00, 0x21032102,
+    0x25012501, 0x21022302, 0x23022103, 0x21011800, 0x21012103, 0x21012103, 0x21012101, 0x21012101,
+    0x21012101, 0x21012103, 0x21012103, 0x17002103, 0x21032101, 0x21032101, 0x21052103, 0x21032103,
+    0x21022201, 0x1B002101, 0x21022401, 0x21032103, 0x21032105, 0x21012103, 0x21012101, 0x18002302,
+    0x21032101, 0x21032101, 0x21052103, 0x21032103, 0x22022101, 0x17002105, 0x21032101, 0x21032101,
+    0x21052103, 0x21032103, 0x21032101, 0x21032101, 0x24011700, 0x21042303, 0x23042105, 0x21032102,
+    0xD9002302, 0x2102233B, 0x21032105, 0x23022501, 0x21032102, 0x21011D00, 0x21012103, 0x21032105,
+    0x21012101, 0x21012101, 0x21012103, 0x1D002103, 0x21052101, 0x21032105, 0x21032103, 0x21032105,
+    0x21011D00, 0x21052105, 0x21032103, 0x25052103, 0x21011D00, 0x21052105, 0x21032103, 0x21052103,
+    0x1D002103, 0x21032101, 0x21052101, 0x21032103, 0x21032103, 0x21032101, 0x23011E00, 0x23022502,
+    0x23042104, 0x21032102, 0x1209E100, 0x16061806, 0x16007A00, 0x12061204, 0x8A001A02, 0x18061200,
+    0x7A001606, 0x12041600, 0x1A021206, 0x12008800, 0x12041202, 0x12021206, 0x76001206, 0x12061200,
+    0x12061202, 0x12021202, 0x88001202, 0x12021200, 0x12061204, 0x12061202, 0x12007600, 0x12021206,
+    0x12021206, 0x12021202, 0x12008600, 0x12021206, 0x12021206, 0x12007E00, 0x12021206, 0x12061206,
+    0x12008A00, 0x12021206, 0x12021206, 0x12007E00, 0x12021206, 0x12061206, 0x12008A00, 0x12021206,
+    0x12021206, 0x12007E00, 0x12021206, 0x12061206, 0x12008A00, 0x12021206, 0x12021206, 0x12007E00,
+    0x12021206, 0x12061206, 0x1A008A00, 0x12061202, 0x7E001202, 0x12061200, 0x12061202, 0x8A001206,
+    0x12021A00, 0x12021206, 0x12007E00, 0x12021206, 0x12061206, 0x12008A00, 0x12021206, 0x12021206,
+    0x76001206, 0x12061200, 0x12061202, 0x8A001206, 0x12061200, 0x12061202, 0x12061202, 0x12007600,
+    0x12021206, 0x12061206, 0x12008A00, 0x18021206, 0x7A001606, 0x16061600, 0x8A001208, 0x12061200,
+    0x16061802, 0x16007A00, 0x12081606, 0x24148A00, 0x25022303, 0x24032103, 0x21032102, 0x21011D00,
+    0x21012103, 0x21012103, 0x21012101, 0x21012102, 0x21032102, 0x21032101, 0x21011D00, 0x21012103,
+    0x21032103, 0x21032103, 0x21032101, 0x21012102, 0x24011E00, 0x21032102, 0x21032103, 0x24012103,
+    0x1F002104, 0x21012101, 0x21032103, 0x25032103, 0x21012101, 0x1F002105, 0x21022101, 0x21032102,
+    0x21032103, 0x21012103, 0x21042102, 0x21011F00, 0x23022103, 0x21032104, 0x21012103, 0x21032103,
+    0x1809DF00, 0x16061606, 0x12007C00, 0x16061806, 0x18008800, 0x16061606, 0x12007C00, 0x16061806,
+    0x12008800, 0x12021206, 0x12021206, 0x78001206, 0x12021200, 0x12061204, 0x12061202, 0x12008600,
+    0x12021206, 0x12021206, 0x78001206, 0x12021200, 0x12061204, 0x12061202, 0x12008600, 0x12021206,
+    0x12021206, 0x12007E00, 0x12021206, 0x12021206, 0x12008E00, 0x12021206, 0x12021206, 0x12007E00,
+    0x12021206, 0x12021206, 0x18008E00, 0x12061204, 0x78001604, 0x12061200, 0x12061202, 0x8E001202,
+    0x12041800, 0x16041206, 0x12007800, 0x12021206, 0x12021206, 0x12008E00, 0x1206120A, 0x7600120A,
+    0x12021A00, 0x12021206, 0x12008E00, 0x1206120A, 0x7600120A, 0x12021A00, 0x12021206, 0x12008E00,
+    0x1206120A, 0x12061202, 0x12007600, 0x12021206, 0x12021206, 0x86001206, 0x120A1200, 0x12021206,
+    0x76001206, 0x12061200, 0x12061202, 0x12061202, 0x12008600, 0x1606160C, 0x12007800, 0x18021206,
+    0x88001606, 0x160C1200, 0x78001606, 0x12061200, 0x16061802, 0x21148800, 0x25012103, 0x23032302,
+    0x24042104, 0x17002501, 0x22012201, 0x21052101, 0x21012103, 0x21022103, 0x21022101, 0x21012103,
+    0x21011B00, 0x21012101, 0x21052101, 0x21052105, 0x21012103, 0x1B002105, 0x21012101, 0x24012101,
+    0x23032303, 0x21032102, 0x24052101, 0x21011800, 0x21012101, 0x21092101, 0x25012105, 0x22022101,
+    0x1B002101, 0x21032101, 0x21052101, 0x21012103, 0x21012103, 0x21012103, 0x21012103, 0x21011B00,
+    0x25012103, 0x23032302, 0x21032102, 0x25012402, 0x00524B00, 0x00000010, 0x00000000, 0x0000F800,
+    0x00000014, 0x00000001, 0x0000FFE0, 0x00000114, 0x00000000, 0x0000F800, 0x00000400, 0x00000001,
+    0x00000000, 0x00010400, 0x00000001, 0x000007E0, 0x00005055, 0x00000400, 0x00000002, 0x00000000,
+    0x00010400, 0x00000002, 0x000007E0, 0x4E574F44, 0x00000000, 0x00000400, 0x00000004, 0x00000000,
+    0x00010400, 0x00000004, 0x000007E0, 0x00000400, 0x00000008, 0x00000000, 0x00010400, 0x00000008,
+    0x000007E0, 0x00000016, 0x00000000, 0x00000000, 0x00000E90, 0x00000EA4, 0x00000EAC, 0x00000EB6,
+    0x00000EBA, 0x0001000D, 0x00000000, 0x00000000, 0x00010010, 0x00000000, 0x00008410, 0x0001000C,
+    0x00000000, 0x00000000, 0x00010010, 0x00000000, 0x00008410, 0x0001000F, 0x00000000, 0x00000000,
+    0x00010010, 0x00000000, 0x00008410,
+};
+
+#endif /* DASH_LAYOUT_H */
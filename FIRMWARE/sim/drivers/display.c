@@ -18,8 +18,8 @@
 // --- INCLUDES ---
 #include "display.h"      // Includes the public function declarations for this driver.
 #include "hal_display.h"  // Includes the HAL function declarations (e.g., hal_display_init, hal_display_present_1bpp).
+#include "mem_pool.h"     // Static pool of the framebuffer (no heap).
 #include <string.h>       // Includes standard C string/memory functions like memset, memcpy.
-#include <stdlib.h>       // Includes standard C library functions like malloc, free.
 #include <stdio.h>        // Includes standard I/O functions like snprintf (needed for display_draw_number).
 
 // --- STATIC VARIABLES ---
@@ -45,6 +45,10 @@ static uint8_t *g_fb = NULL;  /* Pointer to the framebuffer memory.
 // FB_SIZE_BYTES: Calculates the total size of the framebuffer in bytes.
 #define FB_SIZE_BYTES(w,h)  ((w) * (h) / 8) // width * height / 8 bits per byte
 
+// Framebuffer pool: sized for the panel at compile time, so display_init() can only
+// ask for a smaller or equal framebuffer.
+MEM_POOL_DEFINE(fb_pool, "display", FB_SIZE_BYTES(DISPLAY_WIDTH, DISPLAY_HEIGHT));
+
 /* --- STATIC HELPER FUNCTION --- */
 /**
  * @brief Sets or clears a pixel in the framebuffer.
@@ -238,18 +242,18 @@ int display_init(int width, int height, int scale)
 
     // Calculate required framebuffer size.
     size_t n = (size_t)FB_SIZE_BYTES(g_w, g_h);
-    // Allocate memory for the framebuffer. Free old one if exists.
-    if (g_fb) free(g_fb);
-    g_fb = (uint8_t*)malloc(n);
-    if (!g_fb) return -2; // Allocation failed.
+    // Take the framebuffer from its pool. Give back the old one if exists.
+    mem_pool_reset(&fb_pool);
+    g_fb = (uint8_t*)mem_pool_alloc(&fb_pool, (uint32_t)n);
+    if (!g_fb) return -2; // Larger than DISPLAY_WIDTH x DISPLAY_HEIGHT.
 
     // Initialize the framebuffer memory to all zeros (black).
     memset(g_fb, 0x00, n);
 
     // Initialize the hardware abstraction layer (e.g., SDL for the host simulation).
     if (hal_display_init(g_w, g_h, scale) != 0) {
-        // If HAL init fails, free the framebuffer memory we just allocated.
-        free(g_fb); g_fb = NULL;
+        // If HAL init fails, give back the framebuffer we just allocated.
+        mem_pool_reset(&fb_pool); g_fb = NULL;
         return -3; // Return HAL error code.
     }
     return 0; // Success.
@@ -258,8 +262,8 @@ int display_init(int width, int height, int scale)
 // display_shutdown: Releases resources used by the display driver and HAL.
 void display_shutdown(void)
 {
-    // Free the framebuffer memory if it was allocated.
-    if (g_fb) { free(g_fb); g_fb = NULL; }
+    // Give back the framebuffer if it was allocated.
+    if (g_fb) { mem_pool_reset(&fb_pool); g_fb = NULL; }
     // Call the HAL shutdown function (e.g., closes SDL window).
     hal_display_shutdown();
 }
@@ -40,13 +40,14 @@
  * @brief Initializes the display driver and underlying HAL.
  *
  * @details
- * Allocates memory for the framebuffer, initializes display dimensions,
+ * Takes the framebuffer from the "display" static pool (sized for
+ * DISPLAY_WIDTH x DISPLAY_HEIGHT), initializes display dimensions,
  * and sets up the hardware abstraction layer.
  *
  * @param[in] width Display width in pixels.
  * @param[in] height Display height in pixels (must be multiple of 8).
  * @param[in] scale Scaling factor for simulation environments (e.g., SDL window).
- * @return int 0 on success, negative value on failure.
+ * @return int 0 on success, -1 invalid size, -2 larger than the pool, -3 HAL error.
  */
 int  display_init(int width, int height, int scale);
 
@@ -54,7 +55,7 @@ int  display_init(int width, int height, int scale);
  * @brief Shuts down the display driver and releases allocated resources.
  *
  * @details
- * Frees framebuffer memory and calls HAL shutdown routines.
+ * Gives the framebuffer back to its pool and calls HAL shutdown routines.
  * Should be invoked once when the application terminates.
  */
 void display_shutdown(void);
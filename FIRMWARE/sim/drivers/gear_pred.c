@@ -0,0 +1,111 @@
+/**
+ * @file gear_pred.c
+ * @brief Implementation of the optimistic gear display.
+ */
+
+#include "gear_pred.h"
+#include <string.h>
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static uint8_t  max_gear = 0;
+static uint32_t timeout_us = 0;
+
+static uint8_t  confirmed = 0;      /* Last Gear_Actual */
+static bool     pending = false;
+static uint8_t  from_gear = 0;      /* Gear_Actual at the first press of the pending shift */
+static uint8_t  target_gear = 0;    /* Predicted gear */
+static uint32_t press_us = 0;       /* Last press */
+
+static GearPredStats_t stats;
+
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+/** @brief Records the latency of a confirmed prediction. */
+static void record_latency(uint32_t lat_us) {
+    stats.confirmed++;
+    stats.lat_last_us = lat_us;
+    if (stats.confirmed == 1u) {
+        stats.lat_min_us = lat_us;
+        stats.lat_max_us = lat_us;
+        stats.lat_avg_us = lat_us;
+        return;
+    }
+    if (lat_us < stats.lat_min_us) stats.lat_min_us = lat_us;
+    if (lat_us > stats.lat_max_us) stats.lat_max_us = lat_us;
+    stats.lat_avg_us = stats.lat_avg_us - (stats.lat_avg_us >> 3) + (lat_us >> 3);
+}
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void gear_pred_init(uint8_t max, uint32_t timeout_ms) {
+    max_gear = max;
+    timeout_us = timeout_ms * 1000u;
+    confirmed = 0;
+    pending = false;
+    memset(&stats, 0, sizeof(stats));
+}
+
+void gear_pred_setTimeout(uint32_t timeout_ms) {
+    timeout_us = timeout_ms * 1000u;
+}
+
+bool gear_pred_shift(int8_t dir, uint32_t now_us) {
+    uint8_t base = pending ? target_gear : confirmed;
+    uint8_t next = base;
+
+    if (dir > 0 && base < max_gear) next = base + 1u;
+    if (dir < 0 && base > 0u)       next = base - 1u;
+    if (next == base) return false;
+
+    if (!pending) from_gear = confirmed;
+    target_gear = next;
+    pending = true;
+    press_us = now_us;
+    stats.predictions++;
+    return true;
+}
+
+void gear_pred_ecu(uint8_t gear_actual, uint32_t rx_us) {
+    confirmed = gear_actual;
+    if (!pending || (int32_t)(rx_us - press_us) < 0) return;   /* Frame older than the press */
+
+    if (gear_actual == target_gear) {
+        pending = false;
+        record_latency(rx_us - press_us);
+        return;
+    }
+
+    /* Not shifted yet, or part way through a multi-press shift */
+    uint8_t lo = (from_gear < target_gear) ? from_gear : target_gear;
+    uint8_t hi = (from_gear < target_gear) ? target_gear : from_gear;
+    if (gear_actual >= lo && gear_actual <= hi) return;
+
+    pending = false;                /* Roll back to Gear_Actual */
+    stats.mismatches++;
+}
+
+void gear_pred_update(uint32_t now_us) {
+    if (pending && (now_us - press_us) > timeout_us) {
+        pending = false;            /* Roll back to the last Gear_Actual */
+        stats.timeouts++;
+    }
+}
+
+uint8_t gear_pred_shown(void) {
+    return pending ? target_gear : confirmed;
+}
+
+bool gear_pred_isPending(void) {
+    return pending;
+}
+
+void gear_pred_getStats(GearPredStats_t *out) {
+    *out = stats;
+}
+
+void gear_pred_resetStats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,112 @@
+/**
+ * @file gear_pred.h
+ * @brief Optimistic gear display: predicted gear on a paddle press, reconciled with the ECU.
+ *
+ * @details
+ * Without prediction the displayed gear changes only when ECU_Status_Display
+ * echoes Gear_Actual, i.e. after the debounce, the CAN round trip and the ECU
+ * cycle. A debounced UP/DOWN press (::gear_pred_shift) moves the displayed gear
+ * at once and marks it pending; the ECU frames then reconcile it
+ * (::gear_pred_ecu):
+ *
+ * - Gear_Actual equal to the predicted gear: confirmed, the latency from the
+ *   press to the receive timestamp of the frame is recorded.
+ * - Gear_Actual still between the gear before the first press and the
+ *   predicted gear (the ECU has not shifted yet, or is shifting through
+ *   several presses): still pending.
+ * - Any other gear: mismatch, the display rolls back to Gear_Actual.
+ *
+ * A prediction not confirmed within the timeout after the last press rolls
+ * back to the last Gear_Actual (::gear_pred_update). Frames received before
+ * the press are not used to reconcile it.
+ *
+ * All times are in the HAL receive timebase (::hal_can_get_time_us), so the
+ * latency compares the press with the bus arrival of the confirming frame.
+ * Gear 0 is neutral.
+ */
+
+#ifndef GEAR_PRED_H
+#define GEAR_PRED_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Prediction counters and press-to-confirmation latency.
+ */
+typedef struct {
+    uint32_t predictions;       /**< Presses that moved the displayed gear. */
+    uint32_t confirmed;         /**< Predictions confirmed by Gear_Actual. */
+    uint32_t mismatches;        /**< Rolled back: Gear_Actual outside the predicted shift. */
+    uint32_t timeouts;          /**< Rolled back: no confirmation within the timeout. */
+    uint32_t lat_last_us;       /**< Latency of the last confirmation. */
+    uint32_t lat_min_us;        /**< Shortest latency (0 before the first confirmation). */
+    uint32_t lat_max_us;        /**< Longest latency. */
+    uint32_t lat_avg_us;        /**< Average latency (exponential, 1/8 weight). */
+} GearPredStats_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Initializes the prediction: neutral, nothing pending, counters cleared.
+ *
+ * @param[in] max_gear   Highest gear (the DBC range of Gear_Actual).
+ * @param[in] timeout_ms Time after the last press before a prediction is rolled back.
+ */
+void gear_pred_init(uint8_t max_gear, uint32_t timeout_ms);
+
+/**
+ * @brief Changes the confirmation timeout (applies to the pending prediction too).
+ */
+void gear_pred_setTimeout(uint32_t timeout_ms);
+
+/**
+ * @brief Predicts a shift from a debounced paddle press.
+ *
+ * @param[in] dir    +1 for UP, -1 for DOWN.
+ * @param[in] now_us Press time.
+ * @return bool true if the displayed gear moved (false at neutral / top gear).
+ */
+bool gear_pred_shift(int8_t dir, uint32_t now_us);
+
+/**
+ * @brief Reconciles with the gear reported by the ECU.
+ *
+ * @param[in] gear_actual Gear_Actual of the frame.
+ * @param[in] rx_us       Receive timestamp of the frame.
+ */
+void gear_pred_ecu(uint8_t gear_actual, uint32_t rx_us);
+
+/**
+ * @brief Rolls back a prediction older than the timeout.
+ *
+ * @param[in] now_us Current time.
+ */
+void gear_pred_update(uint32_t now_us);
+
+/**
+ * @brief Gear to display: the predicted gear while pending, else the last Gear_Actual.
+ */
+uint8_t gear_pred_shown(void);
+
+/**
+ * @brief Returns true while the displayed gear waits for the ECU confirmation.
+ */
+bool gear_pred_isPending(void);
+
+/**
+ * @brief Returns the prediction counters and latency.
+ *
+ * @param[out] stats Destination structure.
+ */
+void gear_pred_getStats(GearPredStats_t *stats);
+
+/**
+ * @brief Clears the counters and latency (the prediction state is kept).
+ */
+void gear_pred_resetStats(void);
+
+#endif /* GEAR_PRED_H */
@@ -0,0 +1,445 @@
+/**
+ * @file isotp.c
+ * @brief Implementation of the ISO-TP transport.
+ *
+ * @details
+ * One receive and one transmit state machine share the ID pair, so the link
+ * is full duplex: a flow control for our transmission may arrive between
+ * consecutive frames of a reception. All deadlines are in the HAL CAN
+ * timebase (::hal_can_get_time_us) and compared wrap-safe.
+ */
+
+#include "isotp.h"
+#include <stddef.h>            /* For NULL */
+#include <string.h>
+
+/*--------------------------PROTOCOL CONSTANTS-----------------------------------*/
+
+/* Protocol control information: frame type in the high nibble of byte 0 */
+#define PCI_SF          0x00u
+#define PCI_FF          0x10u
+#define PCI_CF          0x20u
+#define PCI_FC          0x30u
+
+/* Flow status */
+#define FS_CTS          0x00u
+#define FS_WAIT         0x01u
+#define FS_OVFLW        0x02u
+
+#define SF_MAX          7u          /**< Payload of a single frame. */
+#define FF_DL_MAX       4095u       /**< Largest length of a 12-bit first frame. */
+#define CF_PAYLOAD      7u          /**< Payload of a consecutive frame. */
+
+/*--------------------------PRIVATE TYPES-----------------------------------*/
+
+typedef enum {
+    RX_IDLE,                /**< No buffer armed. */
+    RX_ARMED,               /**< Waiting for a single or first frame. */
+    RX_RECEIVING,           /**< Waiting for consecutive frames. */
+    RX_DONE                 /**< Message in the buffer, not yet collected. */
+} rx_state_t;
+
+typedef enum {
+    TX_IDLE,
+    TX_FIRST,               /**< Single / first frame not yet accepted by the HAL. */
+    TX_WAIT_FC,             /**< Waiting for a flow control. */
+    TX_SENDING              /**< Sending consecutive frames. */
+} tx_state_t;
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static IsoTpConfig_t cfg;
+static IsoTpStats_t stats;
+
+/* --- Receive --- */
+static rx_state_t rx_state = RX_IDLE;
+static uint8_t   *rx_buf = NULL;
+static uint32_t   rx_size = 0;      /**< Armed buffer size. */
+static uint32_t   rx_len = 0;       /**< Announced message length. */
+static uint32_t   rx_pos = 0;       /**< Bytes received. */
+static uint8_t    rx_sn = 0;        /**< Expected sequence number. */
+static uint8_t    rx_block = 0;     /**< Consecutive frames received in the current block. */
+static uint32_t   rx_deadline = 0;  /**< N_Cr deadline. */
+static int16_t    fc_pending = -1;  /**< Flow status still to send (HAL was full), -1: none. */
+static hal_can_frame_t ff_held;     /**< First frame received while no buffer was armed. */
+static bool       ff_waiting = false;   /**< ff_held is answered with FC.WAIT until a buffer is armed. */
+static uint8_t    ff_wft = 0;       /**< FC.WAIT sent for ff_held. */
+static uint32_t   ff_wait_next = 0; /**< Time of the next FC.WAIT. */
+
+/* --- Transmit --- */
+static tx_state_t     tx_state = TX_IDLE;
+static IsoTpResult_t  tx_result = ISOTP_OK;
+static const uint8_t *tx_data = NULL;
+static uint32_t       tx_len = 0;
+static uint32_t       tx_pos = 0;       /**< Bytes sent. */
+static uint8_t        tx_sn = 0;        /**< Next sequence number. */
+static uint8_t        tx_bs = 0;        /**< Receiver block size (0: no limit). */
+static uint8_t        tx_block = 0;     /**< Consecutive frames sent in the current block. */
+static uint32_t       tx_stmin_us = 0;  /**< Receiver STmin. */
+static uint32_t       tx_next_us = 0;   /**< Earliest time for the next consecutive frame. */
+static uint32_t       tx_deadline = 0;  /**< N_Bs deadline. */
+static uint8_t        tx_wft = 0;       /**< FC.WAIT received in a row. */
+
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+/** @brief True once @p deadline has passed (wrap-safe). */
+static bool expired(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+/** @brief Converts an STmin byte to microseconds (reserved values mean 127 ms). */
+static uint32_t stmin_us(uint8_t st) {
+    if (st <= 0x7Fu) return (uint32_t)st * 1000u;
+    if (st >= 0xF1u && st <= 0xF9u) return (uint32_t)(st - 0xF0u) * 100u;
+    return 127000u;
+}
+
+/** @brief Fills a frame header and the padding. */
+static void frame_init(hal_can_frame_t *f) {
+    f->id = ISOTP_TX_ID;
+    f->len = 8;
+    f->timestamp_us = 0;
+    memset(f->data, cfg.padding, sizeof(f->data));
+}
+
+/** @brief Sends a flow control; remembered for ::isotp_poll if the HAL is full. */
+static void send_fc(uint8_t fs) {
+    hal_can_frame_t f;
+    frame_init(&f);
+    f.data[0] = (uint8_t)(PCI_FC | fs);
+    f.data[1] = (fs == FS_CTS) ? cfg.block_size : 0u;
+    f.data[2] = (fs == FS_CTS) ? cfg.st_min : 0u;
+    fc_pending = (hal_can_send_frames(&f, 1) == 1) ? -1 : (int16_t)fs;
+}
+
+/** @brief Aborts the current reception; the buffer stays armed. */
+static void rx_abort(IsoTpResult_t why) {
+    stats.rx_errors++;
+    stats.rx_last_error = (uint8_t)why;
+    rx_state = RX_ARMED;
+}
+
+/** @brief Ends the current transmission. */
+static void tx_end(IsoTpResult_t result) {
+    if (result == ISOTP_OK) {
+        stats.tx_msgs++;
+        stats.tx_bytes += tx_len;
+    } else {
+        stats.tx_errors++;
+    }
+    tx_result = result;
+    tx_state = TX_IDLE;
+}
+
+/** @brief Queues the single or first frame of the current transmission. */
+static void tx_first(void) {
+    hal_can_frame_t f;
+    uint8_t hdr;
+
+    frame_init(&f);
+    if (tx_len <= SF_MAX) {
+        f.data[0] = (uint8_t)(PCI_SF | tx_len);
+        memcpy(&f.data[1], tx_data, tx_len);
+        if (hal_can_send_frames(&f, 1) == 1) tx_end(ISOTP_OK);
+        return;
+    }
+
+    if (tx_len <= FF_DL_MAX) {
+        f.data[0] = (uint8_t)(PCI_FF | (tx_len >> 8));
+        f.data[1] = (uint8_t)(tx_len & 0xFFu);
+        hdr = 2;
+    } else {
+        /* Escape sequence: FF_DL = 0, then the 32-bit length (big endian) */
+        f.data[0] = PCI_FF;
+        f.data[1] = 0;
+        f.data[2] = (uint8_t)(tx_len >> 24);
+        f.data[3] = (uint8_t)(tx_len >> 16);
+        f.data[4] = (uint8_t)(tx_len >> 8);
+        f.data[5] = (uint8_t)(tx_len);
+        hdr = 6;
+    }
+    memcpy(&f.data[hdr], tx_data, 8u - hdr);
+    if (hal_can_send_frames(&f, 1) != 1) return;     /* Retried by isotp_poll */
+
+    tx_pos = 8u - hdr;
+    tx_sn = 1;
+    tx_wft = 0;
+    tx_state = TX_WAIT_FC;
+    tx_deadline = hal_can_get_time_us() + (uint32_t)cfg.n_bs_ms * 1000u;
+}
+
+/** @brief Queues the consecutive frames that the receiver and the HAL allow now. */
+static void tx_consecutive(uint32_t now) {
+    hal_can_frame_t burst[ISOTP_TX_BURST];
+    uint8_t n = 0;
+    int room;
+
+    if (!expired(now, tx_next_us)) return;
+
+    /* Only as many frames as the transmit path keeps in order; with STmin one at a time */
+    room = hal_can_tx_free();
+    if (room > (int)ISOTP_TX_BURST) room = ISOTP_TX_BURST;
+    if (tx_stmin_us > 0u && room > 1) room = 1;
+    if (tx_bs != 0u && room > (int)(tx_bs - tx_block)) room = tx_bs - tx_block;
+
+    uint32_t pos = tx_pos;
+    uint8_t sn = tx_sn;
+    while (n < room && pos < tx_len) {
+        uint32_t chunk = tx_len - pos;
+        if (chunk > CF_PAYLOAD) chunk = CF_PAYLOAD;
+
+        frame_init(&burst[n]);
+        burst[n].data[0] = (uint8_t)(PCI_CF | sn);
+        memcpy(&burst[n].data[1], &tx_data[pos], chunk);
+        pos += chunk;
+        sn = (uint8_t)((sn + 1u) & 0x0Fu);
+        n++;
+    }
+    if (n == 0u) return;
+
+    int sent = hal_can_send_frames(burst, n);
+    if (sent <= 0) return;
+
+    /* Advance by what the HAL accepted; the rest is rebuilt next time */
+    for (int i = 0; i < sent; i++) {
+        uint32_t chunk = tx_len - tx_pos;
+        tx_pos += (chunk > CF_PAYLOAD) ? CF_PAYLOAD : chunk;
+    }
+    tx_sn = (uint8_t)((tx_sn + sent) & 0x0Fu);
+    tx_next_us = now + tx_stmin_us;
+
+    if (tx_pos >= tx_len) {
+        tx_end(ISOTP_OK);
+        return;
+    }
+    if (tx_bs != 0u) {
+        tx_block = (uint8_t)(tx_block + sent);
+        if (tx_block >= tx_bs) {
+            tx_state = TX_WAIT_FC;
+            tx_deadline = now + (uint32_t)cfg.n_bs_ms * 1000u;
+        }
+    }
+}
+
+/** @brief Handles a flow control for our transmission. */
+static void on_fc(const hal_can_frame_t *f) {
+    if (tx_state != TX_WAIT_FC) return;          /* Unexpected FC: ignored */
+
+    switch (f->data[0] & 0x0Fu) {
+    case FS_CTS:
+        tx_bs = f->data[1];
+        tx_block = 0;
+        tx_stmin_us = stmin_us(f->data[2]);
+        tx_next_us = f->timestamp_us;
+        tx_wft = 0;
+        tx_state = TX_SENDING;
+        break;
+    case FS_WAIT:
+        if (++tx_wft > cfg.wft_max) tx_end(ISOTP_ERR_WFT);
+        else tx_deadline = hal_can_get_time_us() + (uint32_t)cfg.n_bs_ms * 1000u;
+        break;
+    case FS_OVFLW:
+        tx_end(ISOTP_ERR_OVERFLOW);
+        break;
+    default:
+        tx_end(ISOTP_ERR_SEQUENCE);
+        break;
+    }
+}
+
+/** @brief Handles a single or first frame from the tester. */
+static void on_first(const hal_can_frame_t *f, uint8_t pci) {
+    uint32_t len;
+    uint8_t hdr;
+
+    /* A new message replaces an unfinished one */
+    if (rx_state == RX_RECEIVING) rx_abort(ISOTP_ERR_SEQUENCE);
+
+    if (pci == PCI_SF) {
+        len = f->data[0] & 0x0Fu;
+        if (len == 0u || len > SF_MAX || len > f->len - 1u) return;   /* Invalid (or CAN FD escape) */
+        if (rx_state != RX_ARMED || len > rx_size) {
+            stats.rx_errors++;                   /* No room: a single frame cannot be refused */
+            stats.rx_last_error = ISOTP_ERR_OVERFLOW;
+            return;
+        }
+        memcpy(rx_buf, &f->data[1], len);
+        rx_len = rx_pos = len;
+        rx_state = RX_DONE;
+        return;
+    }
+
+    if (f->len < 8u) return;                     /* First frames are always full */
+    len = ((uint32_t)(f->data[0] & 0x0Fu) << 8) | f->data[1];
+    hdr = 2;
+    if (len == 0u) {
+        len = ((uint32_t)f->data[2] << 24) | ((uint32_t)f->data[3] << 16) |
+              ((uint32_t)f->data[4] << 8)  |  (uint32_t)f->data[5];
+        hdr = 6;
+    }
+    if (len <= (uint32_t)(8u - hdr)) return;     /* Would have fitted a smaller frame */
+
+    if (rx_state == RX_IDLE || rx_state == RX_DONE) {
+        /* Buffer still with the application: hold the frame and ask the tester to wait */
+        ff_held = *f;
+        ff_waiting = true;
+        ff_wft = 0;
+        ff_wait_next = hal_can_get_time_us() + (uint32_t)cfg.n_bs_ms * 500u;
+        send_fc(FS_WAIT);
+        return;
+    }
+    if (len > rx_size) {
+        send_fc(FS_OVFLW);
+        stats.rx_errors++;
+        stats.rx_last_error = ISOTP_ERR_OVERFLOW;
+        return;
+    }
+
+    memcpy(rx_buf, &f->data[hdr], 8u - hdr);
+    rx_len = len;
+    rx_pos = 8u - hdr;
+    rx_sn = 1;
+    rx_block = 0;
+    rx_state = RX_RECEIVING;
+    rx_deadline = hal_can_get_time_us() + (uint32_t)cfg.n_cr_ms * 1000u;
+    send_fc(FS_CTS);
+}
+
+/** @brief Handles a consecutive frame from the tester. */
+static void on_cf(const hal_can_frame_t *f) {
+    if (rx_state != RX_RECEIVING) return;        /* Not expecting one: ignored */
+
+    if ((f->data[0] & 0x0Fu) != rx_sn) {
+        rx_abort(ISOTP_ERR_SEQUENCE);
+        return;
+    }
+
+    uint32_t chunk = rx_len - rx_pos;
+    if (chunk > CF_PAYLOAD) chunk = CF_PAYLOAD;
+    if (chunk > (uint32_t)(f->len - 1u)) {
+        rx_abort(ISOTP_ERR_SEQUENCE);            /* Truncated frame */
+        return;
+    }
+    memcpy(&rx_buf[rx_pos], &f->data[1], chunk);    /* Straight into the caller's buffer */
+    rx_pos += chunk;
+    rx_sn = (uint8_t)((rx_sn + 1u) & 0x0Fu);
+
+    if (rx_pos >= rx_len) {
+        rx_state = RX_DONE;
+        return;
+    }
+
+    rx_deadline = f->timestamp_us + (uint32_t)cfg.n_cr_ms * 1000u;
+    if (cfg.block_size != 0u && ++rx_block >= cfg.block_size) {
+        rx_block = 0;
+        send_fc(FS_CTS);
+    }
+}
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void isotp_init(const IsoTpConfig_t *config) {
+    cfg = *config;
+    memset(&stats, 0, sizeof(stats));
+    rx_state = RX_IDLE;
+    rx_buf = NULL;
+    rx_size = 0;
+    fc_pending = -1;
+    ff_waiting = false;
+    tx_state = TX_IDLE;
+    tx_result = ISOTP_OK;
+}
+
+void isotp_rx_arm(uint8_t *buf, uint32_t size) {
+    rx_buf = buf;
+    rx_size = (buf != NULL) ? size : 0u;
+    rx_state = (buf != NULL) ? RX_ARMED : RX_IDLE;
+
+    /* A first frame held meanwhile is accepted (or refused) now */
+    if (ff_waiting && rx_state == RX_ARMED) {
+        ff_waiting = false;
+        on_first(&ff_held, PCI_FF);
+    }
+}
+
+int isotp_rx_get(uint32_t *len) {
+    if (rx_state != RX_DONE) return 0;
+
+    stats.rx_msgs++;
+    stats.rx_bytes += rx_len;
+    if (len != NULL) *len = rx_len;
+    rx_state = RX_IDLE;                          /* Buffer handed back to the caller */
+    return 1;
+}
+
+int isotp_send(const uint8_t *data, uint32_t len) {
+    if (tx_state != TX_IDLE) return -1;
+    if (len == 0u || data == NULL) return -2;
+
+    tx_data = data;
+    tx_len = len;
+    tx_pos = 0;
+    tx_result = ISOTP_BUSY;
+    tx_state = TX_FIRST;
+    tx_first();
+    return 0;
+}
+
+IsoTpResult_t isotp_tx_result(void) {
+    return tx_result;
+}
+
+void isotp_on_frame(const hal_can_frame_t *frame) {
+    uint8_t pci = frame->data[0] & 0xF0u;
+
+    switch (pci) {
+    case PCI_SF:
+    case PCI_FF: on_first(frame, pci); break;
+    case PCI_CF: on_cf(frame); break;
+    case PCI_FC: on_fc(frame); break;
+    default: break;                              /* Reserved frame types are ignored */
+    }
+}
+
+void isotp_poll(void) {
+    uint32_t now = hal_can_get_time_us();
+
+    if (fc_pending >= 0) send_fc((uint8_t)fc_pending);
+
+    /* Keep a held first frame alive with FC.WAIT (half of N_Bs), up to wft_max times */
+    if (ff_waiting && expired(now, ff_wait_next)) {
+        if (++ff_wft > cfg.wft_max) {
+            ff_waiting = false;
+            send_fc(FS_OVFLW);
+            stats.rx_errors++;
+            stats.rx_last_error = ISOTP_ERR_WFT;
+        } else {
+            ff_wait_next = now + (uint32_t)cfg.n_bs_ms * 500u;
+            send_fc(FS_WAIT);
+        }
+    }
+
+    if (rx_state == RX_RECEIVING && expired(now, rx_deadline)) {
+        rx_abort(ISOTP_ERR_TIMEOUT);
+    }
+
+    switch (tx_state) {
+    case TX_FIRST:
+        tx_first();
+        break;
+    case TX_WAIT_FC:
+        if (expired(now, tx_deadline)) tx_end(ISOTP_ERR_TIMEOUT);
+        break;
+    case TX_SENDING:
+        tx_consecutive(now);
+        break;
+    default:
+        break;
+    }
+}
+
+void isotp_getStats(IsoTpStats_t *out) {
+    if (out != NULL) *out = stats;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file isotp.h
+ * @brief ISO 15765-2 (ISO-TP) transport: messages longer than one CAN frame.
+ *
+ * @details
+ * Carries display layouts, calibration tables and assets between a tester
+ * (PC tool at the track) and the wheel over one pair of CAN IDs:
+ * ::ISOTP_RX_ID (tester -> wheel) and ::ISOTP_TX_ID (wheel -> tester).
+ *
+ * - **Segmentation**: single frame (<= 7 bytes), first frame + consecutive
+ *   frames up to 4095 bytes, and the 32-bit first frame escape above that.
+ *   Frames are always sent with 8 bytes (padding ::IsoTpConfig_t::padding).
+ * - **Flow control**: the wheel advertises its block size (BS) and minimum
+ *   separation time (STmin) when receiving, and honours the peer's BS, STmin
+ *   and FC.WAIT / FC.OVFLW when sending.
+ * - **Timeouts**: N_Bs (waiting for a flow control) and N_Cr (waiting for the
+ *   next consecutive frame) are configurable; an expired transfer is aborted.
+ *
+ * Nothing blocks. Frames from the tester are handed over by the CAN receive
+ * dispatch (::isotp_on_frame); ::isotp_poll sends the pending consecutive
+ * frames and evaluates the timeouts. To use the whole bus during a bulk
+ * transfer, call both (through `CAN_Poll()`) from the idle part of the
+ * main-loop slot as well: every call queues a burst of up to
+ * ::ISOTP_TX_BURST frames, as many as the transmit path can take in order.
+ *
+ * Receive is zero-copy: the payload is written directly into the buffer armed
+ * with ::isotp_rx_arm and handed back by ::isotp_rx_get. Transmit is
+ * zero-copy too: the data passed to ::isotp_send is read in place until the
+ * transfer ends.
+ */
+
+#ifndef ISOTP_H
+#define ISOTP_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal_can.h"
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define ISOTP_RX_ID       0x7E4u  /**< Frames from the tester (data, and flow control for our transfers). */
+#define ISOTP_TX_ID       0x7ECu  /**< Frames from the wheel (data, and flow control for the tester). */
+
+#define ISOTP_TX_BURST    8u      /**< Consecutive frames queued per ::isotp_poll call at most. */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Transfer result.
+ */
+typedef enum {
+    ISOTP_OK = 0,           /**< Transfer complete. */
+    ISOTP_BUSY,             /**< Transfer in progress. */
+    ISOTP_ERR_TIMEOUT,      /**< N_Bs or N_Cr expired. */
+    ISOTP_ERR_SEQUENCE,     /**< Wrong sequence number or unexpected frame. */
+    ISOTP_ERR_OVERFLOW,     /**< Message larger than the receive buffer (FC.OVFLW). */
+    ISOTP_ERR_WFT           /**< Receiver sent more FC.WAIT than ::IsoTpConfig_t::wft_max. */
+} IsoTpResult_t;
+
+/**
+ * @brief Link parameters.
+ */
+typedef struct {
+    uint8_t  block_size;    /**< BS advertised when receiving (0: whole message without further FC). */
+    uint8_t  st_min;        /**< STmin advertised when receiving (0-127 ms, 0xF1-0xF9: 100-900 µs). */
+    uint8_t  wft_max;       /**< FC.WAIT accepted from the receiver before aborting a transmission. */
+    uint8_t  padding;       /**< Fill byte of short frames. */
+    uint16_t n_bs_ms;       /**< Timeout for a flow control after a first frame or a block. */
+    uint16_t n_cr_ms;       /**< Timeout for the next consecutive frame. */
+} IsoTpConfig_t;
+
+/**
+ * @brief Link counters (diagnostics).
+ */
+typedef struct {
+    uint32_t rx_msgs;       /**< Messages received. */
+    uint32_t rx_bytes;      /**< Payload bytes received. */
+    uint32_t tx_msgs;       /**< Messages sent. */
+    uint32_t tx_bytes;      /**< Payload bytes sent. */
+    uint32_t rx_errors;     /**< Receptions aborted (timeout, sequence, overflow, not armed). */
+    uint32_t tx_errors;     /**< Transmissions aborted. */
+    uint8_t  rx_last_error; /**< Result of the last aborted reception (::IsoTpResult_t). */
+} IsoTpStats_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Initializes the link (no buffer armed, nothing to send).
+ *
+ * @param[in] cfg Link parameters (copied).
+ */
+void isotp_init(const IsoTpConfig_t *cfg);
+
+/**
+ * @brief Arms reception into a caller buffer.
+ *
+ * @details
+ * The buffer belongs to the link until ::isotp_rx_get returns a message. A
+ * first frame announcing more than @p size bytes is refused with FC.OVFLW.
+ * A first frame arriving while no buffer is armed is held and answered with
+ * FC.WAIT (every N_Bs / 2, ::IsoTpConfig_t::wft_max times at most) until the
+ * next call; a single frame arriving then is lost.
+ *
+ * @param[in] buf  Destination buffer.
+ * @param[in] size Buffer size in bytes.
+ */
+void isotp_rx_arm(uint8_t *buf, uint32_t size);
+
+/**
+ * @brief Returns a received message.
+ *
+ * @details
+ * On success the buffer is handed back to the caller and the link is
+ * disarmed: call ::isotp_rx_arm again to receive the next message.
+ *
+ * @param[out] len Message length.
+ * @return int 1 if a complete message is in the buffer, 0 otherwise.
+ */
+int isotp_rx_get(uint32_t *len);
+
+/**
+ * @brief Starts sending a message.
+ *
+ * @param[in] data Payload; must stay valid and unchanged until the transfer ends.
+ * @param[in] len  Payload length (1 to 2^32 - 1 bytes).
+ * @return int 0 if started, -1 if a transmission is in progress, -2 if @p len is 0.
+ */
+int isotp_send(const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Returns the state of the current or last transmission.
+ *
+ * @return IsoTpResult_t ::ISOTP_BUSY while in progress, then the final result.
+ */
+IsoTpResult_t isotp_tx_result(void);
+
+/**
+ * @brief Processes one frame received on ::ISOTP_RX_ID (called by the CAN dispatch).
+ *
+ * @param[in] frame Received frame.
+ */
+void isotp_on_frame(const hal_can_frame_t *frame);
+
+/**
+ * @brief Sends pending frames and evaluates the timeouts.
+ *
+ * @details
+ * Call at least once per main-loop slot; more often (slot idle time) for
+ * bulk transfers.
+ */
+void isotp_poll(void);
+
+/**
+ * @brief Returns the link counters.
+ *
+ * @param[out] stats Destination structure.
+ */
+void isotp_getStats(IsoTpStats_t *stats);
+
+#endif /* ISOTP_H */
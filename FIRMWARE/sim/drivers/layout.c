@@ -0,0 +1,354 @@
+/**
+ * @file layout.c
+ * @brief Implementation of the dashboard layout blob: checks, widgets, download.
+ */
+
+#include "layout.h"
+#include "trend.h"
+#include "TFT_LCD.h"
+#include "hal_flash.h"
+#include <stddef.h>
+#include <string.h>
+
+/*--------------------------PROTOCOL CONSTANTS-----------------------------------*/
+
+/* UDS services of the download, as for the bootloader (bootloader.h) */
+#define SID_DOWNLOAD        0x34u
+#define SID_TRANSFER        0x36u
+#define SID_EXIT            0x37u
+#define SID_NEGATIVE        0x7Fu
+#define POSITIVE(sid)       ((uint8_t)((sid) + 0x40u))
+
+#define NRC_LENGTH          0x13u   /**< incorrectMessageLengthOrInvalidFormat */
+#define NRC_SEQUENCE        0x24u   /**< requestSequenceError */
+#define NRC_RANGE           0x31u   /**< requestOutOfRange */
+#define NRC_PROGRAMMING     0x72u   /**< generalProgrammingFailure */
+#define NRC_BLOCK_SEQUENCE  0x73u   /**< wrongBlockSequenceCounter */
+
+#define DOWNLOAD_FORMAT     0x44u
+
+#define NUMBER_CHARS        24u     /**< Longest number text (prefix, value, suffix). */
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static bool     dl_active = false;
+static uint32_t dl_size = 0;            /**< Announced blob size. */
+static uint32_t dl_offset = 0;          /**< Bytes written. */
+static uint8_t  dl_seq = 1;             /**< Expected block sequence counter. */
+static uint32_t dl_block = 0;           /**< TransferData payload announced to the tester. */
+static uint32_t erased_end = 0;         /**< Sectors below this address are erased. */
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+static uint32_t rd32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+/** @brief true if [off, off + len) is inside the blob and off is a multiple of align. */
+static bool in_blob(uint32_t size, uint32_t off, uint32_t len, uint32_t align) {
+    return (off % align) == 0u && off <= size && len <= size - off;
+}
+
+/** @brief true if a NUL-terminated ASCII string starts at off. */
+static bool string_ok(const uint8_t *blob, uint32_t size, uint32_t off) {
+    for (uint32_t i = off; i < size; i++) {
+        if (blob[i] == 0u) return true;
+        if (blob[i] >= 0x80u) return false;     /* LCD_draw_char indexes the font with int8_t */
+    }
+    return false;
+}
+
+static bool widget_ok(const uint8_t *blob, const LayoutHeader_t *h, const LayoutWidget_t *w) {
+    uint32_t size = h->size;
+
+    if (w->type >= LAYOUT_TYPES || w->size == 0u) return false;
+    if (w->signal != LAYOUT_NO_SIGNAL && w->signal >= h->sig_count) return false;
+    if (w->signal == LAYOUT_NO_SIGNAL && w->type != LAYOUT_LABEL) return false;
+    if (!in_blob(size, w->rules, (uint32_t)w->rule_count * sizeof(LayoutRule_t), 4u)) return false;
+
+    const LayoutRule_t *r = (const LayoutRule_t *)(blob + w->rules);
+    for (uint8_t i = 0; i < w->rule_count; i++) {
+        if (r[i].signal >= h->sig_count || r[i].op >= LAYOUT_OPS || r[i].target > LAYOUT_BG) return false;
+    }
+
+    switch (w->type) {
+        case LAYOUT_LABEL:
+            return string_ok(blob, size, w->text);
+        case LAYOUT_NUMBER:
+            if (w->a <= 0 || w->b < 0 || w->b > 3) return false;
+            return string_ok(blob, size, w->text) && (w->suffix == 0u || string_ok(blob, size, w->suffix));
+        case LAYOUT_TEXT:
+            if (w->a <= 0 || !in_blob(size, w->text, (uint32_t)w->a * 4u, 4u)) return false;
+            for (int32_t i = 0; i < w->a; i++) {
+                if (!string_ok(blob, size, ((const uint32_t *)(blob + w->text))[i])) return false;
+            }
+            return true;
+        case LAYOUT_BAR:
+            return w->b > w->a && w->rw > 0;
+        case LAYOUT_TREND:
+            /* One column per x, inside the screen; a scrolled band spans the full height */
+            if (w->b <= w->a || w->c <= 0 || w->rule_count != 0u || w->rw < 2 || w->rh < 2) return false;
+            if (w->rx < 0 || w->ry < 0 || w->rx + w->rw > TFT_HEIGHT || w->ry + w->rh > TFT_WIDTH) return false;
+            return (w->flags & LAYOUT_F_SCROLL) == 0u || (w->ry == 0 && w->rh == TFT_WIDTH);
+        default:    /* LAYOUT_DOT */
+            return w->a > 0;
+    }
+}
+
+/** @brief Color of a widget: first matching rule for this target, else @p dflt. */
+static uint16_t widget_color(const uint8_t *blob, const LayoutWidget_t *w, uint8_t target, uint16_t dflt) {
+    const LayoutRule_t *r = (const LayoutRule_t *)(blob + w->rules);
+
+    for (uint8_t i = 0; i < w->rule_count; i++, r++) {
+        if (r->target != target) continue;
+        int32_t v = sig_get_i32(r->signal);
+        bool match;
+        switch (r->op) {
+            case LAYOUT_EQ: match = (v == r->value); break;
+            case LAYOUT_NE: match = (v != r->value); break;
+            case LAYOUT_GT: match = (v > r->value);  break;
+            case LAYOUT_LT: match = (v < r->value);  break;
+            default:        match = (v & r->value) != 0; break;
+        }
+        if (match) return r->color;
+    }
+    return dflt;
+}
+
+/** @brief Formats value / div with dec decimals (truncated) after prefix and before suffix. */
+static void format_number(char *out, const char *prefix, int32_t value, int32_t div, int32_t dec, const char *suffix) {
+    static const int32_t scale[4] = { 1, 10, 100, 1000 };
+    char digits[12];
+    uint8_t n = 0;
+    size_t len = 0;
+
+    int64_t scaled = (int64_t)value * scale[dec] / div;
+    bool neg = scaled < 0;
+    uint64_t mag = neg ? (uint64_t)(-scaled) : (uint64_t)scaled;
+    do {
+        if (n == (uint8_t)dec && dec > 0) digits[n++] = '.';
+        digits[n++] = (char)('0' + (mag % 10u));
+        mag /= 10u;
+    } while ((mag != 0u || n <= (uint8_t)dec) && n < sizeof(digits) - 1u);
+
+    for (const char *p = prefix; *p != '\0' && len < NUMBER_CHARS - 1u; p++) out[len++] = *p;
+    if (neg && len < NUMBER_CHARS - 1u) out[len++] = '-';
+    while (n > 0u && len < NUMBER_CHARS - 1u) out[len++] = digits[--n];
+    for (const char *p = suffix; *p != '\0' && len < NUMBER_CHARS - 1u; p++) out[len++] = *p;
+    out[len] = '\0';
+}
+
+static LayoutDl_t answer(uint8_t *msg, uint32_t *len, const uint8_t *rsp, uint32_t n, LayoutDl_t ret) {
+    memcpy(msg, rsp, n);
+    *len = n;
+    return ret;
+}
+
+static LayoutDl_t answer_nrc(uint8_t *msg, uint32_t *len, uint8_t sid, uint8_t nrc) {
+    const uint8_t rsp[3] = { SID_NEGATIVE, sid, nrc };
+    return answer(msg, len, rsp, sizeof rsp, LAYOUT_DL_ANSWERED);
+}
+
+static LayoutDl_t on_download(uint8_t *msg, uint32_t *len, uint32_t buf_size) {
+    if (*len != 11u || msg[2] != DOWNLOAD_FORMAT) return answer_nrc(msg, len, SID_DOWNLOAD, NRC_LENGTH);
+
+    uint32_t addr = rd32(&msg[3]);
+    uint32_t size = rd32(&msg[7]);
+    if (addr != LAYOUT_SLOT_ADDR || size < sizeof(LayoutHeader_t) || size > LAYOUT_SLOT_SIZE) {
+        return answer_nrc(msg, len, SID_DOWNLOAD, NRC_RANGE);
+    }
+
+    /* Blocks as large as the receive buffer allows, whole phrases */
+    uint32_t block = (buf_size - 2u) & ~(HAL_FLASH_PHRASE_SIZE - 1u);
+    if (block > BOOT_BLOCK_SIZE) block = BOOT_BLOCK_SIZE;
+
+    /* The header sector goes first: the old blob is invalid from now on */
+    dl_active = false;
+    if (hal_flash_erase_sector(LAYOUT_SLOT_ADDR) != 0) return answer_nrc(msg, len, SID_DOWNLOAD, NRC_PROGRAMMING);
+
+    dl_active = true;
+    dl_size = size;
+    dl_offset = 0;
+    dl_seq = 1;
+    dl_block = block;
+    erased_end = LAYOUT_SLOT_ADDR + HAL_FLASH_SECTOR_SIZE;
+
+    uint32_t msg_size = 2u + block;
+    const uint8_t rsp[4] = { POSITIVE(SID_DOWNLOAD), 0x20, (uint8_t)(msg_size >> 8), (uint8_t)msg_size };
+    return answer(msg, len, rsp, sizeof rsp, LAYOUT_DL_STARTED);
+}
+
+static LayoutDl_t on_transfer(uint8_t *msg, uint32_t *len) {
+    if (!dl_active) return answer_nrc(msg, len, SID_TRANSFER, NRC_SEQUENCE);
+    if (*len < 3u) return answer_nrc(msg, len, SID_TRANSFER, NRC_LENGTH);
+    if (msg[1] != dl_seq) return answer_nrc(msg, len, SID_TRANSFER, NRC_BLOCK_SEQUENCE);
+
+    uint32_t n = *len - 2u;
+    uint32_t expected = dl_size - dl_offset;
+    if (expected > dl_block) expected = dl_block;
+    if (n != expected) return answer_nrc(msg, len, SID_TRANSFER, NRC_LENGTH);
+
+    /* Sectors are erased as the blocks reach them; the first one by the request */
+    uint32_t addr = LAYOUT_SLOT_ADDR + dl_offset;
+    bool ok = true;
+    while (ok && erased_end < addr + n) {
+        ok = hal_flash_erase_sector(erased_end) == 0;
+        erased_end += HAL_FLASH_SECTOR_SIZE;
+    }
+    uint32_t whole = n & ~(HAL_FLASH_PHRASE_SIZE - 1u);
+    uint8_t  tail[HAL_FLASH_PHRASE_SIZE];
+    memset(tail, HAL_FLASH_ERASED, sizeof tail);
+    memcpy(tail, &msg[2u + whole], n - whole);
+
+    ok = ok && (whole == 0u || hal_flash_program(addr, &msg[2], whole) == 0) &&
+         (whole == n || hal_flash_program(addr + whole, tail, sizeof tail) == 0) &&
+         memcmp(hal_flash_ptr(addr), &msg[2], n) == 0;
+    if (!ok) {
+        dl_active = false;
+        return answer_nrc(msg, len, SID_TRANSFER, NRC_PROGRAMMING);
+    }
+
+    dl_offset += n;
+    const uint8_t rsp[2] = { POSITIVE(SID_TRANSFER), dl_seq++ };
+    return answer(msg, len, rsp, sizeof rsp, LAYOUT_DL_ANSWERED);
+}
+
+static LayoutDl_t on_exit(uint8_t *msg, uint32_t *len) {
+    if (*len != 5u) return answer_nrc(msg, len, SID_EXIT, NRC_LENGTH);
+    if (!dl_active || dl_offset != dl_size) return answer_nrc(msg, len, SID_EXIT, NRC_SEQUENCE);
+
+    dl_active = false;
+    const uint8_t *slot = hal_flash_ptr(LAYOUT_SLOT_ADDR);
+    if (boot_crc32(0u, slot, dl_size) != rd32(&msg[1]) || !layout_check(slot, dl_size)) {
+        return answer_nrc(msg, len, SID_EXIT, NRC_PROGRAMMING);
+    }
+    const uint8_t rsp[1] = { POSITIVE(SID_EXIT) };
+    return answer(msg, len, rsp, sizeof rsp, LAYOUT_DL_COMPLETE);
+}
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+bool layout_check(const uint8_t *blob, uint32_t max_size) {
+    const LayoutHeader_t *h = (const LayoutHeader_t *)blob;
+
+    if (blob == NULL || ((uintptr_t)blob & 3u) != 0u || max_size < sizeof(LayoutHeader_t)) return false;
+    if (h->magic != LAYOUT_MAGIC || h->version != LAYOUT_VERSION || h->header_size != sizeof(LayoutHeader_t)) return false;
+    if (h->size < sizeof(LayoutHeader_t) || h->size > max_size) return false;
+    if (boot_crc32(0u, blob + sizeof(LayoutHeader_t), h->size - sizeof(LayoutHeader_t)) != h->crc) return false;
+    if (h->width != TFT_HEIGHT || h->height != TFT_WIDTH) return false;    /* Landscape */
+    if (h->page_count == 0u || h->sig_count > sig_count()) return false;
+
+    /* Signals: same names, same order, integers */
+    uint32_t off = h->sig_names;
+    for (uint8_t i = 0; i < h->sig_count; i++) {
+        const SigDef_t *d = sig_def(i);
+        if (!string_ok(blob, h->size, off) || strcmp((const char *)blob + off, d->name) != 0) return false;
+        off += (uint32_t)strlen(d->name) + 1u;
+    }
+
+    if (!in_blob(h->size, h->pages, (uint32_t)h->page_count * sizeof(LayoutPage_t), 4u)) return false;
+    uint32_t trends = 0, trend_bytes = 0;
+    for (uint8_t p = 0; p < h->page_count; p++) {
+        const LayoutPage_t *pg = layout_page(blob, p);
+        if (memchr(pg->name, '\0', sizeof pg->name) == NULL) return false;
+        if (!in_blob(h->size, pg->layer, pg->layer_size, 1u) ||
+            !in_blob(h->size, pg->palette, (uint32_t)pg->palette_count * 2u, 2u) ||
+            !in_blob(h->size, pg->widgets, (uint32_t)pg->widget_count * sizeof(LayoutWidget_t), 4u)) return false;
+
+        /* Layer runs index the palette */
+        for (uint32_t i = 0; i < pg->layer_size; i++) {
+            uint8_t run = blob[pg->layer + i];
+            if ((run >> 4) >= pg->palette_count) return false;
+            if ((run & 0x0Fu) == 0u) i += 2u;
+        }
+
+        uint8_t scrolls = 0;
+        for (uint8_t w = 0; w < pg->widget_count; w++) {
+            const LayoutWidget_t *wd = layout_widget(blob, pg, w);
+            if (!widget_ok(blob, h, wd)) return false;
+            if (wd->signal != LAYOUT_NO_SIGNAL && sig_def(wd->signal)->type != SIG_T_I32) return false;
+            if (wd->type == LAYOUT_TREND) {
+                trends++;
+                trend_bytes += TREND_BYTES(wd->rw);
+                if (wd->flags & LAYOUT_F_SCROLL) scrolls++;
+            }
+        }
+        if (scrolls > 1u) return false;     /* The panel has one scrolling area */
+    }
+    return trends <= TREND_MAX && trend_bytes <= TREND_POOL_SIZE;
+}
+
+const uint8_t *layout_select(const uint8_t *builtin) {
+    const uint8_t *slot = hal_flash_ptr(LAYOUT_SLOT_ADDR);
+    return layout_check(slot, LAYOUT_SLOT_SIZE) ? slot : builtin;
+}
+
+bool layout_is_downloaded(const uint8_t *blob) {
+    return blob != NULL && blob == hal_flash_ptr(LAYOUT_SLOT_ADDR);
+}
+
+const LayoutPage_t *layout_page(const uint8_t *blob, uint8_t index) {
+    const LayoutHeader_t *h = (const LayoutHeader_t *)blob;
+    if (index >= h->page_count) return NULL;
+    return (const LayoutPage_t *)(blob + h->pages) + index;
+}
+
+const LayoutWidget_t *layout_widget(const uint8_t *blob, const LayoutPage_t *page, uint8_t index) {
+    return (const LayoutWidget_t *)(blob + page->widgets) + index;
+}
+
+void layout_draw_widget(const uint8_t *blob, const LayoutWidget_t *w) {
+    uint16_t fg = widget_color(blob, w, LAYOUT_FG, w->fg);
+    uint16_t bg = widget_color(blob, w, LAYOUT_BG, w->bg);
+    int32_t  v  = (w->signal != LAYOUT_NO_SIGNAL) ? sig_get_i32(w->signal) : 0;
+    const char *text = NULL;
+    char number[NUMBER_CHARS];
+
+    switch (w->type) {
+        case LAYOUT_LABEL:
+            text = (const char *)blob + w->text;
+            break;
+        case LAYOUT_NUMBER:
+            format_number(number, (const char *)blob + w->text, v, w->a, w->b,
+                          (w->suffix != 0u) ? (const char *)blob + w->suffix : "");
+            text = number;
+            break;
+        case LAYOUT_TEXT:
+            text = (v >= 0 && v < w->a) ? (const char *)blob + ((const uint32_t *)(blob + w->text))[v] : "";
+            break;
+        case LAYOUT_BAR: {
+            int32_t fill = (v <= w->a) ? 0 : (v >= w->b) ? w->rw : (int32_t)((int64_t)(v - w->a) * w->rw / (w->b - w->a));
+            // Empty part, frame, then the filled part over the frame
+            LCD_fill_rectangle((int16_t)(w->rx + fill), w->ry, (int16_t)(w->rw - fill), w->rh, bg);
+            if (w->flags & LAYOUT_F_BORDER) LCD_draw_rectangle(w->rx, w->ry, w->rw, w->rh, w->border);
+            if (fill > 0) LCD_fill_rectangle(w->rx, w->ry, (int16_t)fill, w->rh, fg);
+            return;
+        }
+        case LAYOUT_TREND:
+            trend_draw(w);
+            return;
+        default:    /* LAYOUT_DOT */
+            if (v != 0) {
+                LCD_fill_circle(w->x, w->y, (int16_t)w->a, fg);
+            } else {
+                LCD_fill_circle(w->x, w->y, (int16_t)w->a, bg);
+                LCD_draw_circle(w->x, w->y, (int16_t)w->a, w->border);
+            }
+            return;
+    }
+
+    LCD_fill_rectangle(w->rx, w->ry, w->rw, w->rh, bg);
+    if (w->flags & LAYOUT_F_BORDER) LCD_draw_rectangle(w->rx, w->ry, w->rw, w->rh, w->border);
+    LCD_draw_string(w->x, w->y, text, fg, bg, w->size);
+}
+
+LayoutDl_t layout_dl_request(uint8_t *msg, uint32_t *len, uint32_t size) {
+    if (*len == 0u) return LAYOUT_DL_NONE;
+
+    switch (msg[0]) {
+        case SID_DOWNLOAD: return on_download(msg, len, size);
+        case SID_TRANSFER: return on_transfer(msg, len);
+        case SID_EXIT:     return on_exit(msg, len);
+        default:           return LAYOUT_DL_NONE;
+    }
+}
@@ -0,0 +1,232 @@
+/**
+ * @file layout.h
+ * @brief Dashboard layout blob: pages, static layers and widgets bound to signals.
+ *
+ * @details
+ * The dashboard is described on the host (drivers/dash_layout.json) and
+ * compiled by tools/layout2c.py into one binary blob. The firmware walks the
+ * blob in place: every offset, rectangle and signal mask is precomputed, so
+ * drawing a page costs no parsing. The blob is built into the application
+ * (drivers/dash_layout.h) and can be replaced without rebuilding it: a new
+ * blob downloaded over CAN (UDS 34/36/37 on the application's ISO-TP
+ * channel, `tools/can_flash.py --layout`) is written to the data sectors of
+ * the flash (::LAYOUT_SLOT_ADDR) and used while it is valid.
+ *
+ * Blob format (little endian, every section 4-byte aligned, offsets from
+ * the start of the blob):
+ *
+ * | Section     | Content                                                   |
+ * |-------------|-----------------------------------------------------------|
+ * | Header      | ::LayoutHeader_t: magic, version, size, CRC-32, tables     |
+ * | Signals     | Names of the signals the blob was compiled against (NUL-terminated, store order) |
+ * | Pages       | ::LayoutPage_t[page_count]                                 |
+ * | Widgets     | ::LayoutWidget_t of every page, page after page            |
+ * | Rules       | ::LayoutRule_t of every widget                             |
+ * | Layers      | Palettes (RGB565) and static layers (::LCD_draw_rle format) |
+ * | Strings     | Widget texts and string tables                             |
+ *
+ * The CRC-32 (boot_crc32) covers the bytes after the header. ::layout_check
+ * validates every offset before a blob is used, and its signal names against
+ * the store (::sig_def), so a blob compiled for another firmware is refused
+ * instead of drawing the wrong values.
+ *
+ * A widget draws one signal (::LayoutWidget_t::signal) in its rectangle; its
+ * colors may depend on other signals through rules (first matching rule of
+ * each color wins, else the widget color):
+ *
+ * | Type            | Draws                                                  |
+ * |-----------------|--------------------------------------------------------|
+ * | ::LAYOUT_LABEL  | Fixed text, optional border (status boxes, buttons)    |
+ * | ::LAYOUT_NUMBER | Value / a with b decimals, between a prefix and a suffix |
+ * | ::LAYOUT_TEXT   | Entry `value` of a string table (a entries)             |
+ * | ::LAYOUT_BAR    | Horizontal bar, value from a (empty) to b (full)        |
+ * | ::LAYOUT_DOT    | Circle of radius a: filled while the value is non-zero  |
+ * | ::LAYOUT_TREND  | Strip chart, a (bottom) to b (top), one column per c ms (trend.h) |
+ *
+ * A trend has no rules and no signal mask: it is not redrawn on a change but
+ * sampled every slot, and draws one column when a column period ends.
+ */
+
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+#include "sig_store.h"
+#include "bootloader.h"
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define LAYOUT_MAGIC        0x594C3146u         /**< "F1LY" */
+#define LAYOUT_VERSION      2u
+#define LAYOUT_SLOT_ADDR    BOOT_DATA_ADDR      /**< Downloaded blob (flash data sectors). */
+#define LAYOUT_SLOT_SIZE    BOOT_DATA_SIZE      /**< Largest blob (16 KB). */
+#define LAYOUT_NO_SIGNAL    0xFFu               /**< Widget or rule without signal. */
+#define LAYOUT_F_BORDER     0x01u               /**< Widget flag: draw the border color around the rectangle. */
+#define LAYOUT_F_SCROLL     0x02u               /**< Trend flag: hardware scroll (rectangle of full screen height). */
+
+/** @brief Widget types. */
+enum {
+    LAYOUT_LABEL = 0,
+    LAYOUT_NUMBER,
+    LAYOUT_TEXT,
+    LAYOUT_BAR,
+    LAYOUT_DOT,
+    LAYOUT_TREND,
+    LAYOUT_TYPES
+};
+
+/** @brief Rule comparisons (signal OP value). */
+enum {
+    LAYOUT_EQ = 0,
+    LAYOUT_NE,
+    LAYOUT_GT,
+    LAYOUT_LT,
+    LAYOUT_BITS,        /**< (signal & value) != 0 */
+    LAYOUT_OPS
+};
+
+/** @brief Color set by a rule. */
+enum {
+    LAYOUT_FG = 0,
+    LAYOUT_BG
+};
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Blob header (32 bytes).
+ */
+typedef struct {
+    uint32_t magic;             /**< ::LAYOUT_MAGIC. */
+    uint16_t version;           /**< ::LAYOUT_VERSION. */
+    uint16_t header_size;       /**< sizeof(LayoutHeader_t). */
+    uint32_t size;              /**< Whole blob, header included. */
+    uint32_t crc;               /**< CRC-32 of the bytes after the header. */
+    uint16_t width;             /**< Screen size the layers were rendered for. */
+    uint16_t height;
+    uint8_t  page_count;        /**< Pages (1 .. PAGE_MAX). */
+    uint8_t  sig_count;         /**< Signal names. */
+    uint16_t reserved;
+    uint32_t pages;             /**< Offset of the ::LayoutPage_t table. */
+    uint32_t sig_names;         /**< Offset of the signal names. */
+} LayoutHeader_t;
+
+/**
+ * @brief One page (32 bytes).
+ */
+typedef struct {
+    char     name[8];           /**< NUL-terminated. */
+    uint32_t layer;             /**< Offset of the static layer (full screen, RLE). */
+    uint32_t layer_size;        /**< Bytes of layer. */
+    uint32_t palette;           /**< Offset of the layer palette (uint16_t). */
+    uint32_t widgets;           /**< Offset of the first ::LayoutWidget_t. */
+    SigMask_t mask;             /**< Signals of all the widgets. */
+    uint8_t  palette_count;
+    uint8_t  widget_count;
+    uint16_t reserved;
+} LayoutPage_t;
+
+/**
+ * @brief One widget (52 bytes).
+ */
+typedef struct {
+    uint8_t  type;              /**< LAYOUT_LABEL ... */
+    uint8_t  signal;            /**< Value drawn, ::LAYOUT_NO_SIGNAL for a label. */
+    uint8_t  size;              /**< Font scale. */
+    uint8_t  rule_count;
+    uint8_t  flags;             /**< ::LAYOUT_F_BORDER, ::LAYOUT_F_SCROLL. */
+    uint8_t  reserved;
+    uint16_t border;            /**< Border color (::LAYOUT_F_BORDER, empty dot, trend cursor). */
+    int16_t  x, y;              /**< Text origin (dot: centre). */
+    int16_t  rx, ry, rw, rh;    /**< Area cleared and drawn (bar: the bar, trend: one column per x). */
+    uint16_t fg, bg;            /**< Colors when no rule matches. */
+    SigMask_t mask;             /**< Signal and rule signals: redraw when one changes. */
+    uint32_t rules;             /**< Offset of the ::LayoutRule_t. */
+    uint32_t text;              /**< Label text, number prefix, or string table (uint32_t offsets). */
+    uint32_t suffix;            /**< Number suffix (0: none). */
+    int32_t  a, b, c;           /**< Type parameters (see the file header). */
+} LayoutWidget_t;
+
+/**
+ * @brief One color rule (12 bytes).
+ */
+typedef struct {
+    uint8_t  signal;
+    uint8_t  op;                /**< LAYOUT_EQ ... */
+    uint8_t  target;            /**< LAYOUT_FG or LAYOUT_BG. */
+    uint8_t  reserved;
+    int32_t  value;
+    uint16_t color;
+    uint16_t reserved2;
+} LayoutRule_t;
+
+/**
+ * @brief Result of ::layout_dl_request.
+ */
+typedef enum {
+    LAYOUT_DL_NONE = 0,         /**< Not a layout download request: handle it elsewhere. */
+    LAYOUT_DL_ANSWERED,         /**< Answered in the buffer (response or negative response). */
+    LAYOUT_DL_STARTED,          /**< Download accepted: the slot is being rewritten. */
+    LAYOUT_DL_COMPLETE          /**< Blob written and valid. */
+} LayoutDl_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Validates a blob: header, CRC, offsets, strings and signal names (after ::sig_init).
+ *
+ * @param[in] blob     Blob (4-byte aligned).
+ * @param[in] max_size Bytes readable at @p blob.
+ * @return bool true if the blob can be drawn.
+ */
+bool layout_check(const uint8_t *blob, uint32_t max_size);
+
+/**
+ * @brief Returns the blob to draw: the downloaded one if valid, else @p builtin.
+ *
+ * @param[in] builtin Blob of the application (assumed valid).
+ * @return const uint8_t* Blob.
+ */
+const uint8_t *layout_select(const uint8_t *builtin);
+
+/**
+ * @brief true if @p blob is the downloaded one.
+ */
+bool layout_is_downloaded(const uint8_t *blob);
+
+/**
+ * @brief Returns page @p index of a checked blob (NULL if out of range).
+ */
+const LayoutPage_t *layout_page(const uint8_t *blob, uint8_t index);
+
+/**
+ * @brief Returns widget @p index of a page.
+ */
+const LayoutWidget_t *layout_widget(const uint8_t *blob, const LayoutPage_t *page, uint8_t index);
+
+/**
+ * @brief Draws a widget from the signal store (clears its rectangle first).
+ */
+void layout_draw_widget(const uint8_t *blob, const LayoutWidget_t *w);
+
+/**
+ * @brief Handles a layout download request received on the ISO-TP channel.
+ *
+ * @details
+ * RequestDownload (`34 00 44 addr size`, addr = ::LAYOUT_SLOT_ADDR),
+ * TransferData (`36 seq data`) and RequestTransferExit (`37 crc32`), as for
+ * the bootloader. The block length announced in the `74` response follows
+ * @p size (at most ::BOOT_BLOCK_SIZE). Each block is programmed, with the
+ * sector it reaches erased first, before the response: this blocks the
+ * caller for a few tens of ms. The response replaces the request in @p msg.
+ *
+ * @param[in,out] msg  Request, then response.
+ * @param[in,out] len  Request length, then response length.
+ * @param[in]     size Size of the @p msg buffer (largest request accepted).
+ * @return LayoutDl_t ::LAYOUT_DL_NONE if @p msg is another request.
+ */
+LayoutDl_t layout_dl_request(uint8_t *msg, uint32_t *len, uint32_t size);
+
+#endif /* LAYOUT_H */
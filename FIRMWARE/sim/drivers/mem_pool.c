@@ -0,0 +1,70 @@
+/**
+ * @file mem_pool.c
+ * @brief Implementation of the static memory pools.
+ */
+
+#include "mem_pool.h"
+#include "hal_log.h"
+#include <stddef.h>
+#include <string.h>
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static MemPool_t *pools[MEM_POOL_MAX];  /* Report list, in order of first allocation */
+static uint8_t    pool_count = 0;
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void *mem_pool_alloc(MemPool_t *pool, uint32_t size) {
+    if (!pool->listed && pool_count < MEM_POOL_MAX) {
+        pools[pool_count++] = pool;
+        pool->listed = true;
+    }
+
+    size = (size + MEM_POOL_ALIGN - 1u) & ~(MEM_POOL_ALIGN - 1u);
+    if (size == 0u || size > pool->size - pool->used) {
+        pool->fails++;
+        return NULL;
+    }
+
+    void *block = pool->base + pool->used;
+    pool->used += size;
+    if (pool->used > pool->high_water) pool->high_water = pool->used;
+    return block;
+}
+
+void *mem_pool_zalloc(MemPool_t *pool, uint32_t size) {
+    void *block = mem_pool_alloc(pool, size);
+    if (block != NULL) memset(block, 0, size);
+    return block;
+}
+
+uint32_t mem_pool_mark(const MemPool_t *pool) {
+    return pool->used;
+}
+
+void mem_pool_release(MemPool_t *pool, uint32_t mark) {
+    if (mark < pool->used) pool->used = mark;
+}
+
+void mem_pool_reset(MemPool_t *pool) {
+    pool->used = 0u;
+}
+
+uint8_t mem_pool_count(void) {
+    return pool_count;
+}
+
+const MemPool_t *mem_pool_get(uint8_t index) {
+    return (index < pool_count) ? pools[index] : NULL;
+}
+
+void mem_pool_report(void) {
+    for (uint8_t i = 0; i < pool_count; i++) {
+        const MemPool_t *p = pools[i];
+        HAL_LOG("[MEM] %-10s %5lu / %5lu B  peak %5lu B  fails %u\r\n", p->name,
+                (unsigned long)p->used, (unsigned long)p->size,
+                (unsigned long)p->high_water, (unsigned)p->fails);
+    }
+}
@@ -0,0 +1,130 @@
+/**
+ * @file mem_pool.h
+ * @brief Static memory pools: per-subsystem arenas sized at compile time, no heap.
+ *
+ * @details
+ * The firmware does not use malloc: the target linker scripts fail the link
+ * if malloc, calloc or realloc is pulled in. A subsystem that needs memory
+ * whose size is only known at init (a framebuffer, a queue, a display list)
+ * defines its own pool with ::MEM_POOL_DEFINE and takes blocks from it:
+ *
+ *     MEM_POOL_DEFINE(fb_pool, "display", 1024u);
+ *     uint8_t *fb = mem_pool_alloc(&fb_pool, 1024u);
+ *
+ * A pool is a bump allocator: allocation is a few instructions, there is no
+ * per-block header and no fragmentation. Blocks are not freed one by one;
+ * the lifetime is explicit instead:
+ * - ::mem_pool_reset gives the whole pool back (shutdown, re-init);
+ * - ::mem_pool_mark / ::mem_pool_release give back everything allocated
+ *   after the mark (scratch memory of one operation).
+ *
+ * Every pool tracks its high-water mark and the allocations it refused, and
+ * joins the pool list at its first allocation: ::mem_pool_report logs the RAM
+ * used per subsystem, ::mem_pool_count / ::mem_pool_get feed the console.
+ * Pools are not thread-safe: allocate from the main loop, not from ISRs.
+ */
+
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define MEM_POOL_ALIGN      4u      /**< Alignment of every block (bytes). */
+#define MEM_POOL_MAX        8u      /**< Pools listed by the report. */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief One pool. Defined with ::MEM_POOL_DEFINE, fields read-only outside mem_pool.c.
+ */
+typedef struct {
+    const char *name;           /**< Subsystem name in the report. */
+    uint8_t    *base;           /**< Storage (static array). */
+    uint32_t    size;           /**< Storage size (bytes). */
+    uint32_t    used;           /**< Bytes allocated now. */
+    uint32_t    high_water;     /**< Highest `used` since boot. */
+    uint16_t    fails;          /**< Allocations refused (pool full). */
+    bool        listed;         /**< Already in the report list. */
+} MemPool_t;
+
+/**
+ * @brief Defines a static pool of `bytes` bytes (rounded up to ::MEM_POOL_ALIGN).
+ *
+ * @details
+ * The storage is a static uint32_t array: it lands in .bss, so the map file
+ * shows it under the owner module and the linker catches a RAM overflow.
+ *
+ * @param var   Name of the MemPool_t variable (file scope).
+ * @param name  Subsystem name (string constant).
+ * @param bytes Pool size.
+ */
+#define MEM_POOL_DEFINE(var, name, bytes)                                          \
+    static uint32_t var##_mem[((bytes) + MEM_POOL_ALIGN - 1u) / MEM_POOL_ALIGN];    \
+    static MemPool_t var = { (name), (uint8_t *)var##_mem, (uint32_t)sizeof(var##_mem), 0u, 0u, 0u, false }
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Allocates a block from a pool.
+ *
+ * @param[in,out] pool Pool.
+ * @param[in]     size Block size (bytes, rounded up to ::MEM_POOL_ALIGN).
+ * @return void* Block (aligned, contents undefined), NULL if the pool is full.
+ */
+void *mem_pool_alloc(MemPool_t *pool, uint32_t size);
+
+/**
+ * @brief Allocates a block from a pool and clears it.
+ *
+ * @param[in,out] pool Pool.
+ * @param[in]     size Block size (bytes).
+ * @return void* Block filled with 0, NULL if the pool is full.
+ */
+void *mem_pool_zalloc(MemPool_t *pool, uint32_t size);
+
+/**
+ * @brief Current fill level, to be passed to ::mem_pool_release.
+ *
+ * @param[in] pool Pool.
+ * @return uint32_t Mark.
+ */
+uint32_t mem_pool_mark(const MemPool_t *pool);
+
+/**
+ * @brief Frees every block allocated after a mark.
+ *
+ * @param[in,out] pool Pool.
+ * @param[in]     mark Value of ::mem_pool_mark (ignored if above the fill level).
+ */
+void mem_pool_release(MemPool_t *pool, uint32_t mark);
+
+/**
+ * @brief Frees every block of a pool (the high-water mark is kept).
+ *
+ * @param[in,out] pool Pool.
+ */
+void mem_pool_reset(MemPool_t *pool);
+
+/**
+ * @brief Number of pools in the report list (pools that allocated at least once).
+ */
+uint8_t mem_pool_count(void);
+
+/**
+ * @brief Pool of the report list.
+ *
+ * @param[in] index List index (order of first allocation).
+ * @return const MemPool_t* Pool, NULL if index is out of range.
+ */
+const MemPool_t *mem_pool_get(uint8_t index);
+
+/**
+ * @brief Logs the usage of every listed pool (HAL_LOG), one line per pool.
+ */
+void mem_pool_report(void);
+
+#endif /* MEM_POOL_H */
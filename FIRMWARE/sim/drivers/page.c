@@ -0,0 +1,116 @@
+/**
+ * @file page.c
+ * @brief Implementation of the dashboard pages.
+ */
+
+#include "page.h"
+#include "trend.h"
+#include "TFT_LCD.h"
+#include "hal_time.h"
+#include <stddef.h>
+#include <string.h>
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static const uint8_t *page_blob_p = NULL;
+static uint8_t        page_num = 0;
+
+static uint8_t   sub = 0xFFu;
+static uint8_t   current = 0;
+static bool      shown = false;
+
+static PageStats_t stats;
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+bool page_init(const uint8_t *blob) {
+    uint8_t count = ((const LayoutHeader_t *)blob)->page_count;
+    if (count == 0u || count > PAGE_MAX) return false;
+
+    if (sub == 0xFFu) sub = sig_subscribe(0u);
+    if (sub == 0xFFu) return false;
+    sig_setMask(sub, 0u);
+
+    page_blob_p = blob;
+    page_num = count;
+    current = 0;
+    shown = false;
+    memset(&stats, 0, sizeof(stats));
+    return trend_init(blob);
+}
+
+void page_show(uint8_t index) {
+    if (index >= page_num) return;
+
+    const LayoutPage_t *pg = layout_page(page_blob_p, index);
+    uint32_t t0 = hal_time_us();
+    uint32_t b0 = LCD_get_tx_bytes();
+
+    trend_hide();       // The layer is drawn unscrolled
+    LCD_draw_rle(0, 0, TFT_HEIGHT, TFT_WIDTH, (const uint16_t *)(page_blob_p + pg->palette),
+                 page_blob_p + pg->layer, pg->layer_size);
+    uint32_t t1 = hal_time_us();
+
+    // The widgets below draw every signal of the page: nothing is pending after them
+    sig_setMask(sub, pg->mask);
+    (void)sig_changed(sub);
+    for (uint8_t w = 0; w < pg->widget_count; w++) {
+        layout_draw_widget(page_blob_p, layout_widget(page_blob_p, pg, w));
+    }
+    current = index;
+    shown = true;
+
+    uint32_t t2 = hal_time_us();
+    stats.switches++;
+    stats.last_us = t2 - t0;
+    if (stats.last_us > stats.max_us) stats.max_us = stats.last_us;
+    stats.layer_us = t1 - t0;
+    stats.flash_bytes = pg->layer_size;
+    stats.spi_bytes = LCD_get_tx_bytes() - b0;
+}
+
+void page_blank(void) {
+    trend_hide();
+    LCD_fill_screen(BLACK);
+    if (page_num != 0u) sig_setMask(sub, 0u);
+    shown = false;
+}
+
+void page_update(void) {
+    if (!shown) return;
+    trend_update();     // New trend columns, whatever changed
+
+    SigMask_t changed = sig_changed(sub);
+    if (changed == 0u) return;
+
+    const LayoutPage_t *pg = layout_page(page_blob_p, current);
+    for (uint8_t w = 0; w < pg->widget_count; w++) {
+        const LayoutWidget_t *wd = layout_widget(page_blob_p, pg, w);
+        if (wd->mask & changed) layout_draw_widget(page_blob_p, wd);
+    }
+}
+
+uint8_t page_current(void) {
+    return current;
+}
+
+uint8_t page_count(void) {
+    return page_num;
+}
+
+const LayoutPage_t *page_get(uint8_t index) {
+    return (index < page_num) ? layout_page(page_blob_p, index) : NULL;
+}
+
+const uint8_t *page_blob(void) {
+    return page_blob_p;
+}
+
+void page_getStats(PageStats_t *out) {
+    *out = stats;
+}
+
+void page_resetStats(void) {
+    memset(&stats, 0, sizeof(stats));
+}
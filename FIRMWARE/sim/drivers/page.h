@@ -0,0 +1,126 @@
+/**
+ * @file page.h
+ * @brief Dashboard pages: static layer and widgets of a layout blob, redrawn on signal changes.
+ *
+ * @details
+ * The pages come from a layout blob (layout.h): each one is a full-screen
+ * static layer (labels, frames: everything that never changes) and a list of
+ * widgets bound to signals. The layer is run-length encoded and drawn by
+ * ::LCD_draw_rle in one address window, so it costs no per-primitive setup.
+ * Each widget clears and draws its own precomputed rectangle.
+ *
+ * The driver owns one signal store subscription. ::page_show restores the
+ * layer, sets the subscription to the signals of the page (precomputed in the
+ * blob) and draws every widget. ::page_update then redraws only the widgets
+ * whose signals changed. Widgets of the other pages are neither subscribed
+ * nor drawn, so switching a page is one layer burst plus one draw per widget,
+ * whatever the number of pages. Trend widgets (trend.h) are the exception:
+ * they are sampled every slot by ::trend_sample, on every page, and
+ * ::page_update draws their new columns.
+ *
+ *     page_init(layout_select(builtin));
+ *     ...
+ *     trend_sample(now_ms);
+ *     if (requested != page_current()) page_show(requested);
+ *     page_update();
+ *
+ * The switch time and the bytes read from flash / sent to the panel are
+ * measured (::page_getStats, `page` console command).
+ */
+
+#ifndef PAGE_H
+#define PAGE_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+#include "sig_store.h"
+#include "layout.h"
+
+/*--------------------------CONFIGURATION-----------------------------------*/
+
+#define PAGE_MAX        8u      /**< Maximum number of pages. */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Cost of the page switches.
+ */
+typedef struct {
+    uint32_t switches;          /**< Calls to ::page_show. */
+    uint32_t last_us;           /**< Duration of the last switch (layer and widgets). */
+    uint32_t max_us;            /**< Longest switch. */
+    uint32_t layer_us;          /**< Static layer part of the last switch. */
+    uint32_t flash_bytes;       /**< Encoded layer read by the last switch. */
+    uint32_t spi_bytes;         /**< Bytes sent to the panel by the last switch. */
+} PageStats_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Uses the pages of a layout blob (after ::sig_init).
+ *
+ * The first call takes the signal store subscription. Called again to change
+ * the blob (layout download): the subscription is kept and paused, nothing
+ * is drawn until ::page_show.
+ *
+ * @param[in] blob Blob checked by ::layout_check (kept, must stay valid).
+ * @return bool false if the blob has too many pages, no subscription is left
+ *              or its trends do not fit (::trend_init).
+ */
+bool page_init(const uint8_t *blob);
+
+/**
+ * @brief Draws a page: static layer, then every widget; its widgets become the active ones.
+ *
+ * Also used to redraw the current page after ::page_blank.
+ *
+ * @param[in] index Page index (ignored if out of range).
+ */
+void page_show(uint8_t index);
+
+/**
+ * @brief Clears the screen and pauses the subscription (display timeout).
+ */
+void page_blank(void);
+
+/**
+ * @brief Redraws the widgets of the current page whose signals changed, and the new trend columns.
+ *
+ * Does nothing while blanked.
+ */
+void page_update(void);
+
+/**
+ * @brief Index of the current page.
+ */
+uint8_t page_current(void);
+
+/**
+ * @brief Number of pages of the blob.
+ */
+uint8_t page_count(void);
+
+/**
+ * @brief Returns a page of the blob (NULL if out of range).
+ */
+const LayoutPage_t *page_get(uint8_t index);
+
+/**
+ * @brief Returns the blob in use.
+ */
+const uint8_t *page_blob(void);
+
+/**
+ * @brief Returns the switch counters.
+ *
+ * @param[out] stats Destination structure.
+ */
+void page_getStats(PageStats_t *stats);
+
+/**
+ * @brief Clears the switch counters.
+ */
+void page_resetStats(void);
+
+#endif /* PAGE_H */
@@ -7,15 +7,15 @@
  * This file contains the logic for reading, calibrating, and interpreting
  * the analog signal from a rotary switch connected to an ADC channel.
  *
- * The driver performs a linear conversion between raw ADC values and
- * discrete switch positions, providing a stable and calibrated interface
- * for upper application layers.
+ * The switch is a resistor ladder: the driver returns the position whose
+ * expected ADC value (LUT_POSITIONS) is nearest to the raw reading.
  *
  * The implementation depends on the HAL ADC module for raw value acquisition.
  */
 
-#include "../hal/hal_adc.h"
+#include "hal_adc.h"
 #include "rotary_switch.h"
+#include <stdlib.h> // Required for abs() function
 
 /** @brief Stores the most recent raw ADC reading. */
 static uint16_t raw;
@@ -32,6 +32,26 @@ static uint8_t num_positions;
 /** @brief Flag indicating whether a valid raw value has been read. */
 static bool raw_valid;
 
+/** * @brief Lookup Table of expected ADC values for each position.
+ * * @note Values correspond to Pos 1 through Pos 10.
+ * @warning Pos 1 and Pos 2 are identical (4095). Logic will default to Pos 1.
+ */
+static const uint16_t LUT_POSITIONS[] = {
+    4095, // Pos 1 (Index 0)
+    //4095, // Pos 2 (Index 1) - Duplicate value!
+    3751, // Pos 3 (Index 2)
+    3279, // Pos 4 (Index 3)
+    2813, // Pos 5 (Index 4)
+    2344, // Pos 6 (Index 5)
+    1876, // Pos 7 (Index 6)
+    1404, // Pos 8 (Index 7)
+    938,  // Pos 9 (Index 8)
+    470   // Pos 10 (Index 9)
+};
+
+/** @brief Total number of defined positions in the LUT. */
+#define NUM_DEFINED_POSITIONS (sizeof(LUT_POSITIONS) / sizeof(LUT_POSITIONS[0]))
+
 
 
 void rotary_SetCalibration(uint16_t min, uint16_t max)
@@ -64,26 +84,35 @@ uint16_t rotary_GetRawValue(void)
 
 uint8_t rotary_GetPosition(void)
 {
-    /* Perform ADC read if no valid value available */
+    /* 1. Acquire Data */
     if (!raw_valid) { 
         rotary_GetRawValue(); 
     }
-
     /* Reset validation flag for next cycle */
     raw_valid = false; 
 
-    /* Prevent invalid calibration */
-    if (max_raw <= min_raw) return 0;
+    /* 2. Find the Nearest Neighbor */
 
-    /* Calculate the range of ADC values for each discrete position */
-    float step_size = (float)(max_raw - min_raw) / num_positions;
+    uint8_t best_index = 0;
+    uint16_t min_error = 0xFFFF; // Initialize with max possible value
 
-    /* Compute position index based on raw ADC input */
-    int position = (int)((raw - min_raw) / step_size);
+    for (uint8_t i = 0; i < NUM_DEFINED_POSITIONS; i++) {
 
-    /* Clamp position within valid limits */
-    if (position < 0) position = 0;
-    if (position >= num_positions) position = num_positions - 1;
+        // Calculate the absolute difference between read value and expected value
+        // We use abs() because the error could be positive or negative
+        uint16_t current_error = abs(raw - LUT_POSITIONS[i]);
 
-    return (uint8_t)position;
-}
\ No newline at end of file
+        // If this position is closer to the raw value than the previous best, update it
+        if (current_error < min_error) {
+            min_error = current_error;
+            best_index = i+1;
+        }
+    }
+
+    /* * 3. Return the Position
+     * Indices are 0-9, but positions are usually referred to as 1-10.
+     * We assume the application expects a 0-based index (0 to 9).
+     * If you need 1 to 10, change this to: return best_index + 1;
+     */
+    return best_index;
+}
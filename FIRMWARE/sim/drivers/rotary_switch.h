@@ -19,12 +19,13 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "hal_adc.h"
 
 /** @def ROTARY_ADC_CHANNEL
  *  @brief Defines the ADC channel assigned to the rotary switch input.
- *  @note Update this value according to the hardware connection.
+ *  @note Set by the platform HAL (::HAL_ADC_CH_ROTARY in hal_adc_port.h).
  */
-#define ROTARY_ADC_CHANNEL 1
+#define ROTARY_ADC_CHANNEL HAL_ADC_CH_ROTARY
 
 /**
  * @brief Initializes the rotary switch driver.
@@ -68,4 +69,4 @@ uint16_t rotary_GetRawValue(void);
  */ 
 void rotary_SetCalibration(uint16_t min, uint16_t max);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,141 @@
+/**
+ * @file sig_store.c
+ * @brief Implementation of the signal store.
+ *
+ * @details
+ * Values are kept as 32-bit words, so an integer and a float signal compare
+ * the same way (bitwise) and a change never depends on float rounding.
+ */
+
+#include "sig_store.h"
+#include <stddef.h>
+#include <string.h>
+
+/*--------------------------PRIVATE TYPES-----------------------------------*/
+
+/** @brief Stored state of one signal. */
+typedef struct {
+    uint32_t raw;           /**< Value (int32_t or float bits). */
+    uint32_t seq;           /**< Changes since sig_init. */
+    uint32_t time_ms;       /**< Store time of the last change. */
+} sig_entry_t;
+
+/** @brief One subscriber. */
+typedef struct {
+    SigMask_t mask;         /**< Signals of interest. */
+    SigMask_t pending;      /**< Changed since the last sig_changed(). */
+} sig_sub_t;
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static const SigDef_t *def_tab = NULL;
+static uint8_t         def_count = 0;
+
+static sig_entry_t entries[SIG_MAX];
+static sig_sub_t   subs[SIG_MAX_SUBS];
+static uint8_t     sub_count = 0;
+
+static uint32_t store_now_ms = 0;
+static uint32_t epoch = 0;
+
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+/** @brief Stores a value and notifies the subscribers if it changed. */
+static bool publish(uint8_t id, uint32_t raw) {
+    if (id >= def_count) return false;
+
+    sig_entry_t *e = &entries[id];
+    if (e->raw == raw) return false;
+
+    e->raw = raw;
+    e->seq++;
+    e->time_ms = store_now_ms;
+    epoch++;
+
+    SigMask_t bit = SIG_BIT(id);
+    for (uint8_t i = 0; i < sub_count; i++) {
+        if (subs[i].mask & bit) subs[i].pending |= bit;
+    }
+    return true;
+}
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void sig_init(const SigDef_t *defs, uint8_t count) {
+    def_tab = defs;
+    def_count = (count > SIG_MAX) ? (uint8_t)SIG_MAX : count;
+    memset(entries, 0, sizeof(entries));
+    memset(subs, 0, sizeof(subs));
+    sub_count = 0;
+    epoch = 0;
+}
+
+void sig_set_time(uint32_t now_ms) {
+    store_now_ms = now_ms;
+}
+
+bool sig_publish_i32(uint8_t id, int32_t value) {
+    return publish(id, (uint32_t)value);
+}
+
+bool sig_publish_f32(uint8_t id, float value) {
+    uint32_t raw;
+    memcpy(&raw, &value, sizeof(raw));
+    return publish(id, raw);
+}
+
+int32_t sig_get_i32(uint8_t id) {
+    return (id < def_count) ? (int32_t)entries[id].raw : 0;
+}
+
+float sig_get_f32(uint8_t id) {
+    float value = 0.0f;
+    if (id < def_count) memcpy(&value, &entries[id].raw, sizeof(value));
+    return value;
+}
+
+uint32_t sig_seq(uint8_t id) {
+    return (id < def_count) ? entries[id].seq : 0u;
+}
+
+uint32_t sig_time_ms(uint8_t id) {
+    return (id < def_count) ? entries[id].time_ms : 0u;
+}
+
+uint32_t sig_epoch(void) {
+    return epoch;
+}
+
+uint8_t sig_subscribe(SigMask_t mask) {
+    if (sub_count >= SIG_MAX_SUBS) return 0xFFu;
+    subs[sub_count].mask = mask;
+    subs[sub_count].pending = mask;         /* First run sees every signal */
+    return sub_count++;
+}
+
+SigMask_t sig_changed(uint8_t sub) {
+    if (sub >= sub_count) return 0u;
+    SigMask_t changed = subs[sub].pending;
+    subs[sub].pending = 0u;
+    return changed;
+}
+
+void sig_invalidate(uint8_t sub, SigMask_t mask) {
+    if (sub < sub_count) subs[sub].pending |= mask & subs[sub].mask;
+}
+
+void sig_setMask(uint8_t sub, SigMask_t mask) {
+    if (sub >= sub_count) return;
+    subs[sub].mask = mask;
+    subs[sub].pending &= mask;
+}
+
+uint8_t sig_count(void) {
+    return def_count;
+}
+
+const SigDef_t *sig_def(uint8_t id) {
+    return (id < def_count) ? &def_tab[id] : NULL;
+}
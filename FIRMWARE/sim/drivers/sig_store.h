@@ -0,0 +1,175 @@
+/**
+ * @file sig_store.h
+ * @brief Signal store: the latest value of every application signal, with change notification.
+ *
+ * @details
+ * Producers (inputs, CAN receive) publish values; consumers (CAN transmit,
+ * LEDs, display, console) read them. The application declares its signals
+ * in a table (name and type, index = signal ID) and passes it to ::sig_init.
+ *
+ * A publish that does not change the value costs one compare. A change
+ * stores the value, increments the signal sequence number, stamps it with
+ * the store time (::sig_set_time) and sets the signal bit in the pending
+ * mask of every subscriber interested in it. A consumer subscribes once with
+ * the mask of the signals it uses and, at each run, takes the signals that
+ * changed since its previous run:
+ *
+ *     uint8_t leds = sig_subscribe(SIG_BIT(SIG_LED_PIT) | SIG_BIT(SIG_LED_TEMP));
+ *     ...
+ *     SigMask_t changed = sig_changed(leds);
+ *     if (changed & SIG_BIT(SIG_LED_PIT)) HAL_GPIO_Write(GPIO_LED_S1, sig_get_i32(SIG_LED_PIT));
+ *
+ * So the work of a consumer follows the rate of change of its inputs, not
+ * the loop rate. A new subscriber starts with every bit of its mask pending
+ * (first run draws / sends everything); ::sig_invalidate forces a signal to
+ * be seen again (display wake-up) and ::sig_setMask changes the signals of a
+ * subscription (display page switch).
+ *
+ * The store is not thread-safe: publish and consume from the main loop.
+ */
+
+#ifndef SIG_STORE_H
+#define SIG_STORE_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define SIG_MAX          32u                 /**< Signals per store (one bit each in ::SigMask_t). */
+#define SIG_MAX_SUBS     8u                  /**< Subscribers. */
+#define SIG_BIT(id)      (1UL << (id))       /**< Mask bit of signal id. */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+typedef uint32_t SigMask_t;                  /**< One bit per signal ID. */
+
+/**
+ * @brief Storage type of a signal.
+ */
+typedef enum {
+    SIG_T_I32 = 0,      /**< Integer, flag or enumeration (int32_t). */
+    SIG_T_F32,          /**< float. */
+} SigType_t;
+
+/**
+ * @brief Declaration of one signal (application table, index = signal ID).
+ */
+typedef struct {
+    const char *name;       /**< Name shown by the console. */
+    SigType_t   type;       /**< Storage type. */
+} SigDef_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Registers the signal table (kept by reference) and clears the store.
+ *
+ * @details
+ * Every signal starts at 0 with sequence number 0; subscriptions are dropped.
+ *
+ * @param[in] defs  Signal table.
+ * @param[in] count Number of signals (up to ::SIG_MAX).
+ */
+void sig_init(const SigDef_t *defs, uint8_t count);
+
+/**
+ * @brief Sets the store time, stamped on the changes that follow.
+ *
+ * @param[in] now_ms Application time (ms), once per slot before the producers run.
+ */
+void sig_set_time(uint32_t now_ms);
+
+/**
+ * @brief Publishes an integer signal.
+ *
+ * @param[in] id    Signal ID.
+ * @param[in] value New value.
+ * @return bool true if the value changed.
+ */
+bool sig_publish_i32(uint8_t id, int32_t value);
+
+/**
+ * @brief Publishes a float signal (a change is any bitwise difference).
+ *
+ * @param[in] id    Signal ID.
+ * @param[in] value New value.
+ * @return bool true if the value changed.
+ */
+bool sig_publish_f32(uint8_t id, float value);
+
+/**
+ * @brief Latest value of an integer signal (0 if id is out of range).
+ */
+int32_t sig_get_i32(uint8_t id);
+
+/**
+ * @brief Latest value of a float signal (0 if id is out of range).
+ */
+float sig_get_f32(uint8_t id);
+
+/**
+ * @brief Number of changes of a signal since ::sig_init.
+ */
+uint32_t sig_seq(uint8_t id);
+
+/**
+ * @brief Store time of the last change of a signal (ms).
+ */
+uint32_t sig_time_ms(uint8_t id);
+
+/**
+ * @brief Number of changes of all signals since ::sig_init (store epoch).
+ */
+uint32_t sig_epoch(void);
+
+/**
+ * @brief Subscribes a consumer to a set of signals.
+ *
+ * @param[in] mask Signals of interest (::SIG_BIT).
+ * @return uint8_t Subscriber handle, 0xFF if ::SIG_MAX_SUBS are already taken.
+ */
+uint8_t sig_subscribe(SigMask_t mask);
+
+/**
+ * @brief Takes the signals changed since the previous call.
+ *
+ * @param[in] sub Subscriber handle.
+ * @return SigMask_t Changed signals of the subscription (cleared by the call).
+ */
+SigMask_t sig_changed(uint8_t sub);
+
+/**
+ * @brief Marks signals as changed for one subscriber (e.g. redraw after wake-up).
+ *
+ * @param[in] sub  Subscriber handle.
+ * @param[in] mask Signals to report at the next ::sig_changed (limited to the subscription).
+ */
+void sig_invalidate(uint8_t sub, SigMask_t mask);
+
+/**
+ * @brief Changes the signals of a subscription.
+ *
+ * Pending changes of the signals left out are dropped; the signals added are
+ * not pending (the caller draws / sends them in full after the change).
+ *
+ * @param[in] sub  Subscriber handle.
+ * @param[in] mask New signals of interest (0 to pause the subscription).
+ */
+void sig_setMask(uint8_t sub, SigMask_t mask);
+
+/**
+ * @brief Number of declared signals.
+ */
+uint8_t sig_count(void);
+
+/**
+ * @brief Declaration of a signal.
+ *
+ * @param[in] id Signal ID.
+ * @return const SigDef_t* Entry of the table, NULL if id is out of range.
+ */
+const SigDef_t *sig_def(uint8_t id);
+
+#endif /* SIG_STORE_H */
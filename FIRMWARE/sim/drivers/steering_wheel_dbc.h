@@ -0,0 +1,372 @@
+/**
+ * @file steering_wheel_dbc.h
+ * @brief CAN message definitions generated from steering_wheel.dbc.
+ *
+ * @details
+ * GENERATED FILE - DO NOT EDIT. Regenerate with:
+ *     python3 tools/dbc2c.py drivers/steering_wheel.dbc drivers/steering_wheel_dbc.h
+ *
+ * Structs hold raw signal values; convert to physical units with
+ * physical = raw * <SIGNAL>_FACTOR + <SIGNAL>_OFFSET.
+ */
+
+#ifndef STEERING_WHEEL_DBC_H
+#define STEERING_WHEEL_DBC_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define DBC_MESSAGE_COUNT  7u  /**< Number of messages in the database. */
+
+/*--------------------------SteeringWheel_Status (0x101, sender SteeringWheel)--------------------------*/
+
+#define DBC_STEERINGWHEEL_STATUS_ID   0x101u
+#define DBC_STEERINGWHEEL_STATUS_DLC  8u
+#define DBC_STEERINGWHEEL_STATUS_IDX  0u
+
+/** @brief Raw signal values of SteeringWheel_Status. */
+typedef struct {
+    uint8_t   Button_UP; /**< bits 0..0, unsigned */
+    uint8_t   Button_DOWN; /**< bits 1..1, unsigned */
+    uint8_t   Button_DRS; /**< bits 2..2, unsigned */
+    uint8_t   Button_PitLimiter; /**< bits 3..3, unsigned */
+    uint8_t   RotaryPosition; /**< bits 8..15, unsigned */
+    uint8_t   ClutchValue; /**< bits 16..23, unsigned [%] */
+} dbc_SteeringWheel_Status_t;
+
+/** @brief Encodes SteeringWheel_Status into an 8-byte payload. */
+static inline void dbc_pack_SteeringWheel_Status(uint8_t d[8], const dbc_SteeringWheel_Status_t* m)
+{
+    uint32_t raw;
+    memset(d, 0, 8);
+    raw = (uint32_t)m->Button_UP & 0x1u;
+    d[0] |= (uint8_t)(((raw >> 0) & 0x1u) << 0);
+    raw = (uint32_t)m->Button_DOWN & 0x1u;
+    d[0] |= (uint8_t)(((raw >> 0) & 0x1u) << 1);
+    raw = (uint32_t)m->Button_DRS & 0x1u;
+    d[0] |= (uint8_t)(((raw >> 0) & 0x1u) << 2);
+    raw = (uint32_t)m->Button_PitLimiter & 0x1u;
+    d[0] |= (uint8_t)(((raw >> 0) & 0x1u) << 3);
+    raw = (uint32_t)m->RotaryPosition & 0xFFu;
+    d[1] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    raw = (uint32_t)m->ClutchValue & 0xFFu;
+    d[2] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+}
+
+/** @brief Decodes an 8-byte payload into SteeringWheel_Status. */
+static inline void dbc_unpack_SteeringWheel_Status(dbc_SteeringWheel_Status_t* m, const uint8_t d[8])
+{
+    uint32_t raw;
+    raw = ((uint32_t)((d[0] >> 0) & 0x1u) << 0);
+    m->Button_UP = (uint8_t)raw;
+    raw = ((uint32_t)((d[0] >> 1) & 0x1u) << 0);
+    m->Button_DOWN = (uint8_t)raw;
+    raw = ((uint32_t)((d[0] >> 2) & 0x1u) << 0);
+    m->Button_DRS = (uint8_t)raw;
+    raw = ((uint32_t)((d[0] >> 3) & 0x1u) << 0);
+    m->Button_PitLimiter = (uint8_t)raw;
+    raw = ((uint32_t)((d[1] >> 0) & 0xFFu) << 0);
+    m->RotaryPosition = (uint8_t)raw;
+    raw = ((uint32_t)((d[2] >> 0) & 0xFFu) << 0);
+    m->ClutchValue = (uint8_t)raw;
+}
+
+/*--------------------------ECU_Status_Display (0x201, sender ECU)--------------------------*/
+
+#define DBC_ECU_STATUS_DISPLAY_ID   0x201u
+#define DBC_ECU_STATUS_DISPLAY_DLC  8u
+#define DBC_ECU_STATUS_DISPLAY_IDX  1u
+#define DBC_ECU_STATUS_DISPLAY_TEMP1_FACTOR  0.1f
+#define DBC_ECU_STATUS_DISPLAY_TEMP1_OFFSET  -40.0f
+#define DBC_ECU_STATUS_DISPLAY_TEMP2_FACTOR  0.1f
+#define DBC_ECU_STATUS_DISPLAY_TEMP2_OFFSET  -40.0f
+
+/** @brief Raw signal values of ECU_Status_Display. */
+typedef struct {
+    uint16_t  Temp1; /**< bits 0..15, unsigned [°C] */
+    uint16_t  Temp2; /**< bits 16..31, unsigned [°C] */
+    uint8_t   PitLimiter_Active; /**< bits 32..32, unsigned */
+    uint8_t   DRS_Status; /**< bits 33..34, unsigned */
+    uint8_t   LED2_PitLimiter; /**< bits 38..38, unsigned */
+    uint8_t   LED1_Temperature; /**< bits 39..39, unsigned */
+    uint8_t   Gear_Actual; /**< bits 40..47, unsigned */
+    uint8_t   Clutch_Feedback; /**< bits 48..55, unsigned [%] */
+    uint8_t   Rotary_Feedback; /**< bits 56..59, unsigned */
+} dbc_ECU_Status_Display_t;
+
+/** @brief Encodes ECU_Status_Display into an 8-byte payload. */
+static inline void dbc_pack_ECU_Status_Display(uint8_t d[8], const dbc_ECU_Status_Display_t* m)
+{
+    uint32_t raw;
+    memset(d, 0, 8);
+    raw = (uint32_t)m->Temp1 & 0xFFFFu;
+    d[0] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    d[1] |= (uint8_t)(((raw >> 8) & 0xFFu) << 0);
+    raw = (uint32_t)m->Temp2 & 0xFFFFu;
+    d[2] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    d[3] |= (uint8_t)(((raw >> 8) & 0xFFu) << 0);
+    raw = (uint32_t)m->PitLimiter_Active & 0x1u;
+    d[4] |= (uint8_t)(((raw >> 0) & 0x1u) << 0);
+    raw = (uint32_t)m->DRS_Status & 0x3u;
+    d[4] |= (uint8_t)(((raw >> 0) & 0x3u) << 1);
+    raw = (uint32_t)m->LED2_PitLimiter & 0x1u;
+    d[4] |= (uint8_t)(((raw >> 0) & 0x1u) << 6);
+    raw = (uint32_t)m->LED1_Temperature & 0x1u;
+    d[4] |= (uint8_t)(((raw >> 0) & 0x1u) << 7);
+    raw = (uint32_t)m->Gear_Actual & 0xFFu;
+    d[5] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    raw = (uint32_t)m->Clutch_Feedback & 0xFFu;
+    d[6] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    raw = (uint32_t)m->Rotary_Feedback & 0xFu;
+    d[7] |= (uint8_t)(((raw >> 0) & 0xFu) << 0);
+}
+
+/** @brief Decodes an 8-byte payload into ECU_Status_Display. */
+static inline void dbc_unpack_ECU_Status_Display(dbc_ECU_Status_Display_t* m, const uint8_t d[8])
+{
+    uint32_t raw;
+    raw = ((uint32_t)((d[0] >> 0) & 0xFFu) << 0)
+        | ((uint32_t)((d[1] >> 0) & 0xFFu) << 8);
+    m->Temp1 = (uint16_t)raw;
+    raw = ((uint32_t)((d[2] >> 0) & 0xFFu) << 0)
+        | ((uint32_t)((d[3] >> 0) & 0xFFu) << 8);
+    m->Temp2 = (uint16_t)raw;
+    raw = ((uint32_t)((d[4] >> 0) & 0x1u) << 0);
+    m->PitLimiter_Active = (uint8_t)raw;
+    raw = ((uint32_t)((d[4] >> 1) & 0x3u) << 0);
+    m->DRS_Status = (uint8_t)raw;
+    raw = ((uint32_t)((d[4] >> 6) & 0x1u) << 0);
+    m->LED2_PitLimiter = (uint8_t)raw;
+    raw = ((uint32_t)((d[4] >> 7) & 0x1u) << 0);
+    m->LED1_Temperature = (uint8_t)raw;
+    raw = ((uint32_t)((d[5] >> 0) & 0xFFu) << 0);
+    m->Gear_Actual = (uint8_t)raw;
+    raw = ((uint32_t)((d[6] >> 0) & 0xFFu) << 0);
+    m->Clutch_Feedback = (uint8_t)raw;
+    raw = ((uint32_t)((d[7] >> 0) & 0xFu) << 0);
+    m->Rotary_Feedback = (uint8_t)raw;
+}
+
+/*--------------------------SteeringWheel_CanDiag (0x301, sender SteeringWheel)--------------------------*/
+
+#define DBC_STEERINGWHEEL_CANDIAG_ID   0x301u
+#define DBC_STEERINGWHEEL_CANDIAG_DLC  8u
+#define DBC_STEERINGWHEEL_CANDIAG_IDX  2u
+#define DBC_STEERINGWHEEL_CANDIAG_BUSLOAD_FACTOR  0.5f
+#define DBC_STEERINGWHEEL_CANDIAG_BUSLOAD_OFFSET  0.0f
+
+/** @brief Raw signal values of SteeringWheel_CanDiag. */
+typedef struct {
+    uint8_t   TxErrCount; /**< bits 0..7, unsigned */
+    uint8_t   RxErrCount; /**< bits 8..15, unsigned */
+    uint8_t   ErrState; /**< bits 16..17, unsigned */
+    uint8_t   BusOffCount; /**< bits 18..23, unsigned */
+    uint8_t   BusLoad; /**< bits 24..31, unsigned [%] */
+    uint16_t  RxOverruns; /**< bits 32..47, unsigned */
+    uint16_t  TxRetries; /**< bits 48..63, unsigned */
+} dbc_SteeringWheel_CanDiag_t;
+
+/** @brief Encodes SteeringWheel_CanDiag into an 8-byte payload. */
+static inline void dbc_pack_SteeringWheel_CanDiag(uint8_t d[8], const dbc_SteeringWheel_CanDiag_t* m)
+{
+    uint32_t raw;
+    memset(d, 0, 8);
+    raw = (uint32_t)m->TxErrCount & 0xFFu;
+    d[0] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    raw = (uint32_t)m->RxErrCount & 0xFFu;
+    d[1] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    raw = (uint32_t)m->ErrState & 0x3u;
+    d[2] |= (uint8_t)(((raw >> 0) & 0x3u) << 0);
+    raw = (uint32_t)m->BusOffCount & 0x3Fu;
+    d[2] |= (uint8_t)(((raw >> 0) & 0x3Fu) << 2);
+    raw = (uint32_t)m->BusLoad & 0xFFu;
+    d[3] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    raw = (uint32_t)m->RxOverruns & 0xFFFFu;
+    d[4] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    d[5] |= (uint8_t)(((raw >> 8) & 0xFFu) << 0);
+    raw = (uint32_t)m->TxRetries & 0xFFFFu;
+    d[6] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+    d[7] |= (uint8_t)(((raw >> 8) & 0xFFu) << 0);
+}
+
+/** @brief Decodes an 8-byte payload into SteeringWheel_CanDiag. */
+static inline void dbc_unpack_SteeringWheel_CanDiag(dbc_SteeringWheel_CanDiag_t* m, const uint8_t d[8])
+{
+    uint32_t raw;
+    raw = ((uint32_t)((d[0] >> 0) & 0xFFu) << 0);
+    m->TxErrCount = (uint8_t)raw;
+    raw = ((uint32_t)((d[1] >> 0) & 0xFFu) << 0);
+    m->RxErrCount = (uint8_t)raw;
+    raw = ((uint32_t)((d[2] >> 0) & 0x3u) << 0);
+    m->ErrState = (uint8_t)raw;
+    raw = ((uint32_t)((d[2] >> 2) & 0x3Fu) << 0);
+    m->BusOffCount = (uint8_t)raw;
+    raw = ((uint32_t)((d[3] >> 0) & 0xFFu) << 0);
+    m->BusLoad = (uint8_t)raw;
+    raw = ((uint32_t)((d[4] >> 0) & 0xFFu) << 0)
+        | ((uint32_t)((d[5] >> 0) & 0xFFu) << 8);
+    m->RxOverruns = (uint16_t)raw;
+    raw = ((uint32_t)((d[6] >> 0) & 0xFFu) << 0)
+        | ((uint32_t)((d[7] >> 0) & 0xFFu) << 8);
+    m->TxRetries = (uint16_t)raw;
+}
+
+/*--------------------------XCP_CRO (0x7E0, sender XcpMaster)--------------------------*/
+
+#define DBC_XCP_CRO_ID   0x7E0u
+#define DBC_XCP_CRO_DLC  8u
+#define DBC_XCP_CRO_IDX  3u
+
+/** @brief Raw signal values of XCP_CRO. */
+typedef struct {
+    uint8_t   XCP_CRO_PID; /**< bits 0..7, unsigned */
+} dbc_XCP_CRO_t;
+
+/** @brief Encodes XCP_CRO into an 8-byte payload. */
+static inline void dbc_pack_XCP_CRO(uint8_t d[8], const dbc_XCP_CRO_t* m)
+{
+    uint32_t raw;
+    memset(d, 0, 8);
+    raw = (uint32_t)m->XCP_CRO_PID & 0xFFu;
+    d[0] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+}
+
+/** @brief Decodes an 8-byte payload into XCP_CRO. */
+static inline void dbc_unpack_XCP_CRO(dbc_XCP_CRO_t* m, const uint8_t d[8])
+{
+    uint32_t raw;
+    raw = ((uint32_t)((d[0] >> 0) & 0xFFu) << 0);
+    m->XCP_CRO_PID = (uint8_t)raw;
+}
+
+/*--------------------------XCP_DTO (0x7E1, sender SteeringWheel)--------------------------*/
+
+#define DBC_XCP_DTO_ID   0x7E1u
+#define DBC_XCP_DTO_DLC  8u
+#define DBC_XCP_DTO_IDX  4u
+
+/** @brief Raw signal values of XCP_DTO. */
+typedef struct {
+    uint8_t   XCP_DTO_PID; /**< bits 0..7, unsigned */
+} dbc_XCP_DTO_t;
+
+/** @brief Encodes XCP_DTO into an 8-byte payload. */
+static inline void dbc_pack_XCP_DTO(uint8_t d[8], const dbc_XCP_DTO_t* m)
+{
+    uint32_t raw;
+    memset(d, 0, 8);
+    raw = (uint32_t)m->XCP_DTO_PID & 0xFFu;
+    d[0] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+}
+
+/** @brief Decodes an 8-byte payload into XCP_DTO. */
+static inline void dbc_unpack_XCP_DTO(dbc_XCP_DTO_t* m, const uint8_t d[8])
+{
+    uint32_t raw;
+    raw = ((uint32_t)((d[0] >> 0) & 0xFFu) << 0);
+    m->XCP_DTO_PID = (uint8_t)raw;
+}
+
+/*--------------------------ISOTP_REQ (0x7E4, sender Tester)--------------------------*/
+
+#define DBC_ISOTP_REQ_ID   0x7E4u
+#define DBC_ISOTP_REQ_DLC  8u
+#define DBC_ISOTP_REQ_IDX  5u
+
+/** @brief Raw signal values of ISOTP_REQ. */
+typedef struct {
+    uint8_t   ISOTP_REQ_PCI; /**< bits 0..7, unsigned */
+} dbc_ISOTP_REQ_t;
+
+/** @brief Encodes ISOTP_REQ into an 8-byte payload. */
+static inline void dbc_pack_ISOTP_REQ(uint8_t d[8], const dbc_ISOTP_REQ_t* m)
+{
+    uint32_t raw;
+    memset(d, 0, 8);
+    raw = (uint32_t)m->ISOTP_REQ_PCI & 0xFFu;
+    d[0] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+}
+
+/** @brief Decodes an 8-byte payload into ISOTP_REQ. */
+static inline void dbc_unpack_ISOTP_REQ(dbc_ISOTP_REQ_t* m, const uint8_t d[8])
+{
+    uint32_t raw;
+    raw = ((uint32_t)((d[0] >> 0) & 0xFFu) << 0);
+    m->ISOTP_REQ_PCI = (uint8_t)raw;
+}
+
+/*--------------------------ISOTP_RSP (0x7EC, sender SteeringWheel)--------------------------*/
+
+#define DBC_ISOTP_RSP_ID   0x7ECu
+#define DBC_ISOTP_RSP_DLC  8u
+#define DBC_ISOTP_RSP_IDX  6u
+
+/** @brief Raw signal values of ISOTP_RSP. */
+typedef struct {
+    uint8_t   ISOTP_RSP_PCI; /**< bits 0..7, unsigned */
+} dbc_ISOTP_RSP_t;
+
+/** @brief Encodes ISOTP_RSP into an 8-byte payload. */
+static inline void dbc_pack_ISOTP_RSP(uint8_t d[8], const dbc_ISOTP_RSP_t* m)
+{
+    uint32_t raw;
+    memset(d, 0, 8);
+    raw = (uint32_t)m->ISOTP_RSP_PCI & 0xFFu;
+    d[0] |= (uint8_t)(((raw >> 0) & 0xFFu) << 0);
+}
+
+/** @brief Decodes an 8-byte payload into ISOTP_RSP. */
+static inline void dbc_unpack_ISOTP_RSP(dbc_ISOTP_RSP_t* m, const uint8_t d[8])
+{
+    uint32_t raw;
+    raw = ((uint32_t)((d[0] >> 0) & 0xFFu) << 0);
+    m->ISOTP_RSP_PCI = (uint8_t)raw;
+}
+
+/*--------------------------Receive dispatch (perfect hash)--------------------------*/
+
+#define DBC_HASH_SIZE   8u       /**< Slots of the ID hash table (power of two). */
+#define DBC_HASH_MUL    0x0041u  /**< Hash multiplier. */
+#define DBC_HASH_SHIFT  7u       /**< Hash shift. */
+#define DBC_NO_MESSAGE  0xFFu    /**< Index returned for IDs not in the database. */
+
+/** @brief Hash slot -> { CAN ID, message index }; empty slots hold an invalid ID. */
+static const struct { uint16_t id; uint8_t idx; } dbc_hash_table[DBC_HASH_SIZE] = {
+    { 0x7E1u, 4u },  /* 0: XCP_DTO */
+    { 0x7E4u, 5u },  /* 1: ISOTP_REQ */
+    { 0x101u, 0u },  /* 2: SteeringWheel_Status */
+    { 0xFFFFu, DBC_NO_MESSAGE },  /* 3: empty */
+    { 0x201u, 1u },  /* 4: ECU_Status_Display */
+    { 0x7ECu, 6u },  /* 5: ISOTP_RSP */
+    { 0x301u, 2u },  /* 6: SteeringWheel_CanDiag */
+    { 0x7E0u, 3u },  /* 7: XCP_CRO */
+};
+
+/**
+ * @brief Maps a standard CAN ID to its message index (DBC_<MSG>_IDX) in constant time.
+ * @return Message index, or ::DBC_NO_MESSAGE if the ID is not in the database.
+ */
+static inline uint8_t dbc_message_index(uint32_t id)
+{
+    uint32_t slot = ((id * DBC_HASH_MUL) >> DBC_HASH_SHIFT) & (DBC_HASH_SIZE - 1u);
+    return (dbc_hash_table[slot].id == id) ? dbc_hash_table[slot].idx : DBC_NO_MESSAGE;
+}
+
+/** @brief Message index -> CAN ID (acceptance filters built from a table indexed by DBC_<MSG>_IDX). */
+static const uint16_t dbc_message_ids[DBC_MESSAGE_COUNT] = {
+    0x101u,  /* 0: SteeringWheel_Status */
+    0x201u,  /* 1: ECU_Status_Display */
+    0x301u,  /* 2: SteeringWheel_CanDiag */
+    0x7E0u,  /* 3: XCP_CRO */
+    0x7E1u,  /* 4: XCP_DTO */
+    0x7E4u,  /* 5: ISOTP_REQ */
+    0x7ECu,  /* 6: ISOTP_RSP */
+};
+
+/** @brief Returns the CAN ID of a message index (DBC_<MSG>_IDX, below ::DBC_MESSAGE_COUNT). */
+static inline uint32_t dbc_message_id(uint8_t idx)
+{
+    return dbc_message_ids[idx];
+}
+
+#endif /* STEERING_WHEEL_DBC_H */
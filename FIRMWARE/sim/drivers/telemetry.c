@@ -0,0 +1,149 @@
+/**
+ * @file telemetry.c
+ * @brief Implementation of the binary telemetry stream.
+ *
+ * @details
+ * The record is serialized byte by byte (no packed structs: same layout on
+ * the 32-bit target and the 64-bit host), protected with a CRC-16 and
+ * COBS-encoded directly into the frame buffer. The frame goes out through
+ * ::hal_log_frame: the UART TX ring on the target, a pty or a file on the host.
+ */
+
+#include "telemetry.h"
+#include "hal_log.h"
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static uint32_t rec_period_ms = 0;   /**< Record period, 0 = off. */
+static uint32_t last_ms = 0;         /**< Time of the last record. */
+static bool     started = false;     /**< False until the first record is sent. */
+static uint8_t  seq = 0;             /**< Sequence number of the next record. */
+static uint32_t loop_max_us = 0;     /**< Longest loop since the last record. */
+
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+/** @brief Saturates an unsigned value to 16 bits. */
+static uint16_t sat_u16(uint32_t v) {
+    return (v > 0xFFFFu) ? 0xFFFFu : (uint16_t)v;
+}
+
+/** @brief Converts a percentage to 0.1 % units, rounded and saturated. */
+static int16_t pct_x10(float pct) {
+    float v = pct * 10.0f;
+    if (v >  32767.0f) return  32767;
+    if (v < -32768.0f) return -32768;
+    return (int16_t)((v >= 0.0f) ? (v + 0.5f) : (v - 0.5f));
+}
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    put_u16(p, (uint16_t)v);
+    put_u16(p + 2, (uint16_t)(v >> 16));
+}
+
+/** @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), bitwise: 34 bytes per record. */
+static uint16_t crc16_ccitt(const uint8_t *data, uint32_t len) {
+    uint16_t crc = 0xFFFFu;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8);
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ 0x1021u) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief COBS-encodes len bytes into out (no zero byte in the output).
+ * @return uint32_t Encoded length: len + 1 below 254 bytes.
+ */
+static uint32_t cobs_encode(const uint8_t *in, uint32_t len, uint8_t *out) {
+    uint32_t code_pos = 0;
+    uint32_t o = 1;
+    uint8_t code = 1;
+
+    for (uint32_t i = 0; i < len; i++) {
+        if (in[i] == 0u) {
+            out[code_pos] = code;
+            code_pos = o++;
+            code = 1;
+        } else {
+            out[o++] = in[i];
+            if (++code == 0xFFu) {
+                out[code_pos] = code;
+                code_pos = o++;
+                code = 1;
+            }
+        }
+    }
+    out[code_pos] = code;
+    return o;
+}
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void telem_init(uint32_t period_ms) {
+    rec_period_ms = period_ms;
+    started = false;
+    seq = 0;
+    loop_max_us = 0;
+}
+
+void telem_setPeriod(uint32_t period_ms) {
+    rec_period_ms = period_ms;
+}
+
+uint32_t telem_encode(const TelemSample_t *s, uint8_t sequence, uint32_t loop_max, uint8_t *frame) {
+    uint8_t rec[TELEM_RECORD_SIZE];
+
+    rec[0] = TELEM_VERSION;
+    rec[1] = sequence;
+    put_u32(&rec[2], s->now_ms);
+    rec[6] = s->buttons;
+    rec[7] = s->position;
+    rec[8] = s->leds;
+    rec[9] = s->flags;
+    put_u16(&rec[10], s->rotary_adc);
+    put_u16(&rec[12], s->clutch_adc);
+    put_u16(&rec[14], (uint16_t)pct_x10(s->clutch_raw));
+    put_u16(&rec[16], (uint16_t)pct_x10(s->clutch_filt));
+    put_u16(&rec[18], (uint16_t)s->t1);
+    put_u16(&rec[20], (uint16_t)s->t2);
+    rec[22] = s->gear;
+    rec[23] = 0u;
+    put_u16(&rec[24], sat_u16(s->loop_us));
+    put_u16(&rec[26], sat_u16(loop_max));
+    put_u16(&rec[28], sat_u16(s->can_tx_age_ms));
+    put_u16(&rec[30], sat_u16(s->can_rx_age_ms));
+    put_u16(&rec[32], s->bus_load_permille);
+    put_u16(&rec[34], crc16_ccitt(rec, TELEM_RECORD_SIZE - 2u));
+
+    frame[0] = HAL_LOG_MARKER;
+    frame[1] = HAL_LOG_FRAME_TAG;
+    uint32_t len = 2u + cobs_encode(rec, TELEM_RECORD_SIZE, &frame[2]);
+    frame[len++] = 0x00u;
+    return len;
+}
+
+bool telem_update(const TelemSample_t *s) {
+    if (s->loop_us > loop_max_us) loop_max_us = s->loop_us;
+
+    if (rec_period_ms == 0u) return false;
+    if (started && (s->now_ms - last_ms) < rec_period_ms) return false;
+
+    uint8_t frame[TELEM_FRAME_MAX];
+    uint32_t len = telem_encode(s, seq, loop_max_us, frame);
+    hal_log_frame(frame, len);
+
+    seq++;
+    loop_max_us = 0;
+    last_ms = s->now_ms;
+    started = true;
+    return true;
+}
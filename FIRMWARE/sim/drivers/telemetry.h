@@ -0,0 +1,124 @@
+/**
+ * @file telemetry.h
+ * @brief Binary telemetry stream: one fixed record per period, COBS-framed with a CRC.
+ *
+ * @details
+ * Replaces the text debug page for monitoring and plotting: the record carries
+ * the inputs (buttons, rotary, clutch raw and filtered), the ECU values
+ * (temperatures, gear), the loop timing and the CAN link ages in 36 bytes.
+ * `tools/telem_view.py` decodes and plots the stream; the simulator and the
+ * target send the same format.
+ *
+ * Record (version ::TELEM_VERSION, little-endian):
+ *
+ * | Offset | Type | Field                                             |
+ * |--------|------|---------------------------------------------------|
+ * | 0      | u8   | Version                                           |
+ * | 1      | u8   | Sequence (gaps = lost records)                    |
+ * | 2      | u32  | Application time (ms)                             |
+ * | 6      | u8   | Debounced button mask                             |
+ * | 7      | u8   | Rotary position                                   |
+ * | 8      | u8   | LEDs (bit 0: LED 1, bit 1: LED 2)                 |
+ * | 9      | u8   | Flags (bit 0: ECU link active)                    |
+ * | 10     | u16  | Rotary ADC counts                                 |
+ * | 12     | u16  | Clutch ADC counts                                 |
+ * | 14     | i16  | Clutch before the EMA (0.1 %)                     |
+ * | 16     | i16  | Clutch after the EMA (0.1 %)                      |
+ * | 18     | i16  | Temperature 1 (°C)                                |
+ * | 20     | i16  | Temperature 2 (°C)                                |
+ * | 22     | u8   | Gear                                              |
+ * | 23     | u8   | Reserved (0)                                      |
+ * | 24     | u16  | Busy time of the last loop slot (us)              |
+ * | 26     | u16  | Longest busy time since the previous record (us)  |
+ * | 28     | u16  | Time since the last CAN transmission (ms)         |
+ * | 30     | u16  | Time since the last ECU frame (ms)                |
+ * | 32     | u16  | CAN bus load (0.1 %)                              |
+ * | 34     | u16  | CRC-16/CCITT-FALSE of bytes 0..33                 |
+ *
+ * On the wire a record is `00 FF` + COBS(record) + `00` (::hal_log_frame):
+ * COBS removes the zero bytes, so the terminating `00` always marks the end
+ * of the frame and a receiver resynchronizes on the next one. Values that do
+ * not fit are saturated. New fields are appended with a new version.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define TELEM_VERSION        1u     /**< Record layout version (byte 0). */
+#define TELEM_RECORD_SIZE    36u    /**< Record bytes, CRC included. */
+#define TELEM_FRAME_MAX      (2u + TELEM_RECORD_SIZE + 1u + 1u)  /**< Lead, COBS(record), end. */
+
+#define TELEM_LED1           0x01u  /**< LEDs: LED 1 (pit limiter). */
+#define TELEM_LED2           0x02u  /**< LEDs: LED 2 (temperature). */
+#define TELEM_FLAG_CAN_ACTIVE 0x01u /**< Flags: ECU link active. */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Values of one main-loop slot, in application units.
+ */
+typedef struct {
+    uint32_t now_ms;            /**< Application time (ms). */
+    uint8_t  buttons;           /**< Debounced button mask. */
+    uint8_t  position;          /**< Rotary position. */
+    uint8_t  leds;              /**< TELEM_LED1 / TELEM_LED2. */
+    uint8_t  flags;             /**< TELEM_FLAG_*. */
+    uint16_t rotary_adc;        /**< Rotary ADC counts. */
+    uint16_t clutch_adc;        /**< Clutch ADC counts. */
+    float    clutch_raw;        /**< Clutch before the EMA (%). */
+    float    clutch_filt;       /**< Clutch after the EMA (%). */
+    int16_t  t1;                /**< Temperature 1 (°C). */
+    int16_t  t2;                /**< Temperature 2 (°C). */
+    uint8_t  gear;              /**< Gear reported by the ECU. */
+    uint32_t loop_us;           /**< Busy time of the slot (us). */
+    uint32_t can_tx_age_ms;     /**< Time since the last CAN transmission (ms). */
+    uint32_t can_rx_age_ms;     /**< Time since the last ECU frame (ms). */
+    uint16_t bus_load_permille; /**< CAN bus load (0.1 %). */
+} TelemSample_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Resets the stream (sequence, loop maximum) and sets the period.
+ *
+ * @param[in] period_ms Record period in milliseconds, 0 = stream off.
+ */
+void telem_init(uint32_t period_ms);
+
+/**
+ * @brief Changes the record period (e.g. from an XCP calibration).
+ *
+ * @param[in] period_ms Record period in milliseconds, 0 = stream off.
+ */
+void telem_setPeriod(uint32_t period_ms);
+
+/**
+ * @brief Takes the sample of this slot; sends a record when the period has elapsed.
+ *
+ * @details
+ * Call once per main-loop slot: the longest loop time is tracked between two
+ * records.
+ *
+ * @param[in] s Values of the slot.
+ * @return bool True when a record was sent.
+ */
+bool telem_update(const TelemSample_t *s);
+
+/**
+ * @brief Builds the wire frame of one record.
+ *
+ * @param[in]  s        Values to send.
+ * @param[in]  seq      Sequence number.
+ * @param[in]  loop_max Longest busy time to report (us).
+ * @param[out] frame    Destination, at least ::TELEM_FRAME_MAX bytes.
+ * @return uint32_t Frame length in bytes.
+ */
+uint32_t telem_encode(const TelemSample_t *s, uint8_t seq, uint32_t loop_max, uint8_t *frame);
+
+#endif /* TELEMETRY_H */
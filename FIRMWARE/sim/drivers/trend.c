@@ -0,0 +1,209 @@
+/**
+ * @file trend.c
+ * @brief Implementation of the trend widgets.
+ */
+
+#include "trend.h"
+#include "TFT_LCD.h"
+#include "mem_pool.h"
+#include "sig_store.h"
+#include <stddef.h>
+#include <string.h>
+
+/*--------------------------PRIVATE TYPES-----------------------------------*/
+
+/**
+ * @brief History and drawing state of one trend widget.
+ */
+typedef struct {
+    const LayoutWidget_t *w;
+    int16_t  *lo, *hi;          /**< Ring buffer: column j in slot j % rw. */
+    uint32_t  done;             /**< Columns completed since the bind. */
+    uint32_t  drawn;            /**< Columns drawn (while shown). */
+    uint32_t  col_start_ms;     /**< Start of the open column. */
+    int16_t   acc_lo, acc_hi;   /**< Open column: min and max so far. */
+    int16_t   last;             /**< Latest sample. */
+    bool      has_sample;       /**< The open column has a sample. */
+    bool      started;          /**< col_start_ms is valid. */
+    bool      shown;
+} Trend_t;
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+MEM_POOL_DEFINE(trend_pool, "trend", TREND_POOL_SIZE);
+
+static Trend_t trends[TREND_MAX];
+static uint8_t trend_num = 0;
+static bool    scrolled = false;    /* The panel scrolls a band (a scroll trend was drawn) */
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+static int16_t clamp16(int32_t v) {
+    return (v < INT16_MIN) ? INT16_MIN : (v > INT16_MAX) ? INT16_MAX : (int16_t)v;
+}
+
+static Trend_t *find(const LayoutWidget_t *w) {
+    for (uint8_t i = 0; i < trend_num; i++) {
+        if (trends[i].w == w) return &trends[i];
+    }
+    return NULL;
+}
+
+static void close_column(Trend_t *t) {
+    uint32_t slot = t->done % (uint32_t)t->w->rw;
+
+    if (!t->has_sample) t->acc_lo = t->acc_hi = t->last;    /* No sample in the period */
+    t->lo[slot] = t->acc_lo;
+    t->hi[slot] = t->acc_hi;
+    t->done++;
+    t->has_sample = false;
+}
+
+/** @brief Row of a value in the widget, 0 (b) to rh - 1 (a). */
+static int16_t value_row(const LayoutWidget_t *w, int32_t v) {
+    if (v < w->a) v = w->a;
+    if (v > w->b) v = w->b;
+    return (int16_t)(w->rh - 1 - ((int64_t)v - w->a) * (w->rh - 1) / ((int64_t)w->b - w->a));
+}
+
+static void draw_slot(const Trend_t *t, uint32_t slot, int16_t top, int16_t bottom, uint16_t color) {
+    const LayoutWidget_t *w = t->w;
+    LCD_draw_column((int16_t)(w->rx + (int16_t)slot), w->ry, w->rh, top, bottom, color, w->bg);
+}
+
+/** @brief Draws column j (done - rw <= j < done), its span joined to column j - 1. */
+static void draw_column(const Trend_t *t, uint32_t j) {
+    uint32_t cols = (uint32_t)t->w->rw;
+    uint32_t slot = j % cols;
+    int16_t  lo = t->lo[slot], hi = t->hi[slot];
+
+    if (j > 0u && t->done - (j - 1u) <= cols) {
+        uint32_t prev = (j - 1u) % cols;
+        if (lo > t->hi[prev]) lo = t->hi[prev];
+        if (hi < t->lo[prev]) hi = t->lo[prev];
+    }
+    draw_slot(t, slot, value_row(t->w, hi), value_row(t->w, lo), t->w->fg);
+}
+
+/** @brief Shows the newest column last: cursor after it (sweep) or band scrolled (scroll). */
+static void draw_head(const Trend_t *t) {
+    const LayoutWidget_t *w = t->w;
+    uint32_t head = t->done % (uint32_t)w->rw;
+
+    if (w->flags & LAYOUT_F_SCROLL) {
+        LCD_scroll_to((uint16_t)(w->rx + (int16_t)head));
+    } else {
+        draw_slot(t, head, 0, (int16_t)(w->rh - 1), w->border);
+    }
+}
+
+static void redraw(Trend_t *t) {
+    const LayoutWidget_t *w = t->w;
+    uint32_t cols = (uint32_t)w->rw;
+
+    if (w->flags & LAYOUT_F_SCROLL) {
+        LCD_scroll_area((uint16_t)w->rx, (uint16_t)w->rw);
+        scrolled = true;
+    }
+    // Oldest to newest; the oldest slot is the sweep cursor
+    for (uint32_t k = (w->flags & LAYOUT_F_SCROLL) ? 0u : 1u; k < cols; k++) {
+        if (t->done + k < cols) {
+            draw_slot(t, (t->done + k) % cols, 0, -1, w->fg);     /* Not sampled yet */
+        } else {
+            draw_column(t, t->done + k - cols);
+        }
+    }
+    draw_head(t);
+    t->drawn = t->done;
+}
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+bool trend_init(const uint8_t *blob) {
+    const LayoutHeader_t *h = (const LayoutHeader_t *)blob;
+
+    mem_pool_reset(&trend_pool);
+    memset(trends, 0, sizeof(trends));
+    trend_num = 0;
+
+    for (uint8_t p = 0; p < h->page_count; p++) {
+        const LayoutPage_t *pg = layout_page(blob, p);
+        for (uint8_t i = 0; i < pg->widget_count; i++) {
+            const LayoutWidget_t *w = layout_widget(blob, pg, i);
+            if (w->type != LAYOUT_TREND) continue;
+            if (trend_num >= TREND_MAX) return false;
+
+            Trend_t *t = &trends[trend_num];
+            t->lo = mem_pool_alloc(&trend_pool, (uint32_t)w->rw * 2u);
+            t->hi = mem_pool_alloc(&trend_pool, (uint32_t)w->rw * 2u);
+            if (t->lo == NULL || t->hi == NULL) return false;
+            t->w = w;
+            trend_num++;
+        }
+    }
+    return true;
+}
+
+void trend_sample(uint32_t now_ms) {
+    for (uint8_t i = 0; i < trend_num; i++) {
+        Trend_t *t = &trends[i];
+        uint32_t period = (uint32_t)t->w->c;
+        int16_t  v = clamp16(sig_get_i32(t->w->signal));
+
+        if (!t->started) {
+            t->started = true;
+            t->col_start_ms = now_ms;
+            t->last = v;
+        }
+
+        // Columns whose period ended; after a long stall only the last ring matters
+        uint32_t ended = (now_ms - t->col_start_ms) / period;
+        if (ended > 0u) {
+            t->col_start_ms += ended * period;
+            if (ended > (uint32_t)t->w->rw) ended = (uint32_t)t->w->rw;
+            while (ended-- > 0u) close_column(t);
+        }
+
+        // Min/max decimation of the samples of the open column
+        if (!t->has_sample) {
+            t->acc_lo = t->acc_hi = v;
+            t->has_sample = true;
+        } else {
+            if (v < t->acc_lo) t->acc_lo = v;
+            if (v > t->acc_hi) t->acc_hi = v;
+        }
+        t->last = v;
+    }
+}
+
+void trend_draw(const LayoutWidget_t *w) {
+    Trend_t *t = find(w);
+    if (t == NULL) return;
+
+    redraw(t);
+    t->shown = true;
+}
+
+void trend_update(void) {
+    for (uint8_t i = 0; i < trend_num; i++) {
+        Trend_t *t = &trends[i];
+        if (!t->shown || t->drawn == t->done) continue;
+
+        // Behind by a whole ring (blanked, slow slot): redraw, else the new columns only
+        if (t->done - t->drawn >= (uint32_t)t->w->rw) {
+            redraw(t);
+            continue;
+        }
+        while (t->drawn != t->done) draw_column(t, t->drawn++);
+        draw_head(t);
+    }
+}
+
+void trend_hide(void) {
+    for (uint8_t i = 0; i < trend_num; i++) trends[i].shown = false;
+    if (scrolled) {
+        LCD_scroll_area(0u, TFT_HEIGHT);
+        LCD_scroll_to(0u);
+        scrolled = false;
+    }
+}
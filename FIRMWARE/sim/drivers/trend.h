@@ -0,0 +1,90 @@
+/**
+ * @file trend.h
+ * @brief Trend widgets: strip charts of a signal, drawn one column at a time.
+ *
+ * @details
+ * A ::LAYOUT_TREND widget shows the recent history of a signal, one pixel
+ * column per period (::LayoutWidget_t::c ms), the newest on the right. Its
+ * history is a ring buffer of columns (min and max of the values sampled
+ * during the period) taken from a static pool when the blob is bound, one
+ * column per pixel of the widget width.
+ *
+ * ::trend_sample runs every slot, whichever page is shown, so the history
+ * survives page switches and display timeouts. Each slot is a sample: when
+ * there are more samples than columns (a 500 ms column holds ~31 slots), the
+ * column keeps their min/max, so a spike shorter than a column still shows.
+ * A column ends when its period has elapsed; a period without samples
+ * repeats the last value.
+ *
+ * Drawing never redraws the chart for a new sample: ::trend_update draws
+ * the columns completed since the last call, each one a single 1-pixel-wide
+ * address window (::LCD_draw_column, rh pixels). The span of a column joins
+ * the previous one, so a steep change reads as a line, not as dots. Column j
+ * is always written at x = rx + j % rw; what moves is how it is shown:
+ * - sweep (default): the chart is fixed and a cursor column (border color)
+ *   runs over it, erasing the oldest column just before it is overwritten;
+ * - scroll (::LAYOUT_F_SCROLL): the panel scrolls the band of the widget
+ *   (::LCD_scroll_area, ::LCD_scroll_to) so the newest column is on the right
+ *   edge. The ILI9341 scrolls its gate lines, the screen columns in
+ *   landscape, over the full screen height: only a widget of full height can
+ *   use it, one per page (checked by tools/layout2c.py and ::layout_check).
+ *
+ * ::trend_draw (from ::layout_draw_widget, i.e. ::page_show) redraws the
+ * whole chart from the ring buffer.
+ */
+
+#ifndef TREND_H
+#define TREND_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+#include "layout.h"
+
+/*--------------------------CONFIGURATION-----------------------------------*/
+
+#define TREND_MAX           4u      /**< Trend widgets in a blob, all pages. */
+#define TREND_POOL_SIZE     1536u   /**< History of all the trends (4 bytes per column). */
+
+/** @brief Pool bytes of a trend of `cols` columns: min and max (int16_t) arrays. */
+#define TREND_BYTES(cols)   (2u * (((uint32_t)(cols) * 2u + 3u) & ~3u))
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Binds the trend widgets of a checked blob; their history restarts empty.
+ *
+ * @param[in] blob Blob (kept, must stay valid).
+ * @return bool false if the trends do not fit (::TREND_MAX, ::TREND_POOL_SIZE).
+ */
+bool trend_init(const uint8_t *blob);
+
+/**
+ * @brief Samples every bound trend and closes the columns whose period ended.
+ *
+ * Called once per slot, also while the display is blanked.
+ *
+ * @param[in] now_ms Application time (ms).
+ */
+void trend_sample(uint32_t now_ms);
+
+/**
+ * @brief Redraws a trend widget from its history; it becomes a shown trend.
+ *
+ * @param[in] w Widget of the bound blob (ignored if not a bound trend).
+ */
+void trend_draw(const LayoutWidget_t *w);
+
+/**
+ * @brief Draws the columns completed since the last draw of the shown trends.
+ */
+void trend_update(void);
+
+/**
+ * @brief No trend shown anymore (page switch, blank): unscrolls the panel if needed.
+ *
+ * Called before the static layer of a page is drawn.
+ */
+void trend_hide(void);
+
+#endif /* TREND_H */
@@ -0,0 +1,566 @@
+/**
+ * @file xcp.c
+ * @brief Implementation of the XCP-on-CAN slave.
+ *
+ * @details
+ * Commands are handled synchronously: ::xcp_rx is called from the CAN receive
+ * dispatch and queues the response before returning. DAQ configuration
+ * follows the dynamic allocation sequence of the standard
+ * (FREE_DAQ -> ALLOC_DAQ -> ALLOC_ODT -> ALLOC_ODT_ENTRY -> WRITE_DAQ); a
+ * command out of that order is rejected with ERR_SEQUENCE.
+ */
+
+#include "xcp.h"
+#include "hal_can.h"
+#include <stddef.h>            /* For NULL */
+#include <string.h>
+
+/*--------------------------PROTOCOL CONSTANTS-----------------------------------*/
+
+/* Command codes */
+#define CC_CONNECT                  0xFFu
+#define CC_DISCONNECT               0xFEu
+#define CC_GET_STATUS               0xFDu
+#define CC_SYNCH                    0xFCu
+#define CC_GET_COMM_MODE_INFO       0xFBu
+#define CC_SET_MTA                  0xF6u
+#define CC_UPLOAD                   0xF5u
+#define CC_SHORT_UPLOAD             0xF4u
+#define CC_DOWNLOAD                 0xF0u
+#define CC_SHORT_DOWNLOAD           0xEDu
+#define CC_SET_DAQ_PTR              0xE2u
+#define CC_WRITE_DAQ                0xE1u
+#define CC_SET_DAQ_LIST_MODE        0xE0u
+#define CC_START_STOP_DAQ_LIST      0xDEu
+#define CC_START_STOP_SYNCH         0xDDu
+#define CC_GET_DAQ_PROCESSOR_INFO   0xDAu
+#define CC_FREE_DAQ                 0xD6u
+#define CC_ALLOC_DAQ                0xD5u
+#define CC_ALLOC_ODT                0xD4u
+#define CC_ALLOC_ODT_ENTRY          0xD3u
+
+/* Packet identifiers */
+#define PID_RES                     0xFFu
+#define PID_ERR                     0xFEu
+
+/* Error codes */
+#define ERR_CMD_SYNCH               0x00u
+#define ERR_CMD_UNKNOWN             0x20u
+#define ERR_CMD_SYNTAX              0x21u
+#define ERR_OUT_OF_RANGE            0x22u
+#define ERR_WRITE_PROTECTED         0x23u
+#define ERR_ACCESS_DENIED           0x24u
+#define ERR_SEQUENCE                0x29u
+#define ERR_DAQ_CONFIG              0x2Au
+#define ERR_MEMORY_OVERFLOW         0x30u
+
+/* CONNECT response */
+#define RESOURCE_CAL_PAG            0x01u
+#define RESOURCE_DAQ                0x04u
+#define COMM_MODE_BASIC_INTEL       0x00u   /* Intel byte order, byte granularity, no block mode */
+#define XCP_PROTOCOL_VERSION        0x01u
+#define XCP_TRANSPORT_VERSION       0x01u
+
+/* GET_STATUS session status */
+#define SESSION_DAQ_RUNNING         0x40u
+
+/* DAQ list mode bits (SET_DAQ_LIST_MODE / GET_DAQ_LIST_MODE) */
+#define DAQ_MODE_SELECTED           0x01u
+#define DAQ_MODE_RUNNING            0x40u
+#define DAQ_MODE_UNSUPPORTED        0x32u   /* STIM direction, timestamp, PID_OFF */
+
+/* GET_DAQ_PROCESSOR_INFO */
+#define DAQ_PROPERTY_DYNAMIC        0x01u
+#define DAQ_PROPERTY_PRESCALER      0x10u
+#define DAQ_KEY_ABSOLUTE_ODT        0x00u   /* Identification field: absolute ODT number (1 byte) */
+
+/** Payload bytes available after the PID in one DAQ DTO. */
+#define ODT_PAYLOAD                 (XCP_MAX_DTO - 1u)
+
+/*--------------------------PRIVATE TYPES-----------------------------------*/
+
+/** @brief One ODT entry, resolved to RAM by WRITE_DAQ. */
+typedef struct {
+    const uint8_t *ptr;     /**< Source bytes (NULL: not written yet). */
+    uint8_t        size;    /**< Bytes to sample. */
+} odt_entry_t;
+
+/** @brief One ODT (one DTO per event). */
+typedef struct {
+    uint8_t first_entry;    /**< Index of the first entry in the entry pool. */
+    uint8_t entry_count;    /**< Entries allocated. */
+} odt_t;
+
+/** @brief One DAQ list. */
+typedef struct {
+    uint8_t first_odt;      /**< Index of the first ODT in the ODT pool (= first PID). */
+    uint8_t odt_count;      /**< ODTs allocated. */
+    uint8_t mode;           /**< DAQ_MODE_* bits. */
+    uint8_t event;          /**< Event channel. */
+    uint8_t prescaler;      /**< Transmit every n-th event (>= 1). */
+    uint8_t prescaler_cnt;  /**< Events since the last transmission. */
+} daq_list_t;
+
+/** @brief Allocation sequence state. */
+typedef enum {
+    ALLOC_FREE,             /**< After FREE_DAQ. */
+    ALLOC_DAQ_DONE,         /**< After ALLOC_DAQ. */
+    ALLOC_ODT_DONE,         /**< After ALLOC_ODT. */
+    ALLOC_ENTRY_DONE        /**< After ALLOC_ODT_ENTRY. */
+} alloc_state_t;
+
+/*--------------------------PRIVATE VARIABLES-----------------------------------*/
+
+static const XcpSegment_t *seg_tab = NULL;  /**< Address map. */
+static uint8_t seg_count = 0;
+
+static bool connected = false;
+static uint32_t mta = 0;                    /**< Memory transfer address. */
+
+static daq_list_t  daq_pool[XCP_MAX_DAQ];
+static odt_t       odt_pool[XCP_MAX_ODT];
+static odt_entry_t entry_pool[XCP_MAX_ODT_ENTRIES];
+static uint8_t daq_used = 0, odt_used = 0, entry_used = 0;
+static alloc_state_t alloc_state = ALLOC_FREE;
+
+/** @brief DAQ pointer (SET_DAQ_PTR), auto-incremented by WRITE_DAQ. */
+static struct {
+    uint8_t daq, odt, entry;
+    bool    valid;
+} daq_ptr;
+
+static XcpStats_t stats;
+
+
+/*--------------------------PRIVATE FUNCTIONS-----------------------------------*/
+
+/** @brief Reads a little-endian 16-bit value. */
+static uint16_t rd16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/** @brief Reads a little-endian 32-bit value. */
+static uint32_t rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief Translates an XCP address range to RAM.
+ *
+ * @param[in]  addr  XCP address.
+ * @param[in]  len   Bytes to access.
+ * @param[in]  write True for a write access.
+ * @param[out] err   Error code when the access is refused.
+ * @return uint8_t* RAM address, NULL if the range is not inside one segment.
+ */
+static uint8_t *translate(uint32_t addr, uint32_t len, bool write, uint8_t *err) {
+    for (uint8_t i = 0; i < seg_count; i++) {
+        const XcpSegment_t *s = &seg_tab[i];
+        uint32_t off = addr - s->addr;                  /* Wraps (huge) below the segment */
+        if (off >= s->size || len > s->size - off) continue;
+        if (write && !s->writable) {
+            *err = ERR_WRITE_PROTECTED;
+            return NULL;
+        }
+        return (uint8_t *)s->ptr + off;
+    }
+    *err = ERR_ACCESS_DENIED;
+    return NULL;
+}
+
+/** @brief Sends a response DTO. */
+static void send_dto(const uint8_t *data, uint8_t len) {
+    hal_can_send(XCP_DTO_ID, data, len);
+}
+
+/** @brief Sends the positive response without parameters. */
+static void send_ok(void) {
+    uint8_t res = PID_RES;
+    send_dto(&res, 1);
+}
+
+/** @brief Sends a negative response. */
+static void send_err(uint8_t code) {
+    uint8_t res[2] = { PID_ERR, code };
+    stats.errors++;
+    send_dto(res, 2);
+}
+
+/** @brief True if any DAQ list is running. */
+static bool daq_running(void) {
+    for (uint8_t i = 0; i < daq_used; i++) {
+        if (daq_pool[i].mode & DAQ_MODE_RUNNING) return true;
+    }
+    return false;
+}
+
+/** @brief Stops every DAQ list (DISCONNECT, START_STOP_SYNCH stop all). */
+static void daq_stop_all(void) {
+    for (uint8_t i = 0; i < daq_used; i++) {
+        daq_pool[i].mode &= (uint8_t)~(DAQ_MODE_RUNNING | DAQ_MODE_SELECTED);
+    }
+}
+
+/** @brief Releases the whole DAQ configuration. */
+static void daq_free(void) {
+    memset(daq_pool, 0, sizeof(daq_pool));
+    memset(odt_pool, 0, sizeof(odt_pool));
+    memset(entry_pool, 0, sizeof(entry_pool));
+    daq_used = odt_used = entry_used = 0;
+    alloc_state = ALLOC_FREE;
+    daq_ptr.valid = false;
+}
+
+/** @brief Reads `n` bytes at the MTA into a positive response and advances the MTA. */
+static void upload(uint8_t n) {
+    uint8_t res[XCP_MAX_DTO];
+    uint8_t err;
+
+    if (n == 0u || n > XCP_MAX_DTO - 1u) { send_err(ERR_OUT_OF_RANGE); return; }
+    const uint8_t *src = translate(mta, n, false, &err);
+    if (src == NULL) { send_err(err); return; }
+
+    res[0] = PID_RES;
+    memcpy(&res[1], src, n);
+    mta += n;
+    send_dto(res, (uint8_t)(n + 1u));
+}
+
+/** @brief Writes `n` bytes at the MTA and advances the MTA. */
+static void download(const uint8_t *data, uint8_t n) {
+    uint8_t err;
+
+    uint8_t *dst = translate(mta, n, true, &err);
+    if (dst == NULL) { send_err(err); return; }
+
+    memcpy(dst, data, n);
+    mta += n;
+    send_ok();
+}
+
+/** @brief Sum of the entry sizes of one ODT. */
+static uint8_t odt_size(const odt_t *odt) {
+    uint8_t size = 0;
+    for (uint8_t e = 0; e < odt->entry_count; e++) {
+        size = (uint8_t)(size + entry_pool[odt->first_entry + e].size);
+    }
+    return size;
+}
+
+/** @brief Handles the DAQ configuration and control commands. */
+static void handle_daq(const uint8_t *cro, uint8_t len) {
+    uint8_t res[XCP_MAX_DTO] = { PID_RES };
+
+    switch (cro[0]) {
+    case CC_FREE_DAQ:
+        daq_free();
+        send_ok();
+        return;
+
+    case CC_ALLOC_DAQ: {
+        if (len < 4u) { send_err(ERR_CMD_SYNTAX); return; }
+        uint16_t count = rd16(&cro[2]);
+        if (alloc_state != ALLOC_FREE) { send_err(ERR_SEQUENCE); return; }
+        if (count > XCP_MAX_DAQ) { send_err(ERR_MEMORY_OVERFLOW); return; }
+        daq_used = (uint8_t)count;
+        for (uint8_t i = 0; i < daq_used; i++) daq_pool[i].prescaler = 1;
+        alloc_state = ALLOC_DAQ_DONE;
+        send_ok();
+        return;
+    }
+
+    case CC_ALLOC_ODT: {
+        if (len < 5u) { send_err(ERR_CMD_SYNTAX); return; }
+        uint16_t daq = rd16(&cro[2]);
+        uint8_t  count = cro[4];
+        if (alloc_state != ALLOC_DAQ_DONE && alloc_state != ALLOC_ODT_DONE) { send_err(ERR_SEQUENCE); return; }
+        if (daq >= daq_used || daq_pool[daq].odt_count != 0u) { send_err(ERR_OUT_OF_RANGE); return; }
+        if (count > XCP_MAX_ODT - odt_used) { send_err(ERR_MEMORY_OVERFLOW); return; }
+        daq_pool[daq].first_odt = odt_used;
+        daq_pool[daq].odt_count = count;
+        odt_used = (uint8_t)(odt_used + count);
+        alloc_state = ALLOC_ODT_DONE;
+        send_ok();
+        return;
+    }
+
+    case CC_ALLOC_ODT_ENTRY: {
+        if (len < 6u) { send_err(ERR_CMD_SYNTAX); return; }
+        uint16_t daq = rd16(&cro[2]);
+        uint8_t  odt = cro[4];
+        uint8_t  count = cro[5];
+        if (alloc_state != ALLOC_ODT_DONE && alloc_state != ALLOC_ENTRY_DONE) { send_err(ERR_SEQUENCE); return; }
+        if (daq >= daq_used || odt >= daq_pool[daq].odt_count) { send_err(ERR_OUT_OF_RANGE); return; }
+        odt_t *o = &odt_pool[daq_pool[daq].first_odt + odt];
+        if (o->entry_count != 0u) { send_err(ERR_SEQUENCE); return; }
+        if (count > XCP_MAX_ODT_ENTRIES - entry_used) { send_err(ERR_MEMORY_OVERFLOW); return; }
+        o->first_entry = entry_used;
+        o->entry_count = count;
+        entry_used = (uint8_t)(entry_used + count);
+        alloc_state = ALLOC_ENTRY_DONE;
+        send_ok();
+        return;
+    }
+
+    case CC_SET_DAQ_PTR: {
+        if (len < 6u) { send_err(ERR_CMD_SYNTAX); return; }
+        uint16_t daq = rd16(&cro[2]);
+        uint8_t  odt = cro[4];
+        uint8_t  entry = cro[5];
+        if (daq >= daq_used || odt >= daq_pool[daq].odt_count ||
+            entry >= odt_pool[daq_pool[daq].first_odt + odt].entry_count) {
+            send_err(ERR_OUT_OF_RANGE);
+            return;
+        }
+        if (daq_pool[daq].mode & DAQ_MODE_RUNNING) { send_err(ERR_DAQ_CONFIG); return; }
+        daq_ptr.daq = (uint8_t)daq;
+        daq_ptr.odt = odt;
+        daq_ptr.entry = entry;
+        daq_ptr.valid = true;
+        send_ok();
+        return;
+    }
+
+    case CC_WRITE_DAQ: {
+        if (len < 8u) { send_err(ERR_CMD_SYNTAX); return; }
+        uint8_t  size = cro[2];
+        uint32_t addr = rd32(&cro[4]);               /* cro[1] bit offset, cro[3] extension: unused */
+        uint8_t  err;
+        if (!daq_ptr.valid) { send_err(ERR_SEQUENCE); return; }
+
+        odt_t *o = &odt_pool[daq_pool[daq_ptr.daq].first_odt + daq_ptr.odt];
+        odt_entry_t *e = &entry_pool[o->first_entry + daq_ptr.entry];
+        uint8_t used = (uint8_t)(odt_size(o) - e->size);
+        if (size == 0u || size > ODT_PAYLOAD - used) { send_err(ERR_DAQ_CONFIG); return; }
+
+        const uint8_t *src = translate(addr, size, false, &err);
+        if (src == NULL) { send_err(err); return; }
+
+        e->ptr = src;
+        e->size = size;
+        /* Auto-increment within the ODT; past the last entry the pointer is invalid */
+        if (++daq_ptr.entry >= o->entry_count) daq_ptr.valid = false;
+        send_ok();
+        return;
+    }
+
+    case CC_SET_DAQ_LIST_MODE: {
+        if (len < 8u) { send_err(ERR_CMD_SYNTAX); return; }
+        uint16_t daq = rd16(&cro[2]);
+        uint16_t event = rd16(&cro[4]);
+        uint8_t  prescaler = cro[6];                 /* cro[1] mode (timestamp / direction), cro[7] priority: unused */
+        if (daq >= daq_used || event >= XCP_EVENT_COUNT || prescaler == 0u) { send_err(ERR_OUT_OF_RANGE); return; }
+        if (cro[1] & DAQ_MODE_UNSUPPORTED) { send_err(ERR_OUT_OF_RANGE); return; }
+        if (daq_pool[daq].mode & DAQ_MODE_RUNNING) { send_err(ERR_DAQ_CONFIG); return; }
+        daq_pool[daq].event = (uint8_t)event;
+        daq_pool[daq].prescaler = prescaler;
+        daq_pool[daq].prescaler_cnt = 0;
+        send_ok();
+        return;
+    }
+
+    case CC_START_STOP_DAQ_LIST: {
+        if (len < 4u) { send_err(ERR_CMD_SYNTAX); return; }
+        uint8_t  mode = cro[1];
+        uint16_t daq = rd16(&cro[2]);
+        if (daq >= daq_used || mode > 2u) { send_err(ERR_OUT_OF_RANGE); return; }
+        daq_list_t *d = &daq_pool[daq];
+        if (mode != 0u) {
+            /* Every entry must be written before the list can run */
+            for (uint8_t o = 0; o < d->odt_count; o++) {
+                const odt_t *odt = &odt_pool[d->first_odt + o];
+                for (uint8_t e = 0; e < odt->entry_count; e++) {
+                    if (entry_pool[odt->first_entry + e].ptr == NULL) { send_err(ERR_DAQ_CONFIG); return; }
+                }
+            }
+        }
+        if (mode == 0u)      d->mode &= (uint8_t)~(DAQ_MODE_RUNNING | DAQ_MODE_SELECTED);
+        else if (mode == 1u) { d->mode |= DAQ_MODE_RUNNING; d->prescaler_cnt = 0; }
+        else                 d->mode |= DAQ_MODE_SELECTED;
+        res[1] = d->first_odt;                       /* FIRST_PID */
+        send_dto(res, 2);
+        return;
+    }
+
+    case CC_START_STOP_SYNCH: {
+        if (len < 2u) { send_err(ERR_CMD_SYNTAX); return; }
+        uint8_t mode = cro[1];
+        if (mode > 2u) { send_err(ERR_OUT_OF_RANGE); return; }
+        for (uint8_t i = 0; i < daq_used; i++) {
+            daq_list_t *d = &daq_pool[i];
+            if (mode == 0u) {
+                d->mode &= (uint8_t)~(DAQ_MODE_RUNNING | DAQ_MODE_SELECTED);
+            } else if (d->mode & DAQ_MODE_SELECTED) {
+                if (mode == 1u) { d->mode |= DAQ_MODE_RUNNING; d->prescaler_cnt = 0; }
+                else            d->mode &= (uint8_t)~DAQ_MODE_RUNNING;
+                d->mode &= (uint8_t)~DAQ_MODE_SELECTED;
+            }
+        }
+        send_ok();
+        return;
+    }
+
+    case CC_GET_DAQ_PROCESSOR_INFO:
+        res[1] = DAQ_PROPERTY_DYNAMIC | DAQ_PROPERTY_PRESCALER;
+        res[2] = XCP_MAX_DAQ;                        /* MAX_DAQ */
+        res[3] = 0;
+        res[4] = XCP_EVENT_COUNT;                    /* MAX_EVENT_CHANNEL */
+        res[5] = 0;
+        res[6] = 0;                                  /* MIN_DAQ: no predefined lists */
+        res[7] = DAQ_KEY_ABSOLUTE_ODT;
+        send_dto(res, 8);
+        return;
+
+    default:
+        send_err(ERR_CMD_UNKNOWN);
+        return;
+    }
+}
+
+
+/*--------------------------PUBLIC FUNCTIONS-----------------------------------*/
+
+void xcp_init(const XcpSegment_t *segments, uint8_t count) {
+    seg_tab = segments;
+    seg_count = count;
+    connected = false;
+    mta = 0;
+    memset(&stats, 0, sizeof(stats));
+    daq_free();
+}
+
+void xcp_rx(const uint8_t *cro, uint8_t len) {
+    uint8_t res[XCP_MAX_DTO] = { PID_RES };
+
+    if (len == 0u) return;
+
+    /* Until CONNECT the slave stays silent */
+    if (!connected && cro[0] != CC_CONNECT) return;
+    stats.commands++;
+
+    switch (cro[0]) {
+    case CC_CONNECT:
+        connected = true;
+        res[1] = RESOURCE_CAL_PAG | RESOURCE_DAQ;
+        res[2] = COMM_MODE_BASIC_INTEL;
+        res[3] = XCP_MAX_CTO;
+        res[4] = XCP_MAX_DTO;                        /* MAX_DTO, Intel order */
+        res[5] = 0;
+        res[6] = XCP_PROTOCOL_VERSION;
+        res[7] = XCP_TRANSPORT_VERSION;
+        send_dto(res, 8);
+        return;
+
+    case CC_DISCONNECT:
+        daq_stop_all();
+        connected = false;
+        send_ok();
+        return;
+
+    case CC_GET_STATUS:
+        res[1] = daq_running() ? SESSION_DAQ_RUNNING : 0u;
+        res[2] = 0;                                  /* No resource is protected */
+        send_dto(res, 6);
+        return;
+
+    case CC_SYNCH:
+        send_err(ERR_CMD_SYNCH);
+        return;
+
+    case CC_GET_COMM_MODE_INFO:
+        res[6] = 0;                                  /* QUEUE_SIZE: no interleaved mode */
+        res[7] = 0x10;                               /* Driver version 1.0 */
+        send_dto(res, 8);
+        return;
+
+    case CC_SET_MTA:
+        if (len < 8u) { send_err(ERR_CMD_SYNTAX); return; }
+        mta = rd32(&cro[4]);                         /* Address extension (cro[3]) unused */
+        send_ok();
+        return;
+
+    case CC_UPLOAD:
+        if (len < 2u) { send_err(ERR_CMD_SYNTAX); return; }
+        upload(cro[1]);
+        return;
+
+    case CC_SHORT_UPLOAD:
+        if (len < 8u) { send_err(ERR_CMD_SYNTAX); return; }
+        mta = rd32(&cro[4]);
+        upload(cro[1]);
+        return;
+
+    case CC_DOWNLOAD:
+        if (len < 2u) { send_err(ERR_CMD_SYNTAX); return; }
+        if (cro[1] == 0u || cro[1] > XCP_MAX_CTO - 2u) { send_err(ERR_OUT_OF_RANGE); return; }
+        if (len < (uint8_t)(cro[1] + 2u)) { send_err(ERR_CMD_SYNTAX); return; }
+        download(&cro[2], cro[1]);
+        return;
+
+    case CC_SHORT_DOWNLOAD:
+        /* Header is 8 bytes: with MAX_CTO = 8 the data only fits on CAN FD */
+        if (len < 8u) { send_err(ERR_CMD_SYNTAX); return; }
+        if (cro[1] == 0u || cro[1] > len - 8u) { send_err(ERR_OUT_OF_RANGE); return; }
+        mta = rd32(&cro[4]);
+        download(&cro[8], cro[1]);
+        return;
+
+    case CC_FREE_DAQ:
+    case CC_ALLOC_DAQ:
+    case CC_ALLOC_ODT:
+    case CC_ALLOC_ODT_ENTRY:
+        if (daq_running()) { send_err(ERR_DAQ_CONFIG); return; }
+        handle_daq(cro, len);
+        return;
+
+    default:
+        handle_daq(cro, len);
+        return;
+    }
+}
+
+void xcp_event(uint8_t event) {
+    hal_can_frame_t batch[XCP_MAX_ODT];
+    uint8_t n = 0;
+
+    if (!connected) return;
+
+    for (uint8_t i = 0; i < daq_used; i++) {
+        daq_list_t *d = &daq_pool[i];
+        if (!(d->mode & DAQ_MODE_RUNNING) || d->event != event) continue;
+        if (++d->prescaler_cnt < d->prescaler) continue;
+        d->prescaler_cnt = 0;
+
+        /* One DTO per ODT: absolute ODT number, then the entries back to back */
+        for (uint8_t o = 0; o < d->odt_count; o++) {
+            const odt_t *odt = &odt_pool[d->first_odt + o];
+            hal_can_frame_t *f = &batch[n++];
+            uint8_t len = 1;
+
+            f->id = XCP_DTO_ID;
+            f->data[0] = (uint8_t)(d->first_odt + o);
+            for (uint8_t e = 0; e < odt->entry_count; e++) {
+                const odt_entry_t *ent = &entry_pool[odt->first_entry + e];
+                memcpy(&f->data[len], ent->ptr, ent->size);
+                len = (uint8_t)(len + ent->size);
+            }
+            f->len = len;
+        }
+    }
+
+    if (n == 0u) return;
+
+    /* Every ODT of the event goes out in one batch, sampled at the same instant */
+    int sent = hal_can_send_frames(batch, n);
+    if (sent < 0) sent = 0;
+    stats.daq_frames += (uint32_t)sent;
+    stats.daq_overruns += (uint32_t)(n - sent);
+}
+
+bool xcp_isConnected(void) {
+    return connected;
+}
+
+void xcp_getStats(XcpStats_t *out) {
+    if (out != NULL) *out = stats;
+}
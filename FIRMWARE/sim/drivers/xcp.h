@@ -0,0 +1,114 @@
+/**
+ * @file xcp.h
+ * @brief XCP-on-CAN slave: memory access for calibration and synchronous DAQ measurement.
+ *
+ * @details
+ * Implements the subset of ASAM XCP 1.x needed to tune and observe the wheel
+ * from a standard calibration tool or from `tools/xcp_master.py`:
+ *
+ * - Session: CONNECT, DISCONNECT, GET_STATUS, SYNCH, GET_COMM_MODE_INFO.
+ * - Memory: SET_MTA, UPLOAD, SHORT_UPLOAD, DOWNLOAD, SHORT_DOWNLOAD.
+ * - Dynamic DAQ: FREE_DAQ, ALLOC_DAQ, ALLOC_ODT, ALLOC_ODT_ENTRY, SET_DAQ_PTR,
+ *   WRITE_DAQ, SET_DAQ_LIST_MODE, START_STOP_DAQ_LIST, START_STOP_SYNCH,
+ *   GET_DAQ_PROCESSOR_INFO.
+ *
+ * Transport: classic CAN, CRO (master -> slave) ::XCP_CRO_ID, DTO (responses
+ * and DAQ) ::XCP_DTO_ID, MAX_CTO = MAX_DTO = 8, Intel byte order, byte
+ * address granularity, absolute ODT numbers as DAQ identification field.
+ *
+ * Memory is only reachable through the segments registered with ::xcp_init:
+ * every XCP address is translated to a segment (bounds checked) so the same
+ * address map (and A2L) works on the target and on the 64-bit host sim, and
+ * nothing outside the registered variables can be read or written.
+ *
+ * DAQ lists are bound to events; ::xcp_event is called by the application
+ * once per main-loop slot (::XCP_EVENT_MAIN_LOOP), which samples the ODT
+ * entries and sends one DTO per ODT. Entry addresses are resolved when the
+ * list is configured, so an event only copies bytes.
+ *
+ * All DAQ memory comes from fixed pools (::XCP_MAX_DAQ, ::XCP_MAX_ODT,
+ * ::XCP_MAX_ODT_ENTRIES); nothing is allocated at run time.
+ */
+
+#ifndef XCP_H
+#define XCP_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define XCP_CRO_ID            0x7E0u  /**< Command / stimulation frames (master -> slave). */
+#define XCP_DTO_ID            0x7E1u  /**< Response / event / DAQ frames (slave -> master). */
+
+#define XCP_MAX_CTO           8u      /**< Maximum command frame length. */
+#define XCP_MAX_DTO           8u      /**< Maximum data frame length. */
+
+#define XCP_MAX_DAQ           4u      /**< DAQ lists in the pool. */
+#define XCP_MAX_ODT           16u     /**< ODTs in the pool (shared by all DAQ lists). */
+#define XCP_MAX_ODT_ENTRIES   64u     /**< ODT entries in the pool (shared by all ODTs). */
+
+#define XCP_EVENT_MAIN_LOOP   0u      /**< Event channel: end of every main-loop slot. */
+#define XCP_EVENT_COUNT       1u      /**< Number of event channels. */
+
+/*--------------------------DATA TYPES-----------------------------------*/
+
+/**
+ * @brief Memory segment reachable by the master.
+ */
+typedef struct {
+    uint32_t addr;          /**< XCP address of the first byte. */
+    void    *ptr;           /**< RAM backing the segment. */
+    uint32_t size;          /**< Size in bytes. */
+    bool     writable;      /**< DOWNLOAD allowed (calibration); read-only otherwise. */
+} XcpSegment_t;
+
+/**
+ * @brief Slave counters (diagnostics).
+ */
+typedef struct {
+    uint32_t commands;      /**< Commands processed. */
+    uint32_t errors;        /**< Negative responses sent. */
+    uint32_t daq_frames;    /**< DAQ DTOs queued. */
+    uint32_t daq_overruns;  /**< DAQ DTOs lost because the TX path was full. */
+} XcpStats_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Initializes the slave (disconnected, DAQ pool free).
+ *
+ * @param[in] segments Segment table (must stay valid: it is not copied).
+ * @param[in] count    Number of segments.
+ */
+void xcp_init(const XcpSegment_t *segments, uint8_t count);
+
+/**
+ * @brief Processes one command frame (CRO) and sends its response.
+ *
+ * @param[in] cro Frame payload.
+ * @param[in] len Payload length.
+ */
+void xcp_rx(const uint8_t *cro, uint8_t len);
+
+/**
+ * @brief Samples and transmits the running DAQ lists bound to an event.
+ *
+ * @param[in] event Event channel (::XCP_EVENT_MAIN_LOOP).
+ */
+void xcp_event(uint8_t event);
+
+/**
+ * @brief Returns true while a master is connected.
+ */
+bool xcp_isConnected(void);
+
+/**
+ * @brief Returns the slave counters.
+ *
+ * @param[out] stats Destination structure.
+ */
+void xcp_getStats(XcpStats_t *stats);
+
+#endif /* XCP_H */
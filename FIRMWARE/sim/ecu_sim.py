@@ -20,13 +20,16 @@ This script requires:
       sudo modprobe vcan
       sudo ip link add dev vcan0 type vcan
       sudo ip link set up vcan0
+- Or, without kernel support, the user-space virtual bus:
+      F1_CAN_IF=vbus:default python ecu_sim.py
+  (the firmware sim must be started with the same F1_CAN_IF value)
 
 @usage
 Run this script alongside the Steering Wheel firmware running on PC
 (simulated with SocketCAN). The two will exchange CAN frames in real-time.
 """
 
-import cantools, can, time, random
+import cantools, can, time, random, os, sys
 
 # --------------------------------------------------------------------------
 # Initialization
@@ -35,9 +38,16 @@ import cantools, can, time, random
 # Load the CAN database (.dbc file) containing message definitions
 db = cantools.database.load_file("drivers/steering_wheel.dbc")
 
-# Initialize virtual CAN bus (SocketCAN interface)
-#bus = can.interface.Bus(channel='vcan0', bustype='socketcan')
-bus = can.interface.Bus(channel='can0', bustype='socketcan')
+# Select the CAN interface: SocketCAN (vcan0, can0) or user-space virtual bus (vbus:<name>)
+channel = os.environ.get("F1_CAN_IF", "vcan0")
+
+if channel.startswith("vbus:"):
+    sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "tools"))
+    from vbus import VirtualBus
+    bus = VirtualBus(channel)
+else:
+    # Initialize CAN bus (SocketCAN interface)
+    bus = can.interface.Bus(channel=channel, bustype='socketcan')
 
 
 
@@ -25,6 +25,7 @@
 
 // --- INCLUDES ---
 #include <stdint.h> /**< Provides fixed-width integer types (e.g., uint8_t, uint16_t). */
+#include "hal_adc_port.h"   /* Board channels: HAL_ADC_CH_CLUTCH, HAL_ADC_CH_ROTARY */
 
 /*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
 
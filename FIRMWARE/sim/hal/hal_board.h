@@ -0,0 +1,91 @@
+/**
+ * @file hal_board.h
+ * @brief Hardware Abstraction Layer (HAL) interface for the board bring-up of the application.
+ *
+ * @details
+ * What app/app_main.c needs from the platform besides the peripheral HALs:
+ * the board settings (hal_board_port.h), the clock and display stages of the
+ * boot sequence, and the hooks of the main loop.
+ *
+ * - **Target (S32K118)**: the SPI is clocked from SOSCDIV2, so the crystal
+ *   oscillator is a boot stage of its own. No panel fitted; the main loop
+ *   runs forever and waits for the end of a slot by polling the bus.
+ * - **Host (Linux/PC)**: no oscillator to wait for. The display stage opens
+ *   the SDL window; the main loop presents the frame, handles the window
+ *   events (closing it ends the loop) and sleeps while it waits.
+ */
+
+#ifndef HAL_BOARD_H
+#define HAL_BOARD_H
+
+// --- INCLUDES ---
+#include <stdbool.h>
+#include "hal_board_port.h"   /* HAL_BOARD_LCD_FITTED, HAL_BOARD_TP_BUF_SIZE, HAL_BOARD_UI_PERIOD_MS */
+
+/**
+ * @def HAL_BOARD_LCD_FITTED
+ * @brief 1 when the ILI9341 panel (or its simulation) is fitted: display boot stage and pages drawn.
+ *
+ * @def HAL_BOARD_TP_BUF_SIZE
+ * @brief ISO-TP receive buffer (bytes): the largest message accepted from the tester.
+ *
+ * @def HAL_BOARD_UI_PERIOD_MS
+ * @brief Default period of the text debug page (ms), 0 = off.
+ */
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Starts the clock the peripherals of the later boot stages run from.
+ *
+ * @details
+ * Returns at once: ::hal_board_clock_ready is polled by the boot sequencer.
+ */
+void hal_board_clock_start(void);
+
+/**
+ * @brief Tells whether the clock started by ::hal_board_clock_start is stable.
+ *
+ * @return bool true once the clock can be used.
+ */
+bool hal_board_clock_ready(void);
+
+/**
+ * @brief Starts the display panel (GPIO and SPI already configured).
+ *
+ * @details
+ * Returns at once: ::hal_board_display_ready is polled by the boot sequencer.
+ * Only used when ::HAL_BOARD_LCD_FITTED is 1.
+ */
+void hal_board_display_start(void);
+
+/**
+ * @brief Tells whether the display started by ::hal_board_display_start can be drawn.
+ *
+ * @return bool true once the panel is ready.
+ */
+bool hal_board_display_ready(void);
+
+/**
+ * @brief Prints the configuration of the board peripherals on the console, once after boot.
+ */
+void hal_board_dump(void);
+
+/**
+ * @brief Handles the platform events at the start of every slot.
+ *
+ * @param[in,out] running Main loop control variable, set to 0 to end the loop.
+ */
+void hal_board_poll(int *running);
+
+/**
+ * @brief Shows the frame drawn in this slot.
+ */
+void hal_board_present(void);
+
+/**
+ * @brief Called between two bus polls while the main loop waits for the end of the slot.
+ */
+void hal_board_idle(void);
+
+#endif /* HAL_BOARD_H */
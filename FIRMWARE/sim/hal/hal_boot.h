@@ -0,0 +1,66 @@
+/**
+ * @file hal_boot.h
+ * @brief Hardware Abstraction Layer (HAL) interface for the bootloader handover.
+ *
+ * @details
+ * The platform-specific parts of switching between the resident CAN bootloader
+ * and the application:
+ * - the application asks for the bootloader (reset with a request word kept
+ *   in RAM across the reset),
+ * - the bootloader reads that request once after reset,
+ * - the bootloader starts the application image.
+ *
+ * - **Target (S32K118)**: the request word lives at the end of SRAM_L, which
+ *   the startup code neither zeroes nor copies. It is only trusted after a
+ *   software reset, because after power-on the RAM content is undefined.
+ *   The application is started by loading its stack pointer and reset vector
+ *   and moving VTOR to its vector table.
+ * - **Host (Linux/PC)**: the simulator cannot execute the image. Requesting
+ *   the bootloader ends the application process (exit code
+ *   ::HAL_BOOT_EXIT_REQUEST) so a script can start the bootloader binary,
+ *   which always stays in the bootloader. Starting the application ends the
+ *   bootloader (exit code 0).
+ */
+
+#ifndef HAL_BOOT_H
+#define HAL_BOOT_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define HAL_BOOT_EXIT_REQUEST  3   /**< Host: exit code of an application that asked for the bootloader. */
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Resets into the bootloader and stays there (application side).
+ *
+ * @details
+ * Does not return.
+ */
+void hal_boot_request(void);
+
+/**
+ * @brief Tells whether the application asked for the bootloader before the last reset.
+ *
+ * @details
+ * Clears the request, so the next reset starts the application again.
+ *
+ * @return bool true if ::hal_boot_request caused the reset.
+ */
+bool hal_boot_requested(void);
+
+/**
+ * @brief Starts the application whose vector table is at @p base.
+ *
+ * @details
+ * Does not return. The caller shuts the peripherals it used down first.
+ *
+ * @param[in] base Vector table address of the application.
+ */
+void hal_boot_jump(uint32_t base);
+
+#endif /* HAL_BOOT_H */
@@ -12,7 +12,10 @@
  *
  * Supported operations:
  * - CAN interface initialization.
- * - Frame transmission and reception.
+ * - Frame transmission and reception (single frame or batched).
+ * - Hardware / kernel acceptance filtering of incoming identifiers.
+ * - Receive timestamps passed up to the driver.
+ * - Controller health: error counters, fault confinement state, overruns, bus time.
  * - Graceful interface shutdown and cleanup.
  *
  * @note
@@ -26,6 +29,75 @@
 
 // --- INCLUDES ---
 #include <stdint.h> /**< Provides fixed-width integer types like uint8_t and uint32_t. */
+#include "hal_can_port.h"   /* HAL_CAN_DEFAULT_IF */
+
+/*--------------------------PUBLIC DEFINES AND TYPES--------------------------------*/
+
+#define HAL_CAN_MAX_DLEN     8   /**< Maximum payload of a classic CAN frame (bytes). */
+#define HAL_CAN_MAX_FILTERS  7   /**< Maximum number of acceptance filters (one RX mailbox each on FlexCAN). */
+#define HAL_CAN_STD_MASK     0x7FFu /**< Mask that compares all bits of an 11-bit identifier. */
+
+/**
+ * @brief CAN frame as exchanged between the HAL and the drivers.
+ */
+typedef struct {
+    uint32_t id;                        /**< CAN identifier (11-bit standard). */
+    uint8_t  len;                       /**< Payload length (DLC, 0–8). */
+    uint8_t  data[HAL_CAN_MAX_DLEN];    /**< Payload bytes. */
+    uint32_t timestamp_us;              /**< Receive time in µs, ::hal_can_get_time_us timebase (wraps every ~71 min). */
+} hal_can_frame_t;
+
+/**
+ * @brief Acceptance filter entry.
+ *
+ * @details
+ * A received frame is accepted when `(frame_id & mask) == (id & mask)`.
+ * The same table is installed as FlexCAN RX mailboxes/RXIMR masks on the target
+ * and as `CAN_RAW_FILTER` entries on the host, so both platforms see the same traffic.
+ */
+typedef struct {
+    uint32_t id;    /**< Identifier to accept. */
+    uint32_t mask;  /**< Identifier bits that must match (1 = compare). */
+} hal_can_filter_t;
+
+/**
+ * @brief Fault confinement state of the CAN controller.
+ */
+typedef enum {
+    HAL_CAN_ERR_ACTIVE  = 0,    /**< Error active (TEC and REC < 128). */
+    HAL_CAN_ERR_PASSIVE = 1,    /**< Error passive (TEC or REC >= 128). */
+    HAL_CAN_BUS_OFF     = 2     /**< Bus off (TEC > 255), controller not participating. */
+} hal_can_err_state_t;
+
+/**
+ * @brief Controller health and traffic counters (all counters wrap).
+ */
+typedef struct {
+    uint8_t  tx_err_count;      /**< Transmit error counter (TEC). */
+    uint8_t  rx_err_count;      /**< Receive error counter (REC). */
+    uint8_t  err_state;         /**< Fault confinement state (::hal_can_err_state_t). */
+    uint32_t bus_off_events;    /**< Number of transitions to bus off. */
+    uint32_t rx_overruns;       /**< Frames lost before the driver read them (mailbox / socket overrun). */
+    uint32_t rx_errors;         /**< Receive-side protocol errors seen (CRC, form, stuff). */
+    uint32_t tx_retries;        /**< Transmissions repeated after an error (ACK, bit error) or lost arbitration. */
+    uint32_t tx_dropped;        /**< Frames refused because the transmit path was full. */
+    uint32_t rx_frames;         /**< Frames delivered to the driver. */
+    uint32_t tx_frames;         /**< Frames queued for transmission. */
+    uint32_t rx_bits;           /**< Worst-case bits of the received frames (see ::hal_can_frame_bits). */
+    uint32_t tx_bits;           /**< Worst-case bits of the transmitted frames. */
+    uint32_t bit_time;          /**< Free-running bus time in bit times (FlexCAN TIMER extended to 32 bits). */
+    uint32_t bitrate;           /**< Nominal bit-rate (bit/s). */
+} hal_can_stats_t;
+
+/**
+ * @brief Worst-case length in bits of a standard (11-bit ID) data frame.
+ * @details 8n + 44 bits of frame plus the maximum number of stuff bits,
+ *          floor((34 + 8n - 1) / 4), for a payload of n bytes.
+ */
+static inline uint32_t hal_can_frame_bits(uint8_t len)
+{
+    return 8u * len + 44u + (34u + 8u * len - 1u) / 4u;
+}
 
 /*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
 
@@ -43,6 +115,8 @@
  *
  * @return int
  * @retval 0   Initialization successful.
+ * @retval -3  FlexCAN did not acknowledge freeze mode or did not become ready
+ *             in time (no CAN clock); the waits are bounded so the boot goes on.
  * @retval <0  Initialization failed (e.g., interface not found or already in use).
  */
 int hal_can_init(const char* interface_name);
@@ -83,13 +157,137 @@ int hal_can_send(uint32_t id, const uint8_t* data, uint8_t len);
  */
 int hal_can_receive(uint32_t* id, uint8_t* data, uint8_t* len);
 
+/**
+ * @brief Installs the receive acceptance filters.
+ *
+ * @details
+ * Replaces any previously installed filter set. Frames that do not match at
+ * least one entry are discarded by the hardware (FlexCAN mailbox masks) or by
+ * the kernel (SocketCAN `CAN_RAW_FILTER`) and never reach the driver.
+ * Must be called after ::hal_can_init.
+ *
+ * @param[in] filters Pointer to an array of filter entries.
+ * @param[in] count   Number of entries (1 to ::HAL_CAN_MAX_FILTERS). 0 accepts every frame.
+ *
+ * @return int
+ * @retval 0   Filters installed.
+ * @retval -3  FlexCAN did not enter or leave freeze mode in time.
+ * @retval <0  Invalid arguments or interface error.
+ */
+int hal_can_set_filters(const hal_can_filter_t* filters, uint8_t count);
+
+/**
+ * @brief Receives one CAN frame together with its receive timestamp (non-blocking).
+ *
+ * @details
+ * Implementations may drain several frames from the interface in one operation
+ * and hand them out one by one from an internal queue, so calling this function
+ * in a loop until it returns 0 is the cheap way to empty the receive path.
+ *
+ * The timestamp is the time the frame was on the bus, not the time it was read:
+ * - FlexCAN: mailbox TIME_STAMP (TIMER captured at the identifier field),
+ *   converted to the extended timebase when the mailbox is emptied, normally
+ *   by the RX interrupt. Valid if that happens within 131 ms of the arrival.
+ * - SocketCAN: kernel receive time (SO_TIMESTAMP) moved to CLOCK_MONOTONIC.
+ * - Virtual bus: time the last bit left the simulated wire (CLOCK_MONOTONIC).
+ *
+ * @param[out] frame Destination frame (ID, DLC, payload and timestamp).
+ *
+ * @return int
+ * @retval 1   A frame was received.
+ * @retval 0   No frame available.
+ * @retval <0  Receive error occurred.
+ */
+int hal_can_receive_frame(hal_can_frame_t* frame);
+
+/**
+ * @brief Transmits a batch of CAN frames.
+ *
+ * @details
+ * Queues up to @p count frames in a single operation (one `sendmmsg()` call on
+ * the host, one free TX mailbox per frame on the target). Frames that cannot
+ * be queued (no free mailbox / socket buffer full) are not sent.
+ *
+ * @param[in] frames Array of frames to send (timestamp field ignored).
+ * @param[in] count  Number of frames in the array.
+ *
+ * @return int
+ * @retval >=0 Number of frames actually queued (may be lower than @p count).
+ * @retval <0  Transmission error occurred.
+ */
+int hal_can_send_frames(const hal_can_frame_t* frames, uint8_t count);
+
+/**
+ * @brief Returns how many frames can be queued now and still leave in submission order.
+ *
+ * @details
+ * FlexCAN picks the next frame by ID and then by mailbox number, not by the
+ * order the mailboxes were filled: a frame written into a free mailbox below
+ * a pending one overtakes it. Senders whose frames share one ID and must stay
+ * in order (ISO-TP consecutive frames) queue at most this many per batch.
+ * Target: free TX mailboxes above the highest pending one (0 if a free
+ * mailbox lies below it). Host: free entries of the (FIFO) transmit queue.
+ *
+ * @return int Number of frames, 0 if the caller must wait.
+ */
+int hal_can_tx_free(void);
+
+/**
+ * @brief Moves received frames out of the controller into a RAM queue.
+ *
+ * @details
+ * FlexCAN has one RX mailbox per filter, so a burst on one ID (an ISO-TP
+ * block) would overwrite it before the main loop reads it. The RX mailbox
+ * interrupt calls this function as each frame arrives; the receive functions
+ * return the queued frames in arrival order. While the flash executes an erase
+ * or program command the CPU cannot fetch code from it (interrupts masked), so
+ * the flash driver waits in a RAM routine that calls this one instead. Each call also extends the 16-bit
+ * TIMER and every queued frame keeps its time stamp already extended, so an
+ * erase as long as a TIMER period shifts neither the timebase nor the frames.
+ * Target: runs from RAM (`.code_ram`).
+ * Host: no-op (the socket / virtual bus queues the frames).
+ */
+void hal_can_rx_stash(void);
+
+/**
+ * @brief Samples the controller health and traffic counters.
+ *
+ * @details
+ * Reads the error counters and fault confinement state, collects the error
+ * flags raised since the previous call and extends the bus timebase.
+ * On FlexCAN the TIMER register is 16 bits wide (131 ms at 500 kbit/s); the
+ * periods missed between two calls of this function, ::hal_can_get_time_us or
+ * ::hal_can_receive_frame are recovered from the ::hal_time_us clock, so
+ * ::hal_can_stats_t::bit_time stays continuous across a long display draw.
+ *
+ * @param[out] stats Destination structure.
+ *
+ * @return int
+ * @retval 0   Statistics updated.
+ * @retval <0  Interface not initialized.
+ */
+int hal_can_get_stats(hal_can_stats_t* stats);
+
+/**
+ * @brief Returns the current time of the receive timestamp timebase.
+ *
+ * @details
+ * Frame ages are `hal_can_get_time_us() - frame.timestamp_us` (wrap-safe
+ * unsigned difference). FlexCAN: extended TIMER (one tick per bit time);
+ * also keeps the extension alive, like ::hal_can_get_stats. Host: CLOCK_MONOTONIC.
+ *
+ * @return uint32_t Time in microseconds (wraps).
+ */
+uint32_t hal_can_get_time_us(void);
+
 /**
  * @brief Shuts down the CAN interface and releases all associated resources.
  *
  * @details
  * Disables or closes the CAN interface. On hardware platforms, this may disable
  * peripheral clocks or interrupts; on host-based simulations, it closes sockets
- * and frees allocated resources.
+ * and frees allocated resources. Frames already queued are first given a few
+ * milliseconds to leave (a last response before a reset).
  *
  * Should be called once when CAN communication is no longer required.
  */
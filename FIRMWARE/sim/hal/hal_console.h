@@ -0,0 +1,66 @@
+/**
+ * @file hal_console.h
+ * @brief Hardware Abstraction Layer (HAL) interface for the text command console.
+ *
+ * @details
+ * The byte transport of drivers/console.c: characters typed by the user and
+ * the text of the replies, also used by the application for its debug text.
+ * Reading and writing return at once.
+ *
+ * - **Target (S32K118)**: LPUART0. Input comes from the RX ring filled by the
+ *   LPUART interrupt, replies go into the TX ring (hal_uart.h).
+ * - **Host (Linux/PC)**: standard input (polled, line-buffered by the
+ *   terminal) and standard output.
+ */
+
+#ifndef HAL_CONSOLE_H
+#define HAL_CONSOLE_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include <stdbool.h>
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Reads the characters received so far, without waiting.
+ *
+ * @param[out] buf  Destination.
+ * @param[in]  size Capacity of buf.
+ * @return uint32_t Number of characters stored (0 if none).
+ */
+uint32_t hal_console_read(char *buf, uint32_t size);
+
+/**
+ * @brief Sends reply text.
+ *
+ * @param[in] s   Characters.
+ * @param[in] len Number of characters.
+ */
+void hal_console_write(const char *s, uint32_t len);
+
+/**
+ * @brief Selects what happens when the output is full.
+ *
+ * @details
+ * Blocking (the default) while booting; the main loop drops the text and
+ * counts it instead of stalling its slot. The host never drops output.
+ *
+ * @param[in] blocking true: wait for room. false: drop and count.
+ */
+void hal_console_set_blocking(bool blocking);
+
+/**
+ * @brief Waits until every queued character has been sent (before a reset).
+ */
+void hal_console_flush(void);
+
+/**
+ * @brief Returns the characters lost since start-up.
+ *
+ * @param[out] tx_dropped Output dropped in non-blocking mode.
+ * @param[out] rx_lost    Input lost (receive ring full, overrun).
+ */
+void hal_console_get_stats(uint32_t *tx_dropped, uint32_t *rx_lost);
+
+#endif /* HAL_CONSOLE_H */
@@ -0,0 +1,80 @@
+/**
+ * @file hal_flash.h
+ * @brief Hardware Abstraction Layer (HAL) interface for the program flash.
+ *
+ * @details
+ * Erase and program primitives used by the CAN bootloader (drivers/bootloader.c)
+ * to write an application image.
+ *
+ * - **Target (S32K118)**: FTFC commands on the 256 KB P-Flash. The CPU cannot
+ *   fetch code from the P-Flash while a command runs, so the driver waits in a
+ *   RAM routine (`.code_ram`) with interrupts masked, and calls
+ *   ::hal_can_rx_stash meanwhile so no CAN frame is lost during an erase.
+ * - **Host (Linux/PC)**: a flash model backed by a file. It has NOR semantics:
+ *   an erased byte reads 0xFF, programming only clears bits, and a phrase must
+ *   be erased before it is programmed. It also waits the typical FTFC command
+ *   times, so transfer times measured on the virtual bus match the target.
+ *
+ * Every call blocks until its command completes. Callers that must stay
+ * responsive (the bootloader) program a few phrases per call.
+ */
+
+#ifndef HAL_FLASH_H
+#define HAL_FLASH_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define HAL_FLASH_SIZE         0x00040000u  /**< P-Flash size (256 KB). */
+#define HAL_FLASH_SECTOR_SIZE  2048u        /**< Erase unit. */
+#define HAL_FLASH_PHRASE_SIZE  8u           /**< Program unit (address and length alignment). */
+
+#define HAL_FLASH_ERASED       0xFFu        /**< Value of an erased byte. */
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Prepares the flash controller (clears stale error flags).
+ *
+ * @details
+ * Host: maps the model file named by the environment variable `F1_FLASH`
+ * (default `build/flash.bin`), creating an erased one if needed.
+ *
+ * @return int 0 on success, negative on failure.
+ */
+int hal_flash_init(void);
+
+/**
+ * @brief Erases one sector.
+ *
+ * @param[in] addr Sector address (multiple of ::HAL_FLASH_SECTOR_SIZE).
+ * @return int 0 on success, -1 invalid address, -2 command failed.
+ */
+int hal_flash_erase_sector(uint32_t addr);
+
+/**
+ * @brief Programs erased flash.
+ *
+ * @param[in] addr Destination (multiple of ::HAL_FLASH_PHRASE_SIZE).
+ * @param[in] data Source bytes (any alignment).
+ * @param[in] len  Byte count (multiple of ::HAL_FLASH_PHRASE_SIZE).
+ * @return int 0 on success, -1 invalid address or length, -2 command failed
+ *         (protection, phrase not erased, verify error).
+ */
+int hal_flash_program(uint32_t addr, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Returns a read pointer to flash contents.
+ *
+ * @details
+ * Target: the address itself (the P-Flash is memory mapped from 0).
+ * Host: the matching byte of the model.
+ *
+ * @param[in] addr Flash address.
+ * @return const uint8_t* Pointer to the byte at @p addr, NULL if out of range.
+ */
+const uint8_t *hal_flash_ptr(uint32_t addr);
+
+#endif /* HAL_FLASH_H */
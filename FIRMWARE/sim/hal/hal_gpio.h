@@ -8,7 +8,10 @@
  * and emulate GPIO events in simulation environments.
  *
  * Implementation behavior depends on the build target:
- * - **Hardware (e.g., MCU)**: Direct access to GPIO peripheral registers.
+ * - **Hardware (e.g., MCU)**: Direct access to GPIO peripheral registers. The
+ *   pin accessors are defined in hal_gpio_port.h (::HAL_INLINE): a call with a
+ *   constant pin compiles to a single store to PSOR/PCOR, or a load of PDIR,
+ *   with no call and no switch at run time.
  * - **Host simulation**: Emulates GPIOs using SDL events (keyboard input) and
  *   console output for pin state changes.
  *
@@ -41,26 +44,31 @@ typedef enum {
     GPIO_TFT_RST,  /**< Reset pin for TFT display. */
     GPIO_LED_S2,   /**< Secondary status LED. */
     GPIO_LED_S1,   /**< Primary status LED. */
-    GPIO_BTN_1,    /**< Button 1 input. */
-    GPIO_BTN_2,    /**< Button 2 input. */
-    GPIO_BTN_3,    /**< Button 3 input. */
-    GPIO_BTN_4,    /**< Button 4 input. */
+    GPIO_BTN_1,    /**< Button 1 input (UP), 1 = pressed. */
+    GPIO_BTN_2,    /**< Button 2 input (DOWN), 1 = pressed. */
+    GPIO_BTN_3,    /**< Button 3 input (DRS), 1 = pressed. */
+    GPIO_BTN_4,    /**< Button 4 input (PIT LIMITER), 1 = pressed. */
     GPIO_COUNT     /**< Total number of GPIO pins. */
 } GPIO_Pin_t;
 
 /*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
 
 /**
- * @brief Initializes all GPIOs and simulation subsystems.
+ * @brief Initializes all GPIOs.
  *
  * @details
  * Prepares all GPIOs for use by configuring direction, setting default levels,
  * and initializing any platform-specific input or output mechanisms.
- * On host systems, this may initialize SDL to capture keyboard input for GPIO emulation.
+ * On the target: clocks, pin mux, directions and pull-ups. On host systems,
+ * this may initialize SDL to capture keyboard input for GPIO emulation.
  */
 void HAL_GPIO_Init(void);
 
+/* The pin accessors below are declared, or defined inline, by the platform */
+#include "hal_gpio_port.h"
+
 /**
+ * @fn void HAL_GPIO_Write(GPIO_Pin_t pin, uint8_t value)
  * @brief Sets the logical output value of a specific GPIO pin.
  *
  * @details
@@ -71,9 +79,9 @@ void HAL_GPIO_Init(void);
  * @param[in] pin   GPIO identifier (see ::GPIO_Pin_t).
  * @param[in] value Logical state to apply: 0 = LOW, 1 = HIGH.
  */
-void HAL_GPIO_Write(GPIO_Pin_t pin, uint8_t value);
 
 /**
+ * @fn void HAL_GPIO_Toggle(GPIO_Pin_t pin)
  * @brief Toggles the current logical output value of the specified GPIO pin.
  *
  * @details
@@ -82,9 +90,9 @@ void HAL_GPIO_Write(GPIO_Pin_t pin, uint8_t value);
  *
  * @param[in] pin GPIO identifier (see ::GPIO_Pin_t).
  */
-void HAL_GPIO_Toggle(GPIO_Pin_t pin);
 
 /**
+ * @fn uint8_t HAL_GPIO_Read(GPIO_Pin_t pin)
  * @brief Reads the current logical input value of a GPIO pin.
  *
  * @details
@@ -93,22 +101,7 @@ void HAL_GPIO_Toggle(GPIO_Pin_t pin);
  * On host systems, the value is derived from emulated keyboard or input events.
  *
  * @param[in] pin GPIO identifier (see ::GPIO_Pin_t).
- * @return uint8_t Pin state: 0 = LOW, 1 = HIGH.
- */
-uint8_t HAL_GPIO_Read(GPIO_Pin_t pin);
-
-/**
- * @brief Handles simulated key events for GPIO emulation.
- *
- * @details
- * This function integrates with the SDL event loop to translate key press
- * and release events into virtual GPIO state changes.  
- * It updates the internal state map used by ::HAL_GPIO_Read() to reflect
- * the simulated input status.
- *
- * @param[in] keysym  SDL key symbol code (e.g., `SDLK_1` for Button 1).
- * @param[in] is_down Set to 1 if the key is pressed, 0 if released.
+ * @return uint8_t Pin state: 0 = LOW, 1 = HIGH (buttons: 1 = pressed).
  */
-void HAL_GPIO_on_key(int keysym, int is_down);
 
 #endif /* HAL_GPIO_H */
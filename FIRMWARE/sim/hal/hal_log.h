@@ -0,0 +1,126 @@
+/**
+ * @file hal_log.h
+ * @brief Hardware Abstraction Layer (HAL) interface for tokenized (deferred-format) logging.
+ *
+ * @details
+ * `HAL_LOG("fmt", args...)` has printf semantics, but the target never formats
+ * the text. The format string is placed in the `.log_str` section, which the
+ * linker scripts keep in the ELF but do not load into the flash (INFO section
+ * at address 0). Its address in that section is the 16-bit string ID. A call
+ * queues a binary record: a marker, the argument count, the ID and the
+ * arguments as raw 32-bit words. `tools/log_decode.py` rebuilds the text from
+ * the ELF and the UART stream, where the records are mixed with plain
+ * HAL_UART_Printf text.
+ *
+ * | Byte    | Content                                  |
+ * |---------|------------------------------------------|
+ * | 0       | ::HAL_LOG_MARKER (0x00, never sent in text) |
+ * | 1       | Argument count n (0..::HAL_LOG_MAX_ARGS) |
+ * | 2..3    | String ID, little-endian                 |
+ * | 4..     | n arguments, 32-bit little-endian        |
+ *
+ * Argument rules (checked with `_Generic` at compile time where possible):
+ * - Integers up to 32 bits, any conversion (`%u %d %x %c`, with or without `l`).
+ * - `float`/`double`: sent as 32-bit float (`%f %e %g`).
+ * - Strings (`%s`): only string constants, sent as their flash address. The
+ *   decoder reads them from the ELF.
+ *
+ * Binary frames (telemetry, drivers/telemetry.h) share the stream: they start
+ * with the marker and ::HAL_LOG_FRAME_TAG, and run to the next 0x00 (COBS).
+ *
+ * - **Target (S32K118)**: the record goes into the UART TX ring (no vsnprintf):
+ *   a few tens of cycles per call, 4 + 4n bytes instead of the whole text.
+ * - **Host (Linux/PC)**: the format string is at hand, so the text is
+ *   formatted and printed at once.
+ */
+
+#ifndef HAL_LOG_H
+#define HAL_LOG_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define HAL_LOG_MARKER    0x00u  /**< First byte of a record. */
+#define HAL_LOG_MAX_ARGS  8u     /**< Arguments per call. */
+#define HAL_LOG_FRAME_TAG 0xFFu  /**< Second byte of a binary frame (instead of the count). */
+
+typedef uintptr_t hal_log_arg_t;  /**< One argument word (32 bits on the target). */
+
+/** @brief Format strings: kept in the ELF, not loaded (see the linker scripts). */
+#define HAL_LOG_SECTION   __attribute__((section(".log_str"), used))
+
+/**
+ * @brief Logs a printf-style message (format string literal, up to 8 arguments).
+ */
+#define HAL_LOG(...)  HAL_LOG_CAT_(HAL_LOG_, HAL_LOG_NARGS_(__VA_ARGS__))(__VA_ARGS__)
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Emits one record (called by ::HAL_LOG).
+ *
+ * @param[in] fmt  Format string in `.log_str`.
+ * @param[in] n    Argument count.
+ * @param[in] args Argument words.
+ */
+void hal_log_write(const char *fmt, uint32_t n, const hal_log_arg_t *args);
+
+/**
+ * @brief Sends a complete binary frame (marker, ::HAL_LOG_FRAME_TAG, COBS data, 0x00).
+ *
+ * @details
+ * - **Target (S32K118)**: queued whole in the UART TX ring, or dropped whole.
+ * - **Host (Linux/PC)**: written to the sink named by `F1_TELEM`: `pty` (a new
+ *   pseudo-terminal, its name is printed with the first frame) or a file path. Frames
+ *   are discarded without `F1_TELEM`.
+ *
+ * @param[in] frame Frame bytes.
+ * @param[in] len   Frame length.
+ */
+void hal_log_frame(const uint8_t *frame, uint32_t len);
+
+/*--------------------------MACRO INTERNALS-----------------------------------*/
+
+static inline hal_log_arg_t hal_log_u32_(uint32_t v)   { return v; }
+static inline hal_log_arg_t hal_log_str_(const char *s) { return (hal_log_arg_t)s; }
+static inline hal_log_arg_t hal_log_f32_(float f) {
+    union { float f; uint32_t u; } v = { f };
+    return v.u;
+}
+
+#define HAL_LOG_ARG_(x) _Generic((x), \
+    float: hal_log_f32_, double: hal_log_f32_, \
+    char *: hal_log_str_, const char *: hal_log_str_, \
+    default: hal_log_u32_)(x)
+
+#define HAL_LOG_CAT_(a, b)   HAL_LOG_CAT2_(a, b)
+#define HAL_LOG_CAT2_(a, b)  a##b
+#define HAL_LOG_NARGS_(...)  HAL_LOG_COUNT_(__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0, _)
+#define HAL_LOG_COUNT_(f, a1, a2, a3, a4, a5, a6, a7, a8, n, ...) n
+
+#define HAL_LOG_EMIT_(fmt, n, ...) do {                                  \
+        static const char hal_log_fmt_[] HAL_LOG_SECTION = fmt;          \
+        hal_log_write(hal_log_fmt_, (n), (const hal_log_arg_t[]){ __VA_ARGS__ }); \
+    } while (0)
+
+#define HAL_LOG_0(f)                 HAL_LOG_EMIT_(f, 0, 0)
+#define HAL_LOG_1(f, a)              HAL_LOG_EMIT_(f, 1, HAL_LOG_ARG_(a))
+#define HAL_LOG_2(f, a, b)           HAL_LOG_EMIT_(f, 2, HAL_LOG_ARG_(a), HAL_LOG_ARG_(b))
+#define HAL_LOG_3(f, a, b, c)        HAL_LOG_EMIT_(f, 3, HAL_LOG_ARG_(a), HAL_LOG_ARG_(b), HAL_LOG_ARG_(c))
+#define HAL_LOG_4(f, a, b, c, d)     HAL_LOG_EMIT_(f, 4, HAL_LOG_ARG_(a), HAL_LOG_ARG_(b), HAL_LOG_ARG_(c), \
+                                                   HAL_LOG_ARG_(d))
+#define HAL_LOG_5(f, a, b, c, d, e)  HAL_LOG_EMIT_(f, 5, HAL_LOG_ARG_(a), HAL_LOG_ARG_(b), HAL_LOG_ARG_(c), \
+                                                   HAL_LOG_ARG_(d), HAL_LOG_ARG_(e))
+#define HAL_LOG_6(f, a, b, c, d, e, g) \
+    HAL_LOG_EMIT_(f, 6, HAL_LOG_ARG_(a), HAL_LOG_ARG_(b), HAL_LOG_ARG_(c), HAL_LOG_ARG_(d), \
+                  HAL_LOG_ARG_(e), HAL_LOG_ARG_(g))
+#define HAL_LOG_7(f, a, b, c, d, e, g, h) \
+    HAL_LOG_EMIT_(f, 7, HAL_LOG_ARG_(a), HAL_LOG_ARG_(b), HAL_LOG_ARG_(c), HAL_LOG_ARG_(d), \
+                  HAL_LOG_ARG_(e), HAL_LOG_ARG_(g), HAL_LOG_ARG_(h))
+#define HAL_LOG_8(f, a, b, c, d, e, g, h, i) \
+    HAL_LOG_EMIT_(f, 8, HAL_LOG_ARG_(a), HAL_LOG_ARG_(b), HAL_LOG_ARG_(c), HAL_LOG_ARG_(d), \
+                  HAL_LOG_ARG_(e), HAL_LOG_ARG_(g), HAL_LOG_ARG_(h), HAL_LOG_ARG_(i))
+
+#endif /* HAL_LOG_H */
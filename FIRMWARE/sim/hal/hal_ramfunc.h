@@ -0,0 +1,52 @@
+/**
+ * @file hal_ramfunc.h
+ * @brief Placement of hot functions in SRAM (`.code_ram`).
+ *
+ * @details
+ * At 48 MHz the P-Flash runs from the 24 MHz flash clock with wait states,
+ * so tight loops on the Cortex-M0+ stall on instruction fetches.
+ * A function marked ::HAL_RAMFUNC is linked into `.code_ram`: the startup
+ * code copies it from flash to SRAM with the initialized data, and it runs
+ * without flash wait states.
+ *
+ * Use it for the inner loops only (SPI byte stream, pixel flood, glyph blit,
+ * code that must run while the flash is busy). The functions cost SRAM: the
+ * linker scripts limit the section to ::HAL_RAMFUNC_BUDGET bytes and
+ * `tools/ramfunc_report.py` lists what is in it. Calls between flash and RAM
+ * go through linker veneers (the distance exceeds the BL range); keep the
+ * callees of a RAM function in RAM too when they are called per byte.
+ *
+ * The gain only shows on the hardware: Renode (`renode_sim/`) runs flash and
+ * SRAM at the same speed, it does not model the flash wait states.
+ *
+ * - **Target (S32K118)**: `section(".code_ram")`, never inlined into flash code.
+ * - **Host (Linux/PC)**: empty.
+ *
+ * ::HAL_INLINE marks the register accessors that a platform header defines
+ * in place of a prototype (e.g. HAL_GPIO_Write on the target). They are
+ * inlined even in -O0 builds, so they run from the section of the caller
+ * (a RAM function stays in RAM) and cost no call.
+ */
+
+#ifndef HAL_RAMFUNC_H
+#define HAL_RAMFUNC_H
+
+/*--------------------------DEFINITIONS-----------------------------------*/
+
+#define HAL_RAMFUNC_BUDGET  2048u   /**< SRAM reserved for `.code_ram` (bytes, see the linker scripts). */
+
+#if defined(__arm__)
+/** @brief Links the function into SRAM (`.code_ram`). */
+#define HAL_RAMFUNC  __attribute__((section(".code_ram"), noinline))
+#else
+#define HAL_RAMFUNC
+#endif
+
+#if defined(__GNUC__)
+/** @brief Register accessor defined in a HAL header, always inlined. */
+#define HAL_INLINE   static inline __attribute__((always_inline))
+#else
+#define HAL_INLINE   static inline
+#endif
+
+#endif /* HAL_RAMFUNC_H */
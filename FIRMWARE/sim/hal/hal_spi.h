@@ -64,15 +64,32 @@ void HAL_SPI_WriteCommand(uint8_t cmd);
  */
 void HAL_SPI_WriteData(const uint8_t* data, size_t length);
 
+/* The byte accessors below are declared, or defined inline, by the platform */
+#include "hal_spi_port.h"
+
 /**
+ * @fn void HAL_SPI_TransmitByte(uint8_t byte)
  * @brief Transmits a single byte via SPI.
  *
  * @details
- * Simplified variant of ::HAL_SPI_WriteData used for quick tests or sending
- * isolated bytes (e.g., dummy transfers for synchronization or SPI clocking).
+ * Queues one byte (no read back). On the target it waits for room in the TX
+ * FIFO and is defined inline (::HAL_INLINE), so the display byte loops, which
+ * run from RAM, inline it. On the host the byte goes to the display simulation.
  *
  * @param[in] byte Single byte to transmit.
  */
-void HAL_SPI_TransmitByte(uint8_t byte);
+
+/**
+ * @fn void HAL_SPI_WaitTxDone(void)
+ * @brief Waits until the queued bytes have left the SPI pins.
+ *
+ * @details
+ * Called before a software chip select rises. On the target
+ * ::HAL_SPI_TransmitByte returns as soon as the byte is in the TX FIFO: this
+ * waits for the FIFO to be empty (FSR.TXCOUNT) and the last frame to be
+ * shifted out (SR.MBF), with register polls only, so the RAM-resident byte
+ * loops do not call into flash. On the host the transfer is complete when
+ * ::HAL_SPI_TransmitByte returns: nothing to wait for.
+ */
 
 #endif /* HAL_SPI_H */
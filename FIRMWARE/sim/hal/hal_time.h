@@ -0,0 +1,40 @@
+/**
+ * @file hal_time.h
+ * @brief Hardware Abstraction Layer (HAL) interface for the microsecond clock available from reset.
+ *
+ * @details
+ * The timebase of the boot sequencer (drivers/boot_seq.h) and of the bounded
+ * hardware waits, which run before the CAN controller (::hal_can_get_time_us)
+ * is up. The main loop keeps using the CAN timebase.
+ *
+ * - **Target (S32K118)**: LPIT channel 0 expires every µs (FIRCDIV2, 48 MHz)
+ *   and the chained channel 1 counts the expiries: a 32-bit hardware counter,
+ *   without interrupt, exact however rarely it is read. The CAN timebase
+ *   uses it to recover the FlexCAN TIMER wraps missed during a long draw.
+ * - **Host (Linux/PC)**: CLOCK_MONOTONIC.
+ */
+
+#ifndef HAL_TIME_H
+#define HAL_TIME_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Starts the clock at 0.
+ *
+ * @details
+ * Called first thing in main(): boot timestamps count from here.
+ */
+void hal_time_init(void);
+
+/**
+ * @brief Microseconds since ::hal_time_init (wraps after ~71 min).
+ *
+ * @return uint32_t Current time in µs.
+ */
+uint32_t hal_time_us(void);
+
+#endif /* HAL_TIME_H */
@@ -0,0 +1,14 @@
+/**
+ * @file hal_adc_port.h
+ * @brief Host (Linux/PC) ADC channels, included by hal_adc.h.
+ */
+
+#ifndef HAL_ADC_PORT_H
+#define HAL_ADC_PORT_H
+
+/* Simulation channels (columns of test/adc_data.csv). */
+
+#define HAL_ADC_CH_CLUTCH   0u     /**< Clutch paddle potentiometer. */
+#define HAL_ADC_CH_ROTARY   1u     /**< Rotary switch resistor ladder. */
+
+#endif /* HAL_ADC_PORT_H */
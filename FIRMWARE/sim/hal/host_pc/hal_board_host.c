@@ -0,0 +1,68 @@
+// hal_board.c
+// Host PC (simulation) version of the Hardware Abstraction Layer (HAL) for the board bring-up.
+// No oscillator to start; the display is the SDL window, which is presented and polled every
+// slot. Closing the window ends the main loop.
+
+// --- INCLUDES ---
+#include "hal_board.h" // HAL function prototypes
+#include "hal_lcd.h"   // HAL_Display_Init, HAL_Display_Present, HAL_Poll_Events
+#include "hal_delay.h" // HAL_DelayMs
+
+// --- PUBLIC FUNCTIONS ---
+
+/**
+ * @brief Nothing to start: the host clock is always running.
+ */
+void hal_board_clock_start(void) {
+}
+
+/**
+ * @brief The host clock is always stable.
+ * @return Always true.
+ */
+bool hal_board_clock_ready(void) {
+    return true;
+}
+
+/**
+ * @brief Opens the SDL window of the display simulation.
+ */
+void hal_board_display_start(void) {
+    HAL_Display_Init();
+}
+
+/**
+ * @brief The window is ready as soon as it is open.
+ * @return Always true.
+ */
+bool hal_board_display_ready(void) {
+    return true;
+}
+
+/**
+ * @brief No peripheral registers to show on the host.
+ */
+void hal_board_dump(void) {
+}
+
+/**
+ * @brief Processes the SDL window events; closing the window clears @p running.
+ * @param running Main loop control variable.
+ */
+void hal_board_poll(int* running) {
+    HAL_Poll_Events(running);
+}
+
+/**
+ * @brief Copies the framebuffer to the SDL window.
+ */
+void hal_board_present(void) {
+    HAL_Display_Present();
+}
+
+/**
+ * @brief Sleeps 1 ms, so the wait for the end of the slot does not spin a host core.
+ */
+void hal_board_idle(void) {
+    HAL_DelayMs(1);
+}
@@ -0,0 +1,13 @@
+/**
+ * @file hal_board_port.h
+ * @brief Host (Linux/PC) board settings, included by hal_board.h.
+ */
+
+#ifndef HAL_BOARD_PORT_H
+#define HAL_BOARD_PORT_H
+
+#define HAL_BOARD_LCD_FITTED    1       /**< SDL window of the ILI9341 simulation. */
+#define HAL_BOARD_TP_BUF_SIZE   4096u   /**< A layout download fits in one message. */
+#define HAL_BOARD_UI_PERIOD_MS  500u    /**< Text debug page on stdout every 500 ms. */
+
+#endif /* HAL_BOARD_PORT_H */
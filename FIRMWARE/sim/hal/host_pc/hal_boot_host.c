@@ -0,0 +1,39 @@
+// hal_boot.c
+// Host PC (simulation) version of the Hardware Abstraction Layer (HAL) for the bootloader handover.
+// The simulator cannot run a flashed image, so both directions end the process with an
+// exit code a script can act on (see hal_boot.h).
+
+// --- INCLUDES ---
+#include "hal_boot.h" // HAL function prototypes
+#include <stdio.h>    // printf, fflush
+#include <stdlib.h>   // exit
+
+// --- PUBLIC FUNCTIONS ---
+
+/**
+ * @brief Ends the application with ::HAL_BOOT_EXIT_REQUEST.
+ */
+void hal_boot_request(void) {
+    printf("[BOOT] Bootloader requested: exiting (%d)\n", HAL_BOOT_EXIT_REQUEST);
+    fflush(stdout);
+    exit(HAL_BOOT_EXIT_REQUEST);
+}
+
+/**
+ * @brief The host bootloader binary is only started to flash (by hand or after
+ * ::HAL_BOOT_EXIT_REQUEST), so it always behaves as if requested.
+ * @return Always true.
+ */
+bool hal_boot_requested(void) {
+    return true;
+}
+
+/**
+ * @brief Ends the bootloader (exit code 0) in place of starting the image.
+ * @param base Vector table address of the application.
+ */
+void hal_boot_jump(uint32_t base) {
+    printf("[BOOT] Starting application at 0x%08X\n", (unsigned)base);
+    fflush(stdout);
+    exit(0);
+}
@@ -1,18 +1,34 @@
 // hal_can.c
 // Host PC (simulation) version of the Hardware Abstraction Layer (HAL) for CAN.
 // Uses SocketCAN on Linux to send/receive CAN frames in a platform-independent way.
+//
+// Receive path: kernel-side CAN_RAW_FILTER entries drop unwanted IDs before they
+// are copied to user space, and recvmmsg() drains up to HOST_RX_BATCH frames per
+// syscall into a local queue. Each frame carries its SO_TIMESTAMP receive time,
+// converted to CLOCK_MONOTONIC microseconds.
+// Transmit path: hal_can_send_frames() hands a whole batch to sendmmsg().
+// Health: error frames (CAN_RAW_ERR_FILTER) update the error counters and the
+// fault confinement state without reaching the driver, and SO_RXQ_OVFL reports
+// the frames dropped by the kernel because the socket queue was full.
+//
+// Interfaces named "vbus:<name>" are served by the user-space virtual bus
+// (hal_can_vbus.c) instead of SocketCAN. The environment variable F1_CAN_IF
+// overrides the interface requested by the driver.
 
 // --- DEFINES ---
 #define _GNU_SOURCE // Needed to expose certain Linux/POSIX features (struct ifreq, etc.)
 
 // --- INCLUDES ---
 #include "hal_can.h"     // HAL function prototypes
+#include "hal_can_vbus.h" // User-space virtual bus backend
 #include <stdio.h>       // perror, printf, fprintf
 #include <stdlib.h>      // atexit, general utilities
 #include <string.h>      // memcpy, strncpy
 #include <unistd.h>      // read, write, close
 #include <errno.h>       // errno codes
 #include <fcntl.h>       // fcntl flags
+#include <time.h>        // clock_gettime
+#include <sys/time.h>    // struct timeval (SO_TIMESTAMP)
 
 // Linux CAN/SocketCAN headers
 #include <sys/types.h>
@@ -21,10 +37,215 @@
 #include <net/if.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/can/error.h>
+
+// --- DEFINES ---
+#define HOST_RX_BATCH   32  // Frames drained per recvmmsg() call
+#define HOST_TX_BATCH   32  // Frames submitted per sendmmsg() call
+#define HOST_TX_FREE    8   // Capacity reported by hal_can_tx_free() on SocketCAN (same as the FlexCAN TX mailboxes)
+#define HOST_BITRATE    500000u  // Nominal bit-rate reported for SocketCAN interfaces (same as FlexCAN)
+
+// Error classes delivered as error frames (see rx_handle_error_frame())
+#define HOST_ERR_MASK   (CAN_ERR_CRTL | CAN_ERR_BUSOFF | CAN_ERR_ACK | CAN_ERR_LOSTARB | \
+                         CAN_ERR_PROT | CAN_ERR_RESTARTED | CAN_ERR_CNT)
 
 // --- STATIC VARIABLES ---
 // The CAN socket descriptor. Static to limit visibility to this file.
 static int can_socket = -1;
+// Set when the active interface is the user-space virtual bus
+static int use_vbus = 0;
+
+// Receive queue filled by recvmmsg() and emptied by hal_can_receive_frame()
+static hal_can_frame_t rx_queue[HOST_RX_BATCH];
+static int rx_head  = 0;    // Next frame to hand out
+static int rx_count = 0;    // Frames currently stored in rx_queue
+
+// Health and traffic counters returned by hal_can_get_stats()
+static hal_can_stats_t can_stats;
+// Last cumulative SO_RXQ_OVFL value reported by the kernel
+static uint32_t rxq_ovfl_last = 0;
+
+// --- PRIVATE FUNCTIONS ---
+
+/**
+ * @brief Returns the offset to add to a CLOCK_REALTIME value (µs) to obtain CLOCK_MONOTONIC (µs).
+ *
+ * @details
+ * SO_TIMESTAMP reports wall-clock time; the rest of the firmware works with a
+ * monotonic timebase, so the offset is sampled once per receive batch.
+ */
+static int64_t realtime_to_monotonic_offset_us(void) {
+    struct timespec rt, mt;
+    clock_gettime(CLOCK_REALTIME, &rt);
+    clock_gettime(CLOCK_MONOTONIC, &mt);
+    int64_t rt_us = (int64_t)rt.tv_sec * 1000000 + rt.tv_nsec / 1000;
+    int64_t mt_us = (int64_t)mt.tv_sec * 1000000 + mt.tv_nsec / 1000;
+    return mt_us - rt_us;
+}
+
+/**
+ * @brief Returns the CLOCK_MONOTONIC time in microseconds.
+ */
+static uint64_t monotonic_us(void) {
+    struct timespec mt;
+    clock_gettime(CLOCK_MONOTONIC, &mt);
+    return (uint64_t)mt.tv_sec * 1000000u + (uint64_t)mt.tv_nsec / 1000u;
+}
+
+/**
+ * @brief Updates the health counters from a SocketCAN error frame.
+ *
+ * @details
+ * Error frames are generated by the CAN driver, not received from the bus:
+ * they are consumed here and never queued for the firmware driver.
+ */
+static void rx_handle_error_frame(const struct can_frame* ef) {
+    canid_t cls = ef->can_id & CAN_ERR_MASK;
+
+    if (cls & CAN_ERR_BUSOFF) {
+        if (can_stats.err_state != HAL_CAN_BUS_OFF) can_stats.bus_off_events++;
+        can_stats.err_state = HAL_CAN_BUS_OFF;
+    } else if (cls & CAN_ERR_RESTARTED) {
+        can_stats.err_state = HAL_CAN_ERR_ACTIVE;
+    } else if (cls & CAN_ERR_CRTL) {
+        if (ef->data[1] & (CAN_ERR_CRTL_TX_PASSIVE | CAN_ERR_CRTL_RX_PASSIVE)) {
+            can_stats.err_state = HAL_CAN_ERR_PASSIVE;
+        } else if (ef->data[1] & CAN_ERR_CRTL_ACTIVE) {
+            can_stats.err_state = HAL_CAN_ERR_ACTIVE;
+        }
+        if (ef->data[1] & (CAN_ERR_CRTL_RX_OVERFLOW | CAN_ERR_CRTL_TX_OVERFLOW)) {
+            can_stats.rx_overruns++;    // Controller FIFO overflow
+        }
+    }
+
+    if (cls & (CAN_ERR_ACK | CAN_ERR_LOSTARB)) can_stats.tx_retries++;
+    if (cls & CAN_ERR_PROT) {
+        if (ef->data[2] & CAN_ERR_PROT_TX) can_stats.tx_retries++;
+        else                               can_stats.rx_errors++;
+    }
+    if (cls & (CAN_ERR_CNT | CAN_ERR_CRTL)) {
+        can_stats.tx_err_count = ef->data[6];
+        can_stats.rx_err_count = ef->data[7];
+    }
+}
+
+/**
+ * @brief Drains up to HOST_RX_BATCH frames from the socket with one recvmmsg() call.
+ * @return Number of frames stored in rx_queue, 0 if none pending, negative on error.
+ */
+static int rx_fill_queue(void) {
+    struct can_frame frames[HOST_RX_BATCH];
+    struct iovec iov[HOST_RX_BATCH];
+    struct mmsghdr msgs[HOST_RX_BATCH];
+    // Control buffer large enough for one struct timeval and one drop counter per message
+    char ctrl[HOST_RX_BATCH][CMSG_SPACE(sizeof(struct timeval)) + CMSG_SPACE(sizeof(uint32_t))];
+
+    memset(msgs, 0, sizeof(msgs));
+    for (int i = 0; i < HOST_RX_BATCH; i++) {
+        iov[i].iov_base = &frames[i];
+        iov[i].iov_len  = sizeof(struct can_frame);
+        msgs[i].msg_hdr.msg_iov        = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen     = 1;
+        msgs[i].msg_hdr.msg_control    = ctrl[i];
+        msgs[i].msg_hdr.msg_controllen = sizeof(ctrl[i]);
+    }
+
+    int n = recvmmsg(can_socket, msgs, HOST_RX_BATCH, MSG_DONTWAIT, NULL);
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) return 0; // No data available
+        perror("Error recvmmsg CAN socket");
+        return -2;
+    }
+
+    int64_t offset_us = realtime_to_monotonic_offset_us();
+    int stored = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (msgs[i].msg_len < sizeof(struct can_frame)) {
+            fprintf(stderr, "Error read: incomplete CAN frame received\n");
+            continue;
+        }
+
+        if (frames[i].can_id & CAN_ERR_FLAG) {
+            rx_handle_error_frame(&frames[i]);
+            continue;
+        }
+
+        hal_can_frame_t* f = &rx_queue[stored];
+        f->id  = frames[i].can_id & CAN_EFF_MASK;
+        f->len = frames[i].can_dlc;
+        if (f->len > CAN_MAX_DLEN) f->len = CAN_MAX_DLEN;
+        memcpy(f->data, frames[i].data, f->len);
+        f->timestamp_us = 0;
+
+        // Extract the kernel receive timestamp (if provided)
+        for (struct cmsghdr* c = CMSG_FIRSTHDR(&msgs[i].msg_hdr); c != NULL;
+             c = CMSG_NXTHDR(&msgs[i].msg_hdr, c)) {
+            if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SO_TIMESTAMP) {
+                struct timeval tv;
+                memcpy(&tv, CMSG_DATA(c), sizeof(tv));
+                int64_t rt_us = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+                f->timestamp_us = (uint32_t)(rt_us + offset_us);
+            } else if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SO_RXQ_OVFL) {
+                uint32_t dropped;   // Cumulative count of frames dropped by the kernel
+                memcpy(&dropped, CMSG_DATA(c), sizeof(dropped));
+                can_stats.rx_overruns += dropped - rxq_ovfl_last;
+                rxq_ovfl_last = dropped;
+            }
+        }
+        stored++;
+    }
+
+    rx_head  = 0;
+    rx_count = stored;
+    return stored;
+}
+
+/**
+ * @brief Sends a batch of frames on the SocketCAN socket with sendmmsg().
+ * @return Number of frames sent, negative on failure.
+ *
+ * @details
+ * Batches larger than HOST_TX_BATCH are submitted in chunks. A full socket
+ * buffer (EAGAIN/ENOBUFS) stops the transfer and returns the frames sent so far.
+ */
+static int socket_send_frames(const hal_can_frame_t* frames, uint8_t count) {
+    if (can_socket < 0) return -1; // Socket not initialized
+
+    struct can_frame out[HOST_TX_BATCH];
+    struct iovec iov[HOST_TX_BATCH];
+    struct mmsghdr msgs[HOST_TX_BATCH];
+    int total = 0;
+
+    while (total < count) {
+        int chunk = count - total;
+        if (chunk > HOST_TX_BATCH) chunk = HOST_TX_BATCH;
+
+        memset(msgs, 0, sizeof(struct mmsghdr) * chunk);
+        for (int i = 0; i < chunk; i++) {
+            const hal_can_frame_t* f = &frames[total + i];
+            memset(&out[i], 0, sizeof(struct can_frame));
+            out[i].can_id  = f->id;
+            out[i].can_dlc = (f->len > CAN_MAX_DLEN) ? CAN_MAX_DLEN : f->len;
+            memcpy(out[i].data, f->data, out[i].can_dlc);
+
+            iov[i].iov_base = &out[i];
+            iov[i].iov_len  = sizeof(struct can_frame);
+            msgs[i].msg_hdr.msg_iov    = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int n = sendmmsg(can_socket, msgs, chunk, MSG_DONTWAIT);
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) return total;
+            return (total > 0) ? total : -2; // Failed to send
+        }
+        total += n;
+        if (n < chunk) break; // Socket buffer full, report partial batch
+    }
+
+    return total;
+}
 
 // --- PUBLIC FUNCTIONS ---
 
@@ -41,6 +262,17 @@ int hal_can_init(const char* interface_name) {
     struct sockaddr_can addr;
     struct ifreq ifr;
 
+    // Environment override (e.g. F1_CAN_IF=vbus:default when vcan is not available)
+    const char* env_if = getenv("F1_CAN_IF");
+    if (env_if != NULL && env_if[0] != '\0') interface_name = env_if;
+
+    if (strncmp(interface_name, VBUS_PREFIX, strlen(VBUS_PREFIX)) == 0) {
+        use_vbus = 1;
+        memset(&can_stats, 0, sizeof(can_stats));
+        return vbus_init(interface_name + strlen(VBUS_PREFIX));
+    }
+    use_vbus = 0;
+
     // Create raw CAN socket
     can_socket = socket(PF_CAN, SOCK_RAW, CAN_RAW);
     if (can_socket < 0) {
@@ -87,6 +319,27 @@ int hal_can_init(const char* interface_name) {
         return -5;
     }
 
+    // Ask the kernel for a receive timestamp on every frame
+    int on = 1;
+    if (setsockopt(can_socket, SOL_SOCKET, SO_TIMESTAMP, &on, sizeof(on)) < 0) {
+        perror("Warning setsockopt SO_TIMESTAMP"); // Not fatal: frames get timestamp 0
+    }
+    // Report socket queue drops and controller errors (both optional)
+    if (setsockopt(can_socket, SOL_SOCKET, SO_RXQ_OVFL, &on, sizeof(on)) < 0) {
+        perror("Warning setsockopt SO_RXQ_OVFL");
+    }
+    can_err_mask_t err_mask = HOST_ERR_MASK;
+    if (setsockopt(can_socket, SOL_CAN_RAW, CAN_RAW_ERR_FILTER, &err_mask, sizeof(err_mask)) < 0) {
+        perror("Warning setsockopt CAN_RAW_ERR_FILTER");
+    }
+
+    memset(&can_stats, 0, sizeof(can_stats));
+    can_stats.bitrate = HOST_BITRATE;
+    rxq_ovfl_last = 0;
+
+    rx_head  = 0;
+    rx_count = 0;
+
     printf("CAN Interface '%s' initialized.\n", interface_name);
     return 0;
 }
@@ -99,27 +352,98 @@ int hal_can_init(const char* interface_name) {
  * @return 0 on success, negative on failure.
  *
  * @details
- * Uses write() on the raw socket to transmit the frame. Handles partial writes
- * and ensures data length does not exceed CAN_MAX_DLEN.
+ * Convenience wrapper around hal_can_send_frames() for a batch of one.
  */
 int hal_can_send(uint32_t id, const uint8_t* data, uint8_t len) {
-    if (can_socket < 0) return -1; // Socket not initialized
+    hal_can_frame_t frame;
 
     if (len > CAN_MAX_DLEN) len = CAN_MAX_DLEN;
-
-    struct can_frame frame;
-    frame.can_id = id;
-    frame.can_dlc = len;
+    frame.id = id;
+    frame.len = len;
     memcpy(frame.data, data, len);
+    frame.timestamp_us = 0;
+
+    int sent = hal_can_send_frames(&frame, 1);
+    if (sent < 0) return sent;
+    return (sent == 1) ? 0 : -2; // Socket buffer full
+}
 
-    int bytes_sent = write(can_socket, &frame, sizeof(struct can_frame));
+/**
+ * @brief Sends a batch of CAN frames (SocketCAN sendmmsg() or virtual bus).
+ * @param frames Array of frames to send.
+ * @param count Number of frames.
+ * @return Number of frames sent, negative on failure.
+ *
+ * @details
+ * Frames that did not fit (full socket buffer / virtual bus queue) are
+ * counted as dropped in the statistics.
+ */
+int hal_can_send_frames(const hal_can_frame_t* frames, uint8_t count) {
+    int sent;
 
-    if (bytes_sent < 0) return -2; // Failed to send
-    if (bytes_sent < (int)sizeof(struct can_frame)) {
-        fprintf(stderr, "Error write: partial CAN frame sent\n");
+    if (use_vbus) {
+        sent = vbus_send_frames(frames, count);
+    } else {
+        sent = socket_send_frames(frames, count);
+    }
+
+    if (sent > 0) {
+        for (int i = 0; i < sent; i++) can_stats.tx_bits += hal_can_frame_bits(frames[i].len);
+        can_stats.tx_frames += (uint32_t)sent;
+    }
+    if (sent >= 0 && sent < count) can_stats.tx_dropped += (uint32_t)(count - sent);
+    return sent;
+}
+
+/**
+ * @brief Reports the free transmit capacity.
+ * @return Free vbus queue entries; ::HOST_TX_FREE on SocketCAN.
+ *
+ * @details
+ * Both queues are FIFO, so every queued frame keeps its order. The SocketCAN
+ * queue depth cannot be read back; a batch that does not fit is partly
+ * refused by hal_can_send_frames() and simply retried by the caller.
+ */
+int hal_can_tx_free(void) {
+    if (use_vbus) return vbus_tx_free();
+    return HOST_TX_FREE;
+}
+
+/**
+ * @brief Installs kernel-side acceptance filters (CAN_RAW_FILTER).
+ * @param filters Filter table (same table the target programs into FlexCAN).
+ * @param count Number of entries, 0 to accept every frame.
+ * @return 0 on success, negative on failure.
+ *
+ * @details
+ * Entries only match standard data frames: the EFF and RTR flags are part of
+ * the compared mask, so extended and remote frames are dropped in the kernel.
+ */
+int hal_can_set_filters(const hal_can_filter_t* filters, uint8_t count) {
+    if (use_vbus) return vbus_set_filters(filters, count);
+    if (can_socket < 0) return -1; // Socket not initialized
+    if (count > HAL_CAN_MAX_FILTERS || (count > 0 && filters == NULL)) return -2;
+
+    struct can_filter kfilters[HAL_CAN_MAX_FILTERS];
+    struct can_filter accept_all = { .can_id = 0, .can_mask = 0 };
+
+    for (uint8_t i = 0; i < count; i++) {
+        kfilters[i].can_id   = filters[i].id & CAN_SFF_MASK;
+        kfilters[i].can_mask = (filters[i].mask & CAN_SFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+    }
+
+    const void* opt  = (count > 0) ? (const void*)kfilters : (const void*)&accept_all;
+    socklen_t optlen = (count > 0) ? (socklen_t)(count * sizeof(struct can_filter))
+                                   : (socklen_t)sizeof(accept_all);
+
+    if (setsockopt(can_socket, SOL_CAN_RAW, CAN_RAW_FILTER, opt, optlen) < 0) {
+        perror("Error setsockopt CAN_RAW_FILTER");
         return -3;
     }
 
+    // Drop frames queued under the previous filter set
+    rx_head  = 0;
+    rx_count = 0;
     return 0;
 }
 
@@ -131,30 +455,92 @@ int hal_can_send(uint32_t id, const uint8_t* data, uint8_t len) {
  * @return 1 if frame received, 0 if none available, negative on error.
  *
  * @details
- * Uses read() on the non-blocking socket. Handles EAGAIN/EWOULDBLOCK as normal.
+ * Legacy wrapper around hal_can_receive_frame(); the timestamp is discarded.
  */
 int hal_can_receive(uint32_t* id, uint8_t* data, uint8_t* len) {
-    if (can_socket < 0) return -1; // Socket not initialized
+    hal_can_frame_t frame;
+    int ret = hal_can_receive_frame(&frame);
+    if (ret <= 0) return ret;
 
-    struct can_frame frame;
-    int bytes_read = read(can_socket, &frame, sizeof(struct can_frame));
+    *id = frame.id;
+    *len = frame.len;
+    memcpy(data, frame.data, frame.len);
+    return 1;
+}
 
-    if (bytes_read < 0) {
-        if (errno == EAGAIN || errno == EWOULDBLOCK) return 0; // No data available
-        perror("Error read CAN socket");
-        return -2;
+/**
+ * @brief Receives a single CAN frame with its timestamp (non-blocking).
+ * @param frame Destination frame.
+ * @return 1 if frame received, 0 if none available, negative on error.
+ *
+ * @details
+ * Frames are served from the local queue; when it is empty a single
+ * recvmmsg() call refills it with everything the kernel has pending
+ * (up to HOST_RX_BATCH frames).
+ */
+int hal_can_receive_frame(hal_can_frame_t* frame) {
+    if (use_vbus) {
+        int ret = vbus_receive_frame(frame);
+        if (ret <= 0) return ret;
+    } else {
+        if (can_socket < 0) return -1; // Socket not initialized
+
+        if (rx_head >= rx_count) {
+            int ret = rx_fill_queue();
+            if (ret <= 0) return ret;
+        }
+        *frame = rx_queue[rx_head++];
     }
-    if (bytes_read < (int)sizeof(struct can_frame)) {
-        fprintf(stderr, "Error read: incomplete CAN frame received\n");
-        return -3;
+
+    can_stats.rx_frames++;
+    can_stats.rx_bits += hal_can_frame_bits(frame->len);
+    return 1;
+}
+
+/**
+ * @brief Nothing to do on the host: the kernel socket and the virtual bus
+ * ring keep the frames while the flash model is busy.
+ */
+void hal_can_rx_stash(void) {
+}
+
+/**
+ * @brief Returns the health and traffic counters.
+ * @param stats Destination structure.
+ * @return 0 on success, negative if the interface is not open.
+ *
+ * @details
+ * The bus timebase is CLOCK_MONOTONIC expressed in bit times. SocketCAN
+ * counters are updated while the receive path drains the socket (error frames,
+ * SO_RXQ_OVFL); on the virtual bus the overruns come from the node counters
+ * and the error state is always active (the virtual wire never corrupts frames).
+ */
+int hal_can_get_stats(hal_can_stats_t* stats) {
+    if (stats == NULL) return -2;
+
+    if (use_vbus) {
+        vbus_stats_t vs;
+        if (vbus_get_stats(&vs) < 0) return -1;
+        can_stats.bitrate     = vs.bitrate;
+        can_stats.rx_overruns = vs.rx_overruns;
+    } else if (can_socket < 0) {
+        return -1; // Socket not initialized
     }
 
-    *id = frame.can_id;
-    *len = frame.can_dlc;
-    if (*len > CAN_MAX_DLEN) *len = CAN_MAX_DLEN;
-    memcpy(data, frame.data, *len);
+    can_stats.bit_time = (uint32_t)(monotonic_us() * can_stats.bitrate / 1000000u);
+    *stats = can_stats;
+    return 0;
+}
 
-    return 1;
+/**
+ * @brief Returns the receive timebase: CLOCK_MONOTONIC in microseconds.
+ *
+ * @details
+ * SocketCAN timestamps are converted to CLOCK_MONOTONIC in rx_fill_queue() and
+ * the virtual bus stamps frames with CLOCK_MONOTONIC, so both backends share it.
+ */
+uint32_t hal_can_get_time_us(void) {
+    return (uint32_t)monotonic_us();
 }
 
 /**
@@ -164,9 +550,17 @@ int hal_can_receive(uint32_t* id, uint8_t* data, uint8_t* len) {
  * Safely closes the socket if it was previously opened and resets the global descriptor.
  */
 void hal_can_shutdown(void) {
+    if (use_vbus) {
+        vbus_shutdown();
+        use_vbus = 0;
+        printf("CAN Interface closed.\n");
+        return;
+    }
     if (can_socket >= 0) {
         close(can_socket);
         can_socket = -1;
+        rx_head  = 0;
+        rx_count = 0;
         printf("CAN Interface closed.\n");
     }
 }
@@ -0,0 +1,11 @@
+/**
+ * @file hal_can_port.h
+ * @brief Host (Linux/PC) settings of the CAN HAL, included by hal_can.h.
+ */
+
+#ifndef HAL_CAN_PORT_H
+#define HAL_CAN_PORT_H
+
+#define HAL_CAN_DEFAULT_IF   "vcan0" /**< Channel opened by default: SocketCAN interface; F1_CAN_IF overrides it at run time. */
+
+#endif /* HAL_CAN_PORT_H */
@@ -0,0 +1,407 @@
+// hal_can_vbus.c
+// Host PC (simulation) user-space virtual CAN bus.
+// Several processes share one memory-mapped file; frames are arbitrated by ID
+// and timed with a bit-rate model. See hal_can_vbus.h for the overall design.
+
+// --- DEFINES ---
+#define _GNU_SOURCE // Needed for flock(), kill() and clock_gettime() with -std=c11
+
+// --- INCLUDES ---
+#include "hal_can_vbus.h"
+#include <stdio.h>       // perror, fprintf
+#include <stdlib.h>      // getenv, strtoul
+#include <string.h>      // memset, memcpy, strncpy
+#include <errno.h>       // errno codes, program_invocation_short_name
+#include <fcntl.h>       // open
+#include <unistd.h>      // close, ftruncate, getpid
+#include <signal.h>      // kill (dead node detection)
+#include <time.h>        // clock_gettime
+#include <sys/file.h>    // flock
+#include <sys/mman.h>    // mmap
+#include <sys/stat.h>    // fstat
+
+// --- SHARED LAYOUT ---
+// The layout is part of the "protocol" between processes (C and tools/vbus.py):
+// fixed-width fields, explicit padding, little-endian host.
+#define VBUS_MAGIC       0x53554256u  // "VBUS"
+#define VBUS_VERSION     1u
+#define VBUS_MAX_NODES   8            // Nodes attached to one bus
+#define VBUS_TX_QUEUE    32           // Pending frames per node
+#define VBUS_RING_SIZE   1024         // Delivered frames kept for the readers
+#define VBUS_NAME_LEN    16
+#define VBUS_RX_BATCH    32           // Frames copied out of the ring per lock
+#define VBUS_DRAIN_US    5000u        // Longest wait for the TX queue in vbus_shutdown
+
+typedef struct {
+    uint64_t seq;       // Ring: delivery sequence number. TX queue: unused
+    uint64_t t_us;      // Ring: end of frame on the wire. TX queue: submit time
+    uint32_t id;
+    uint8_t  len;
+    uint8_t  node;      // Source node index
+    uint8_t  pad[2];
+    uint8_t  data[8];
+} vbus_slot_t;          // 32 bytes
+
+typedef struct {
+    uint32_t pid;               // Owner process, 0 = free slot
+    uint32_t tx_head;           // Next frame to arbitrate (free-running index)
+    uint32_t tx_tail;           // Next free entry (free-running index)
+    uint32_t tx_frames;         // Frames won on the bus
+    uint32_t tx_dropped;        // Frames dropped, queue full
+    uint32_t pad;
+    char     name[VBUS_NAME_LEN];
+    vbus_slot_t tx[VBUS_TX_QUEUE];
+} vbus_node_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t bitrate;
+    uint32_t ring_size;
+    uint64_t bus_time_us;       // Time at which the bus becomes idle
+    uint64_t next_seq;          // Sequence number of the next delivered frame
+    uint64_t stat_frames;
+    uint64_t stat_bits;
+    uint64_t stat_busy_us;
+    uint64_t stat_start_us;     // Creation time (bus load reference)
+    vbus_node_t node[VBUS_MAX_NODES];
+    vbus_slot_t ring[VBUS_RING_SIZE];
+} vbus_shared_t;
+
+// --- STATIC VARIABLES ---
+static int            vbus_fd   = -1;
+static vbus_shared_t* vbus      = NULL;
+static int            self_idx  = -1;   // Our node slot
+static uint64_t       rx_seq    = 0;    // Next ring entry to read
+static uint32_t       rx_overruns = 0;
+
+// Local receive queue (filled under lock, drained without it)
+static hal_can_frame_t rx_queue[VBUS_RX_BATCH];
+static int rx_head  = 0;
+static int rx_count = 0;
+
+// Acceptance filters (applied in user space, per node)
+static hal_can_filter_t filters[HAL_CAN_MAX_FILTERS];
+static uint8_t filter_count = 0;
+
+// --- PRIVATE FUNCTIONS ---
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static void bus_lock(void)   { while (flock(vbus_fd, LOCK_EX) < 0 && errno == EINTR) {} }
+static void bus_unlock(void) { flock(vbus_fd, LOCK_UN); }
+
+// A slot whose process is gone (killed, crashed) still has pid != 0
+static int node_alive(const vbus_node_t* nd) {
+    if (nd->pid == 0) return 0;
+    return !(kill((pid_t)nd->pid, 0) < 0 && errno == ESRCH);
+}
+
+/**
+ * @brief Releases the slots of the processes that died without vbus_shutdown().
+ *
+ * @details
+ * Their queued frames are dropped: a dead node must not keep arbitrating, nor
+ * hold the bus with frames nobody will ever resubmit. Must be called with the
+ * lock held.
+ */
+static void bus_reap(void) {
+    for (int n = 0; n < VBUS_MAX_NODES; n++) {
+        vbus_node_t* nd = &vbus->node[n];
+        if (n == self_idx || nd->pid == 0 || node_alive(nd)) continue;
+        nd->tx_head = nd->tx_tail;
+        nd->pid = 0;
+    }
+}
+
+/**
+ * @brief Puts on the wire every pending frame whose arbitration starts before @p now.
+ *
+ * @details
+ * Each iteration models one idle-bus arbitration round: it starts at
+ * max(bus idle time, earliest submit time) and all frames submitted by then
+ * compete; the lowest ID wins (lowest node index on a tie). The result only
+ * depends on the submit times, so evaluating it lazily gives the same order as
+ * an eager bus would. Frames of dead nodes are dropped first (bus_reap).
+ * Must be called with the lock held.
+ */
+static void bus_advance(uint64_t now) {
+    bus_reap();
+    for (;;) {
+        uint64_t earliest = UINT64_MAX;
+        for (int n = 0; n < VBUS_MAX_NODES; n++) {
+            vbus_node_t* nd = &vbus->node[n];
+            if (nd->pid == 0 || nd->tx_head == nd->tx_tail) continue;
+            uint64_t t = nd->tx[nd->tx_head % VBUS_TX_QUEUE].t_us;
+            if (t < earliest) earliest = t;
+        }
+        if (earliest == UINT64_MAX) return;             // Nothing pending
+
+        uint64_t start = (vbus->bus_time_us > earliest) ? vbus->bus_time_us : earliest;
+        if (start > now) return;                        // Next round is in the future
+
+        // Arbitration among the frames submitted before the round started
+        int winner = -1;
+        for (int n = 0; n < VBUS_MAX_NODES; n++) {
+            vbus_node_t* nd = &vbus->node[n];
+            if (nd->pid == 0 || nd->tx_head == nd->tx_tail) continue;
+            const vbus_slot_t* f = &nd->tx[nd->tx_head % VBUS_TX_QUEUE];
+            if (f->t_us > start) continue;
+            if (winner < 0 ||
+                f->id < vbus->node[winner].tx[vbus->node[winner].tx_head % VBUS_TX_QUEUE].id) {
+                winner = n;
+            }
+        }
+
+        vbus_node_t* wn = &vbus->node[winner];
+        const vbus_slot_t* f = &wn->tx[wn->tx_head % VBUS_TX_QUEUE];
+        uint32_t bits = hal_can_frame_bits(f->len);
+        uint64_t dur  = ((uint64_t)bits * 1000000u + vbus->bitrate - 1u) / vbus->bitrate;
+
+        vbus_slot_t* r = &vbus->ring[vbus->next_seq % VBUS_RING_SIZE];
+        *r = *f;
+        r->seq  = vbus->next_seq++;
+        r->t_us = start + dur;
+        r->node = (uint8_t)winner;
+
+        vbus->bus_time_us   = start + dur;
+        vbus->stat_frames  += 1;
+        vbus->stat_bits    += bits;
+        vbus->stat_busy_us += dur;
+        wn->tx_frames++;
+        wn->tx_head++;
+    }
+}
+
+static int filter_accepts(uint32_t id) {
+    if (filter_count == 0) return 1;
+    for (uint8_t i = 0; i < filter_count; i++) {
+        if ((id & filters[i].mask) == (filters[i].id & filters[i].mask)) return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Copies the frames that have completed on the wire into the local queue.
+ * @return Number of frames queued.
+ */
+static int rx_fill_queue(void) {
+    uint64_t now = now_us();
+    int stored = 0;
+
+    bus_lock();
+    bus_advance(now);
+
+    // Reader too slow: the oldest entries have been overwritten
+    if (vbus->next_seq - rx_seq > VBUS_RING_SIZE) {
+        rx_overruns += (uint32_t)(vbus->next_seq - rx_seq - VBUS_RING_SIZE);
+        rx_seq = vbus->next_seq - VBUS_RING_SIZE;
+    }
+
+    while (rx_seq < vbus->next_seq && stored < VBUS_RX_BATCH) {
+        const vbus_slot_t* r = &vbus->ring[rx_seq % VBUS_RING_SIZE];
+        if (r->t_us > now) break;                       // Still on the wire
+        rx_seq++;
+        if (r->node == self_idx || !filter_accepts(r->id)) continue;
+
+        hal_can_frame_t* f = &rx_queue[stored++];
+        f->id  = r->id;
+        f->len = r->len;
+        memcpy(f->data, r->data, sizeof(f->data));
+        f->timestamp_us = (uint32_t)r->t_us;
+    }
+    bus_unlock();
+
+    rx_head  = 0;
+    rx_count = stored;
+    return stored;
+}
+
+// Creates or re-initializes the shared header. Called with the lock held.
+static void bus_format(void) {
+    const char* env = getenv("F1_VBUS_BITRATE");
+    unsigned long bitrate = env ? strtoul(env, NULL, 10) : 0;
+
+    memset(vbus, 0, sizeof(*vbus));
+    vbus->magic     = VBUS_MAGIC;
+    vbus->version   = VBUS_VERSION;
+    vbus->bitrate   = (bitrate > 0 && bitrate <= 1000000u) ? (uint32_t)bitrate : VBUS_DEFAULT_BITRATE;
+    vbus->ring_size = VBUS_RING_SIZE;
+    vbus->stat_start_us = now_us();
+}
+
+// --- PUBLIC FUNCTIONS ---
+
+int vbus_init(const char* name) {
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/f1_vbus_%s", (name && *name) ? name : "default");
+
+    vbus_fd = open(path, O_RDWR | O_CREAT, 0666);
+    if (vbus_fd < 0) {
+        perror("Error opening virtual CAN bus file");
+        return -1;
+    }
+
+    bus_lock();
+
+    struct stat st;
+    if (fstat(vbus_fd, &st) < 0 ||
+        ((size_t)st.st_size < sizeof(vbus_shared_t) && ftruncate(vbus_fd, sizeof(vbus_shared_t)) < 0)) {
+        perror("Error sizing virtual CAN bus file");
+        bus_unlock();
+        close(vbus_fd);
+        vbus_fd = -1;
+        return -2;
+    }
+
+    vbus = mmap(NULL, sizeof(vbus_shared_t), PROT_READ | PROT_WRITE, MAP_SHARED, vbus_fd, 0);
+    if (vbus == MAP_FAILED) {
+        perror("Error mapping virtual CAN bus file");
+        vbus = NULL;
+        bus_unlock();
+        close(vbus_fd);
+        vbus_fd = -1;
+        return -3;
+    }
+
+    // A file left from an earlier boot has times ahead of CLOCK_MONOTONIC: the
+    // bus would stay "busy" until the old bus_time_us. A live bus is at most one
+    // frame ahead of now (the frame on the wire).
+    uint64_t now = now_us();
+    if (vbus->magic != VBUS_MAGIC || vbus->version != VBUS_VERSION || vbus->ring_size != VBUS_RING_SIZE ||
+        vbus->bitrate == 0 || vbus->stat_start_us > now ||
+        vbus->bus_time_us > now + ((uint64_t)hal_can_frame_bits(HAL_CAN_MAX_DLEN) * 1000000u) / vbus->bitrate + 1u) {
+        bus_format();
+    }
+
+    // Take a free slot, reclaiming slots of processes that died without leaving
+    self_idx = -1;
+    bus_reap();
+    for (int n = 0; n < VBUS_MAX_NODES && self_idx < 0; n++) {
+        if (vbus->node[n].pid == 0) self_idx = n;
+    }
+    if (self_idx < 0) {
+        fprintf(stderr, "Error: virtual CAN bus '%s' has no free node slot\n", name);
+        bus_unlock();
+        vbus_shutdown();
+        return -4;
+    }
+
+    vbus_node_t* me = &vbus->node[self_idx];
+    memset(me, 0, sizeof(*me));
+    me->pid = (uint32_t)getpid();
+    strncpy(me->name, program_invocation_short_name, VBUS_NAME_LEN - 1);
+    rx_seq = vbus->next_seq;            // Only frames sent after joining
+    bus_unlock();
+
+    rx_head = rx_count = 0;
+    rx_overruns = 0;
+    filter_count = 0;
+
+    printf("CAN virtual bus '%s' joined as node %d (%u bit/s).\n", path, self_idx, vbus->bitrate);
+    return 0;
+}
+
+int vbus_send_frames(const hal_can_frame_t* frames, uint8_t count) {
+    if (vbus == NULL) return -1;
+
+    uint64_t now = now_us();
+    int queued = 0;
+
+    bus_lock();
+    bus_advance(now);
+    vbus_node_t* me = &vbus->node[self_idx];
+    for (uint8_t i = 0; i < count; i++) {
+        if (me->tx_tail - me->tx_head >= VBUS_TX_QUEUE) {
+            me->tx_dropped += (uint32_t)(count - i);
+            break;
+        }
+        vbus_slot_t* s = &me->tx[me->tx_tail % VBUS_TX_QUEUE];
+        memset(s, 0, sizeof(*s));
+        s->t_us = now;
+        s->id   = frames[i].id & HAL_CAN_STD_MASK;
+        s->len  = (frames[i].len > HAL_CAN_MAX_DLEN) ? HAL_CAN_MAX_DLEN : frames[i].len;
+        s->node = (uint8_t)self_idx;
+        memcpy(s->data, frames[i].data, s->len);
+        me->tx_tail++;
+        queued++;
+    }
+    bus_unlock();
+
+    return queued;
+}
+
+int vbus_tx_free(void) {
+    if (vbus == NULL) return -1;
+
+    bus_lock();
+    bus_advance(now_us());
+    vbus_node_t* me = &vbus->node[self_idx];
+    int free_slots = VBUS_TX_QUEUE - (int)(me->tx_tail - me->tx_head);
+    bus_unlock();
+
+    return free_slots;
+}
+
+int vbus_receive_frame(hal_can_frame_t* frame) {
+    if (vbus == NULL) return -1;
+
+    if (rx_head >= rx_count && rx_fill_queue() == 0) return 0;
+
+    *frame = rx_queue[rx_head++];
+    return 1;
+}
+
+int vbus_set_filters(const hal_can_filter_t* table, uint8_t count) {
+    if (count > HAL_CAN_MAX_FILTERS || (count > 0 && table == NULL)) return -2;
+
+    memcpy(filters, table, sizeof(hal_can_filter_t) * count);
+    filter_count = count;
+    rx_head = rx_count = 0;
+    return 0;
+}
+
+int vbus_get_stats(vbus_stats_t* stats) {
+    if (vbus == NULL) return -1;
+
+    uint64_t now = now_us();
+    bus_lock();
+    bus_advance(now);
+    stats->bitrate     = vbus->bitrate;
+    stats->frames      = vbus->stat_frames;
+    stats->bits        = vbus->stat_bits;
+    stats->busy_us     = vbus->stat_busy_us;
+    stats->elapsed_us  = now - vbus->stat_start_us;
+    stats->tx_dropped  = vbus->node[self_idx].tx_dropped;
+    bus_unlock();
+
+    stats->rx_overruns  = rx_overruns;
+    stats->load_percent = (stats->elapsed_us > 0)
+                        ? (100.0f * (float)stats->busy_us / (float)stats->elapsed_us) : 0.0f;
+    return 0;
+}
+
+void vbus_shutdown(void) {
+    if (vbus != NULL) {
+        if (self_idx >= 0) {
+            // Let queued frames (a last response before a reset) reach the wire first
+            uint64_t t0 = now_us();
+            while (vbus_tx_free() < VBUS_TX_QUEUE && now_us() - t0 < VBUS_DRAIN_US) {}
+
+            bus_lock();
+            vbus->node[self_idx].pid = 0;   // Frames still pending are dropped with the node
+            bus_unlock();
+        }
+        munmap(vbus, sizeof(vbus_shared_t));
+        vbus = NULL;
+    }
+    if (vbus_fd >= 0) {
+        close(vbus_fd);
+        vbus_fd = -1;
+    }
+    self_idx = -1;
+}
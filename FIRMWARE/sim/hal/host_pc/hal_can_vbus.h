@@ -0,0 +1,105 @@
+/**
+ * @file hal_can_vbus.h
+ * @brief User-space virtual CAN bus backend for the host simulation.
+ *
+ * @details
+ * Replaces the `vcan` kernel module when it is not available (CI containers,
+ * machines without root access). All the nodes of a bus (firmware sim, ECU
+ * stand-in, test harnesses) map the same shared file `/tmp/f1_vbus_<name>` and
+ * exchange frames through it:
+ *
+ * - Every node owns a transmit queue in the shared file.
+ * - Pending frames are put on the "wire" by whichever node touches the bus next
+ *   (lazy arbitration): when the bus becomes idle, the lowest identifier among
+ *   the frames already submitted wins, exactly like CAN bitwise arbitration.
+ * - The frame duration is computed from a configurable bit-rate using the
+ *   worst-case stuffed length of a standard data frame, so receivers only see a
+ *   frame once its last bit has been transmitted and bus load can be measured.
+ * - Delivered frames go to a ring with a global sequence number; each node
+ *   reads it at its own pace (overruns are counted, never blocking).
+ *
+ * Access to the shared file is serialized with `flock()`, which is released
+ * automatically if a process dies and can be used from other languages too
+ * (see `tools/vbus.py`).
+ *
+ * The backend is selected by opening an interface named `"vbus:<name>"`
+ * through ::hal_can_init (e.g. `F1_CAN_IF=vbus:default`). The bit-rate is
+ * taken from the environment variable `F1_VBUS_BITRATE` by the node that
+ * creates the bus (default ::VBUS_DEFAULT_BITRATE).
+ *
+ * @note Host-only module; not part of the target HAL.
+ */
+
+#ifndef HAL_CAN_VBUS_H
+#define HAL_CAN_VBUS_H
+
+// --- INCLUDES ---
+#include <stdint.h>
+#include "hal_can.h"
+
+/*--------------------------PUBLIC DEFINES AND TYPES--------------------------------*/
+
+#define VBUS_PREFIX           "vbus:"   /**< Interface name prefix that selects this backend. */
+#define VBUS_DEFAULT_BITRATE  500000u   /**< Default bit-rate (bit/s), same as the FlexCAN target. */
+
+/**
+ * @brief Bus statistics, accumulated since the bus file was created.
+ */
+typedef struct {
+    uint32_t bitrate;         /**< Configured bit-rate (bit/s). */
+    uint64_t frames;          /**< Frames transmitted on the bus (all nodes). */
+    uint64_t bits;            /**< Bits transmitted, worst-case stuffing included. */
+    uint64_t busy_us;         /**< Time the bus was busy (µs). */
+    uint64_t elapsed_us;      /**< Time since the bus was created (µs). */
+    float    load_percent;    /**< busy_us / elapsed_us in percent. */
+    uint32_t tx_dropped;      /**< Frames dropped by this node (TX queue full). */
+    uint32_t rx_overruns;     /**< Frames lost by this node (reader too slow for the ring). */
+} vbus_stats_t;
+
+/*--------------------------PUBLIC API FUNCTIONS-----------------------------------*/
+
+/**
+ * @brief Joins (and creates, if needed) the virtual bus `<name>` as a new node.
+ * @param[in] name Bus name, without the `"vbus:"` prefix.
+ * @return 0 on success, negative on failure (file/mmap error, no free node slot).
+ */
+int vbus_init(const char* name);
+
+/**
+ * @brief Queues frames in this node's transmit queue.
+ * @return Number of frames queued, negative if the bus is not open.
+ */
+int vbus_send_frames(const hal_can_frame_t* frames, uint8_t count);
+
+/**
+ * @brief Returns the free entries of this node's transmit queue.
+ * @return Number of frames vbus_send_frames() accepts now, negative if the bus is not open.
+ */
+int vbus_tx_free(void);
+
+/**
+ * @brief Returns the next frame delivered on the bus (non-blocking).
+ * @details Own frames are not returned. The timestamp is the CLOCK_MONOTONIC
+ *          time (µs) at which the last bit of the frame left the wire.
+ * @return 1 if a frame was returned, 0 if none pending, negative on error.
+ */
+int vbus_receive_frame(hal_can_frame_t* frame);
+
+/**
+ * @brief Installs the acceptance filters applied to this node's receive path.
+ * @return 0 on success, negative on invalid arguments.
+ */
+int vbus_set_filters(const hal_can_filter_t* filters, uint8_t count);
+
+/**
+ * @brief Reads the bus statistics (bus load, frame count, node counters).
+ * @return 0 on success, negative if the bus is not open.
+ */
+int vbus_get_stats(vbus_stats_t* stats);
+
+/**
+ * @brief Leaves the bus and unmaps the shared file.
+ */
+void vbus_shutdown(void);
+
+#endif /* HAL_CAN_VBUS_H */
@@ -0,0 +1,74 @@
+// hal_console.c
+// Host PC (simulation) version of the Hardware Abstraction Layer (HAL) for the command console.
+// Standard input is polled without blocking, so the main loop keeps its 16 ms slot; the
+// terminal delivers whole lines. At end of file (stdin redirected) the console stays silent.
+
+// --- DEFINES ---
+#define _GNU_SOURCE // Needed for poll() with -std=c11
+
+// --- INCLUDES ---
+#include "hal_console.h" // HAL function prototypes
+#include <stdio.h>       // fwrite, fflush
+#include <stdbool.h>
+#include <poll.h>        // poll
+#include <unistd.h>      // read
+
+// --- PRIVATE VARIABLES ---
+static bool input_closed = false;   // End of file seen on stdin
+
+// --- PUBLIC FUNCTIONS ---
+
+/**
+ * @brief Reads what is pending on stdin (never blocks).
+ * @param buf  Destination.
+ * @param size Capacity of buf.
+ * @return Number of characters read.
+ */
+uint32_t hal_console_read(char* buf, uint32_t size) {
+    struct pollfd pfd = { .fd = STDIN_FILENO, .events = POLLIN, .revents = 0 };
+
+    if (input_closed || size == 0) return 0;
+    if (poll(&pfd, 1, 0) <= 0 || !(pfd.revents & (POLLIN | POLLHUP))) return 0;
+
+    ssize_t n = read(STDIN_FILENO, buf, size);
+    if (n <= 0) {
+        input_closed = true;
+        return 0;
+    }
+    return (uint32_t)n;
+}
+
+/**
+ * @brief Writes reply text to stdout.
+ * @param s   Characters.
+ * @param len Number of characters.
+ */
+void hal_console_write(const char* s, uint32_t len) {
+    fwrite(s, 1, len, stdout);
+    fflush(stdout);
+}
+
+/**
+ * @brief stdout waits when it is full: nothing to select.
+ * @param blocking Ignored.
+ */
+void hal_console_set_blocking(bool blocking) {
+    (void)blocking;
+}
+
+/**
+ * @brief Flushes stdout.
+ */
+void hal_console_flush(void) {
+    fflush(stdout);
+}
+
+/**
+ * @brief Nothing is dropped or lost on the host.
+ * @param tx_dropped Always 0.
+ * @param rx_lost    Always 0.
+ */
+void hal_console_get_stats(uint32_t* tx_dropped, uint32_t* rx_lost) {
+    *tx_dropped = 0;
+    *rx_lost = 0;
+}
@@ -0,0 +1,111 @@
+// hal_flash.c
+// Host PC (simulation) version of the Hardware Abstraction Layer (HAL) for the program flash.
+// A 256 KB file mapped in memory stands in for the S32K118 P-Flash. The model enforces
+// the same rules as the FTFC (sector erase, phrase program of erased flash only, alignment)
+// and waits the typical command times, so the bootloader can be tested and timed on the
+// virtual bus. The file (F1_FLASH, default build/flash.bin) keeps the image between runs.
+
+// --- DEFINES ---
+#define _GNU_SOURCE    // ftruncate, usleep with -std=c11
+
+// --- INCLUDES ---
+#include "hal_flash.h" // HAL function prototypes
+#include <stdio.h>     // perror, printf
+#include <stdlib.h>    // getenv
+#include <string.h>    // memset, memcpy
+#include <fcntl.h>     // open
+#include <unistd.h>    // close, ftruncate, usleep
+#include <sys/mman.h>  // mmap
+#include <sys/stat.h>  // fstat
+
+// --- CONSTANTS ---
+#define HOST_FLASH_DEFAULT   "build/flash.bin"
+#define HOST_ERASE_US        12000u  // tersscr typical (Erase Flash Sector)
+#define HOST_PHRASE_US       90u     // tpgm8 typical (Program Phrase)
+
+// --- STATIC VARIABLES ---
+static uint8_t* flash_mem = NULL;    // Mapped model file
+
+// --- PUBLIC FUNCTIONS ---
+
+/**
+ * @brief Maps the flash model file, creating an erased one if it is missing or short.
+ * @return 0 on success, -1 if the file cannot be opened or mapped.
+ */
+int hal_flash_init(void) {
+    if (flash_mem != NULL) return 0;
+
+    const char* path = getenv("F1_FLASH");
+    if (path == NULL || path[0] == '\0') path = HOST_FLASH_DEFAULT;
+
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        perror("flash model open");
+        return -1;
+    }
+
+    struct stat st;
+    int fresh = (fstat(fd, &st) == 0 && st.st_size != (off_t)HAL_FLASH_SIZE);
+    if (fresh && ftruncate(fd, HAL_FLASH_SIZE) < 0) {
+        perror("flash model ftruncate");
+        close(fd);
+        return -1;
+    }
+
+    void* mem = mmap(NULL, HAL_FLASH_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        perror("flash model mmap");
+        return -1;
+    }
+    flash_mem = (uint8_t*)mem;
+
+    if (fresh) memset(flash_mem, HAL_FLASH_ERASED, HAL_FLASH_SIZE);   // Blank device
+    printf("Flash model: %s\n", path);
+    return 0;
+}
+
+/**
+ * @brief Erases one 2 KB sector of the model (all bytes to 0xFF).
+ * @param addr Sector address.
+ * @return 0 on success, -1 if misaligned or out of range, -2 if the model is not mapped.
+ */
+int hal_flash_erase_sector(uint32_t addr) {
+    if ((addr % HAL_FLASH_SECTOR_SIZE) != 0u || addr >= HAL_FLASH_SIZE) return -1;
+    if (flash_mem == NULL) return -2;
+
+    memset(&flash_mem[addr], HAL_FLASH_ERASED, HAL_FLASH_SECTOR_SIZE);
+    usleep(HOST_ERASE_US);
+    return 0;
+}
+
+/**
+ * @brief Programs phrases of the model.
+ * @param addr Destination address.
+ * @param data Source bytes.
+ * @param len Byte count.
+ * @return 0 on success, -1 if misaligned or out of range, -2 if a phrase was not erased
+ *         (the FTFC refuses to program it twice).
+ */
+int hal_flash_program(uint32_t addr, const uint8_t* data, uint32_t len) {
+    if ((addr % HAL_FLASH_PHRASE_SIZE) != 0u || (len % HAL_FLASH_PHRASE_SIZE) != 0u) return -1;
+    if (addr >= HAL_FLASH_SIZE || len > HAL_FLASH_SIZE - addr) return -1;
+    if (flash_mem == NULL) return -2;
+
+    for (uint32_t i = 0; i < len; i++) {
+        if (flash_mem[addr + i] != HAL_FLASH_ERASED) return -2;
+    }
+    memcpy(&flash_mem[addr], data, len);
+    usleep((len / HAL_FLASH_PHRASE_SIZE) * HOST_PHRASE_US);
+    return 0;
+}
+
+/**
+ * @brief Returns a pointer into the model.
+ * @param addr Flash address.
+ * @return Pointer to the byte, NULL if out of range or not mapped.
+ */
+const uint8_t* hal_flash_ptr(uint32_t addr) {
+    if (flash_mem == NULL || addr >= HAL_FLASH_SIZE) return NULL;
+    return &flash_mem[addr];
+}
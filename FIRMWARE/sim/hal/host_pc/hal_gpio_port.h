@@ -0,0 +1,30 @@
+/**
+ * @file hal_gpio_port.h
+ * @brief Host (Linux/PC) GPIO accessors, included by hal_gpio.h.
+ *
+ * @details
+ * The pins are emulated in hal_gpio_host.c (state map, SDL keyboard input).
+ */
+
+#ifndef HAL_GPIO_PORT_H
+#define HAL_GPIO_PORT_H
+
+void    HAL_GPIO_Write(GPIO_Pin_t pin, uint8_t value);
+void    HAL_GPIO_Toggle(GPIO_Pin_t pin);
+uint8_t HAL_GPIO_Read(GPIO_Pin_t pin);
+
+/**
+ * @brief Handles simulated key events for GPIO emulation.
+ *
+ * @details
+ * This function integrates with the SDL event loop to translate key press
+ * and release events into virtual GPIO state changes.  
+ * It updates the internal state map used by ::HAL_GPIO_Read() to reflect
+ * the simulated input status.
+ *
+ * @param[in] keysym  SDL key symbol code (e.g., `SDLK_1` for Button 1).
+ * @param[in] is_down Set to 1 if the key is pressed, 0 if released.
+ */
+void HAL_GPIO_on_key(int keysym, int is_down);
+
+#endif /* HAL_GPIO_PORT_H */
@@ -7,6 +7,8 @@
  * - SDL2 creates a window that mimics the physical display.
  * - Commands and data sent to the display are interpreted and drawn to the SDL texture.
  * - Supports basic display operations: ON/OFF, reset, memory write, and column/page addressing.
+ * - Vertical scrolling (VSCRDEF/VSCRSADD) is applied when the framebuffer is shown: in
+ *   landscape the scrolled gate lines are screen columns.
  * - Keyboard events are forwarded to HAL GPIO button simulation.
  */
 
@@ -37,6 +39,13 @@ static uint8_t  displayOn  = 1;  // Display ON/OFF flag
 static uint16_t windowX0 = 0, windowY0 = 0, windowX1 = TFT_WIDTH - 1, windowY1 = TFT_HEIGHT - 1;
 static uint16_t curX = 0, curY = 0;  // Current pixel coordinates
 
+// Parameter bytes of the last command (reset by every command)
+static uint8_t  dataBuf[6];
+static int      dataIdx = 0;
+
+// Vertical scrolling: band of columns [scrollTop, scrollTop + scrollLines), first column shown
+static uint16_t scrollTop = 0, scrollLines = TFT_WIDTH, scrollStart = 0;
+
 /*-------------------------- INTERNAL FUNCTIONS --------------------------*/
 
 /**
@@ -60,9 +69,14 @@ static void update_texture(void) {
     if (SDL_LockTexture(texture, NULL, &pixels, &pitch) != 0) return;
 
     uint32_t* dst = (uint32_t*)pixels;
-    for (int y = 0; y < TFT_HEIGHT; ++y) {
-        for (int x = 0; x < TFT_WIDTH; ++x) {
-            dst[y * (pitch / 4) + x] = rgb565_to_argb8888(framebuffer[y * TFT_WIDTH + x]);
+    for (int x = 0; x < TFT_WIDTH; ++x) {
+        // Column of the memory shown here: the band wraps from scrollStart
+        int src = x;
+        if (x >= scrollTop && x < scrollTop + scrollLines && scrollStart >= scrollTop && scrollStart < scrollTop + scrollLines) {
+            src = scrollTop + (x - scrollTop + scrollStart - scrollTop) % scrollLines;
+        }
+        for (int y = 0; y < TFT_HEIGHT; ++y) {
+            dst[y * (pitch / 4) + x] = rgb565_to_argb8888(framebuffer[y * TFT_WIDTH + src]);
         }
     }
 
@@ -107,6 +121,7 @@ void HAL_Display_Init(void) {
  */
 void HAL_Display_Reset(void) {
     memset(framebuffer, 0, sizeof(framebuffer));
+    scrollTop = 0; scrollLines = TFT_WIDTH; scrollStart = 0;
     SDL_RenderClear(renderer);
     SDL_RenderPresent(renderer);
     HAL_DelayMs(100);
@@ -137,6 +152,7 @@ void HAL_Display_On(void) {
  */
 void HAL_Display_WriteCommand(uint8_t cmd) {
     lastCmd = cmd;
+    dataIdx = 0;
     //printf("[HAL_DISPLAY_HOST] CMD: 0x%02X\n", cmd);
 
     if (cmd == 0x28) HAL_Display_Off();  // Display OFF
@@ -151,20 +167,28 @@ void HAL_Display_WriteCommand(uint8_t cmd) {
  * @brief Writes a data byte to the display simulation.
  */
 void HAL_Display_WriteData(uint8_t data) {
-    static uint8_t buf[4];
-    static int idx = 0;
+    uint8_t *buf = dataBuf;
+    if (dataIdx >= (int)sizeof(dataBuf)) return;   // Parameters of a command not emulated
 
-    buf[idx++] = data;
+    buf[dataIdx++] = data;
 
-    if (lastCmd == 0x2A && idx == 4) { // Column set
+    if (lastCmd == 0x2A && dataIdx == 4) { // Column set
         windowX0 = (buf[0] << 8) | buf[1];
         windowX1 = (buf[2] << 8) | buf[3];
-        idx = 0;
-    } else if (lastCmd == 0x2B && idx == 4) { // Page set
+        dataIdx = 0;
+    } else if (lastCmd == 0x2B && dataIdx == 4) { // Page set
         windowY0 = (buf[0] << 8) | buf[1];
         windowY1 = (buf[2] << 8) | buf[3];
-        idx = 0;
-    } else if (lastCmd == 0x2C && idx == 2) { // Pixel write RGB565
+        dataIdx = 0;
+    } else if (lastCmd == 0x33 && dataIdx == 6) { // Vertical scrolling definition (TFA, VSA, BFA)
+        scrollTop   = (buf[0] << 8) | buf[1];
+        scrollLines = (buf[2] << 8) | buf[3];
+        if (scrollLines == 0 || scrollTop + scrollLines > TFT_WIDTH) { scrollTop = 0; scrollLines = TFT_WIDTH; }
+        dataIdx = 0;
+    } else if (lastCmd == 0x37 && dataIdx == 2) { // Vertical scrolling start address
+        scrollStart = (buf[0] << 8) | buf[1];
+        dataIdx = 0;
+    } else if (lastCmd == 0x2C && dataIdx == 2) { // Pixel write RGB565
         uint16_t color = (buf[0] << 8) | buf[1];
         if (curX >= windowX0 && curX <= windowX1 &&
             curY >= windowY0 && curY <= windowY1 &&
@@ -175,7 +199,7 @@ void HAL_Display_WriteData(uint8_t data) {
         if (curX > windowX1) { curX = windowX0; curY++; }
         if (curY > windowY1) curY = windowY0;
 
-        idx = 0;
+        dataIdx = 0;
     }
 }
 
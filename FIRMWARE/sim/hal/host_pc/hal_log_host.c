@@ -0,0 +1,148 @@
+// hal_log.c
+// Host PC (simulation) version of the Hardware Abstraction Layer (HAL) for the tokenized log.
+// The format string is available in the process, so each record is formatted and printed
+// immediately: one conversion at a time, with the argument word turned back into the type
+// the conversion expects (same rules as tools/log_decode.py).
+// Binary frames (telemetry) go to a pty or a file named by F1_TELEM, not to stdout.
+
+// --- DEFINES ---
+#define _GNU_SOURCE // Needed for posix_openpt(), ptsname() and cfmakeraw() with -std=c11
+
+// --- INCLUDES ---
+#include "hal_log.h"   // HAL function prototypes
+#include <stdio.h>     // printf, snprintf, fputs
+#include <stdlib.h>    // getenv, posix_openpt, grantpt, unlockpt, ptsname
+#include <string.h>    // strchr, strlen, strcmp
+#include <stdbool.h>
+#include <fcntl.h>     // open, O_* flags
+#include <unistd.h>    // write
+#include <termios.h>   // cfmakeraw, tcsetattr
+
+// The conversions are taken from the log call's format string, one at a time
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+
+// --- CONSTANTS ---
+#define HOST_LOG_SPEC_MAX  16   // Longest conversion specification kept ("%-08.3lx")
+
+// --- PRIVATE VARIABLES ---
+static int  frame_fd = -1;          // Telemetry sink, -1 = frames discarded
+static bool frame_opened = false;   // F1_TELEM already evaluated
+
+// --- PRIVATE FUNCTIONS ---
+
+// Opens the sink named by F1_TELEM: "pty" or a file path (evaluated once).
+static void frame_open(void) {
+    const char* env = getenv("F1_TELEM");
+    frame_opened = true;
+    if (env == NULL || env[0] == '\0') return;
+
+    if (strcmp(env, "pty") == 0) {
+        int fd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (fd < 0 || grantpt(fd) != 0 || unlockpt(fd) != 0) {
+            perror("[TELEM] posix_openpt");
+            if (fd >= 0) close(fd);
+            return;
+        }
+        struct termios tio;
+        if (tcgetattr(fd, &tio) == 0) {
+            cfmakeraw(&tio);                    // Binary frames: no newline translation, no echo
+            tcsetattr(fd, TCSANOW, &tio);
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);   // Nobody reading: frames are dropped
+        frame_fd = fd;
+        printf("[TELEM] Telemetry stream on %s\n", ptsname(fd));
+        fflush(stdout);                         // The viewer needs the name now
+    } else {
+        frame_fd = open(env, O_WRONLY | O_CREAT | O_TRUNC | O_NONBLOCK, 0644);
+        if (frame_fd < 0) {
+            perror("[TELEM] open");
+            return;
+        }
+        printf("[TELEM] Telemetry stream to %s\n", env);
+    }
+}
+
+// Formats one conversion (spec is NUL-terminated, without length modifiers) with word v.
+static void log_conv(char* out, size_t size, const char* spec, char conv, hal_log_arg_t v) {
+    switch (conv) {
+        case 'd': case 'i':
+            snprintf(out, size, spec, (int)(int32_t)(uint32_t)v);
+            break;
+        case 'u': case 'x': case 'X': case 'o':
+            snprintf(out, size, spec, (unsigned)(uint32_t)v);
+            break;
+        case 'c':
+            snprintf(out, size, spec, (int)(uint8_t)v);
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': {
+            union { uint32_t u; float f; } w = { (uint32_t)v };
+            snprintf(out, size, spec, (double)w.f);
+            break;
+        }
+        case 's':
+            snprintf(out, size, spec, (const char*)v);
+            break;
+        default:
+            snprintf(out, size, "%s", spec);   // Unknown: shown as written
+            break;
+    }
+}
+
+// --- PUBLIC FUNCTIONS ---
+
+/**
+ * @brief Formats and prints one log call.
+ * @param fmt  Format string.
+ * @param n    Argument count.
+ * @param args Argument words.
+ */
+void hal_log_write(const char* fmt, uint32_t n, const hal_log_arg_t* args) {
+    char line[512];
+    size_t len = 0;
+    uint32_t arg = 0;
+
+    for (const char* p = fmt; *p != '\0' && len < sizeof(line) - 1; ) {
+        if (*p != '%') {
+            line[len++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            line[len++] = '%';
+            p += 2;
+            continue;
+        }
+
+        // Copy flags, width and precision; drop the length modifiers (h, l, z, ...)
+        char spec[HOST_LOG_SPEC_MAX];
+        size_t s = 0;
+        spec[s++] = *p++;
+        while (*p != '\0' && strchr("-+ #0123456789.", *p) != NULL && s < sizeof(spec) - 2) spec[s++] = *p++;
+        while (*p != '\0' && strchr("hlLqjzt", *p) != NULL) p++;
+        if (*p == '\0') break;
+        char conv = *p++;
+        spec[s++] = conv;
+        spec[s] = '\0';
+
+        hal_log_arg_t v = (arg < n) ? args[arg] : 0;
+        arg++;
+        log_conv(&line[len], sizeof(line) - len, spec, conv, v);
+        len += strlen(&line[len]);
+    }
+    line[len] = '\0';
+    fputs(line, stdout);
+}
+
+/**
+ * @brief Writes one binary frame to the telemetry sink (pty or file).
+ * @param frame Frame bytes.
+ * @param len   Frame length.
+ */
+void hal_log_frame(const uint8_t* frame, uint32_t len) {
+    if (!frame_opened) frame_open();
+    if (frame_fd < 0) return;
+
+    // Non-blocking: a full pty buffer (nobody reading) drops the frame, the reader
+    // resynchronizes on the next 0x00
+    ssize_t ret = write(frame_fd, frame, len);
+    (void)ret;
+}
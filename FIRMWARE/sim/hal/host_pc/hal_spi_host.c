@@ -73,9 +73,9 @@ void HAL_SPI_TransmitByte(uint8_t byte) {
 
     if (dc) {
         HAL_Display_WriteData(byte);
-        printf("[HAL_SPI_HOST] BYTE(DATA) -> 0x%02X\n", byte);
+        //printf("[HAL_SPI_HOST] BYTE(DATA) -> 0x%02X\n", byte);   // per pixel byte: too verbose
     } else {
         HAL_Display_WriteCommand(byte);
-        printf("[HAL_SPI_HOST] BYTE(CMD) -> 0x%02X\n", byte);
+        //printf("[HAL_SPI_HOST] BYTE(CMD) -> 0x%02X\n", byte);
     }
 }
@@ -0,0 +1,15 @@
+/**
+ * @file hal_spi_port.h
+ * @brief Host (Linux/PC) SPI byte accessors, included by hal_spi.h.
+ */
+
+#ifndef HAL_SPI_PORT_H
+#define HAL_SPI_PORT_H
+
+#include "hal_ramfunc.h"  /* HAL_INLINE */
+
+void HAL_SPI_TransmitByte(uint8_t byte);
+
+HAL_INLINE void HAL_SPI_WaitTxDone(void) {}
+
+#endif /* HAL_SPI_PORT_H */
@@ -0,0 +1,37 @@
+// hal_time.c
+// Host PC (simulation) version of the Hardware Abstraction Layer (HAL) for the boot clock.
+// Microseconds of CLOCK_MONOTONIC since hal_time_init().
+
+// --- DEFINES ---
+#define _POSIX_C_SOURCE 199309L // Needed for clock_gettime() with -std=c11
+
+// --- INCLUDES ---
+#include "hal_time.h" // HAL function prototypes
+#include <time.h>     // clock_gettime
+
+// --- PRIVATE VARIABLES ---
+static uint64_t start_us = 0;   // CLOCK_MONOTONIC at hal_time_init()
+
+// --- PRIVATE FUNCTIONS ---
+static uint64_t monotonic_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+// --- PUBLIC FUNCTIONS ---
+
+/**
+ * @brief Starts the clock at 0.
+ */
+void hal_time_init(void) {
+    start_us = monotonic_us();
+}
+
+/**
+ * @brief Microseconds since hal_time_init().
+ * @return Current time in µs (wraps).
+ */
+uint32_t hal_time_us(void) {
+    return (uint32_t)(monotonic_us() - start_us);
+}
@@ -26,6 +26,10 @@
 #include "test/adc_test.h"      /**< Declaration for the ADC testing routine. */
 #include "test/can_test.h"      /**< Declaration for the CAN testing routine. */
 #include "test/tft_test.h"      /**< Declaration for the TFT display testing routine. */
+#include "test/gear_pred_test.h"    /**< Self-checking test of the predicted gear. */
+#include "test/can_tx_sched_test.h" /**< Self-checking test of the CAN transmit scheduler. */
+#include "test/sig_store_test.h"    /**< Self-checking test of the signal store. */
+#include "hal/hal_time.h"       /**< Boot clock: timestamps of the init stages. */
 #include <stdio.h>              /**< Standard I/O library (used for debugging output). */
 
 /*----------------------------FORWARD DECLARATION----------------------------------------*/
@@ -58,6 +62,8 @@ int main(int argc, char** argv) {
     // and running isolated test functions by commenting/uncommenting the relevant lines.
     // This is a common and useful practice for debugging individual modules.
 
+    hal_time_init();    // Boot timestamps count from here
+
     //watchdog disable
     //initialization of uart
     printf("[BOOT] Watchdog disabled\n");
@@ -91,6 +97,10 @@ int main(int argc, char** argv) {
     // By uncommenting this line, the program would only run the LCD test routine.
     //tft_test();
 
+    // By uncommenting this line, the program would only run the self-checking driver tests
+    // (no hardware, no bus); the exit status is the number of failed checks.
+    //return gear_pred_test() + can_tx_sched_test() + sig_store_test();
+
     /*---------------------MAIN APPLICATION CALL (Active)------------------------------*/
     
     /** Transfers control to the full application logic implemented in app_main.c. */
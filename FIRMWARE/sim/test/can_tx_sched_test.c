@@ -0,0 +1,108 @@
+/**
+ * @file can_tx_sched_test.c
+ * @brief Self-checking test of the CAN transmit scheduler (drivers/can_tx_sched.c).
+ *
+ * @details
+ * Runs timelines of signal updates and polls with the application policies
+ * (buttons forced on edge, clutch with deadband and minimum gap, keep-alive)
+ * and checks the reason returned by every poll and the counters:
+ * - deadband: a move equal to the deadband sends nothing, one step more does;
+ * - gap: a change inside the minimum gap is deferred to the first slot after it;
+ * - edge: a button edge is sent at once, inside the gap;
+ * - keep-alive: a frame after the maximum silence without changes;
+ * - refused: without a commit the references stay and the frame is asked again;
+ * - coalescing: changes due in the same slot share one frame.
+ */
+
+#include "../drivers/can_tx_sched.h"
+#include "can_tx_sched_test.h"
+#include "test_check.h"
+
+/** @brief Same shape as the application policies (tx_policies in app_main.c). */
+static const TxPolicy_t test_policies[TX_SIG_COUNT] = {
+    [TX_SIG_BUTTONS] = { .min_gap_ms = 0,  .max_silence_ms = 200, .deadband = 0,  .force_on_edge = true  },
+    [TX_SIG_ROTARY]  = { .min_gap_ms = 0,  .max_silence_ms = 200, .deadband = 0,  .force_on_edge = true  },
+    [TX_SIG_CLUTCH]  = { .min_gap_ms = 20, .max_silence_ms = 200, .deadband = 10, .force_on_edge = false },
+};
+
+/** @brief Polls and, if a frame is due, commits it as accepted (the application path). */
+static uint8_t poll_send(uint32_t now_ms) {
+    uint8_t reasons = can_tx_sched_poll(now_ms);
+    if (reasons != 0u) can_tx_sched_commit(now_ms);
+    return reasons;
+}
+
+/**
+ * @brief Runs the transmit scheduler timelines.
+ *
+ * @return int Number of failed checks (0 = pass).
+ */
+int can_tx_sched_test(void) {
+    int fails = 0;
+    TxSchedStats_t st;
+
+    printf("can_tx_sched_test: deadband / gap / edge / keep-alive timelines\n");
+    can_tx_sched_init(test_policies);
+
+    /* First frame at start-up, then nothing without changes */
+    TEST_CHECK(fails, poll_send(0u) == TX_REASON_KEEPALIVE);
+    TEST_CHECK(fails, poll_send(16u) == 0u);
+
+    /* Deadband: +10 is not enough, +11 is (the gap has elapsed) */
+    can_tx_sched_update(TX_SIG_CLUTCH, 10);
+    TEST_CHECK(fails, poll_send(30u) == 0u);
+    can_tx_sched_update(TX_SIG_CLUTCH, 11);
+    TEST_CHECK(fails, poll_send(40u) == TX_REASON_CHANGE);
+    TEST_CHECK(fails, poll_send(56u) == 0u);
+
+    /* Gap: a change 10 ms after the frame waits until 20 ms have elapsed */
+    can_tx_sched_update(TX_SIG_CLUTCH, 50);
+    TEST_CHECK(fails, poll_send(50u) == 0u);
+    TEST_CHECK(fails, poll_send(59u) == 0u);
+    TEST_CHECK(fails, poll_send(60u) == TX_REASON_CHANGE);
+    can_tx_sched_getStats(&st);
+    TEST_CHECK(fails, st.deferred == 2u);
+
+    /* Edge: a button press 1 ms after the frame is sent at once */
+    can_tx_sched_update(TX_SIG_BUTTONS, 0x1);
+    TEST_CHECK(fails, poll_send(61u) == TX_REASON_EDGE);
+
+    /* Keep-alive: 200 ms of silence */
+    TEST_CHECK(fails, poll_send(260u) == 0u);
+    TEST_CHECK(fails, poll_send(261u) == TX_REASON_KEEPALIVE);
+
+    /* Refused: no commit, the same change is due again next slot */
+    can_tx_sched_update(TX_SIG_ROTARY, 3);
+    TEST_CHECK(fails, can_tx_sched_poll(270u) == TX_REASON_EDGE);
+    TEST_CHECK(fails, can_tx_sched_poll(286u) == TX_REASON_EDGE);
+    can_tx_sched_commit(286u);
+    TEST_CHECK(fails, poll_send(302u) == 0u);
+    can_tx_sched_getStats(&st);
+    TEST_CHECK(fails, st.refused == 1u);
+
+    /* A refused frame does not restart the gap or the keep-alive */
+    can_tx_sched_update(TX_SIG_CLUTCH, 80);
+    TEST_CHECK(fails, can_tx_sched_poll(310u) == TX_REASON_CHANGE);
+    TEST_CHECK(fails, poll_send(311u) == TX_REASON_CHANGE);
+
+    /* Coalescing: button edge and clutch change in the same slot, one frame */
+    can_tx_sched_update(TX_SIG_BUTTONS, 0x0);
+    can_tx_sched_update(TX_SIG_CLUTCH, 200);
+    TEST_CHECK(fails, poll_send(340u) == (TX_REASON_EDGE | TX_REASON_CHANGE));
+    TEST_CHECK(fails, poll_send(356u) == 0u);
+
+    /* Counters: frames are the committed ones */
+    can_tx_sched_getStats(&st);
+    TEST_CHECK(fails, st.frames == 8u);
+    TEST_CHECK(fails, st.edge == 3u && st.change == 4u && st.keepalive == 2u);
+    TEST_CHECK(fails, st.coalesced == 1u && st.refused == 2u);
+
+    /* Policy change at run time: a smaller deadband applies from the next poll */
+    TxPolicy_t fine = test_policies[TX_SIG_CLUTCH];
+    fine.deadband = 0;
+    can_tx_sched_setPolicy(TX_SIG_CLUTCH, &fine);
+    can_tx_sched_update(TX_SIG_CLUTCH, 201);
+    TEST_CHECK(fails, poll_send(380u) == TX_REASON_CHANGE);
+
+    return test_report("can_tx_sched_test", fails);
+}
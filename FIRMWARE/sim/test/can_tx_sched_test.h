@@ -0,0 +1,19 @@
+/**
+ * @file can_tx_sched_test.h
+ * @brief Header for the CAN transmit scheduler self-checking test.
+ */
+
+#ifndef CAN_TX_SCHED_TEST_H
+#define CAN_TX_SCHED_TEST_H
+
+/**
+ * @brief Executes the CAN transmit scheduler test.
+ *
+ * Runs fixed update / poll timelines against the scheduler and prints
+ * every failed check.
+ *
+ * @return int Number of failed checks (0 = pass).
+ */
+int can_tx_sched_test(void);
+
+#endif /* CAN_TX_SCHED_TEST_H */
@@ -0,0 +1,104 @@
+/**
+ * @file gear_pred_test.c
+ * @brief Self-checking test of the predicted gear (drivers/gear_pred.c).
+ *
+ * @details
+ * Drives the prediction with timed sequences of paddle presses and ECU
+ * frames and checks the displayed gear, the pending flag and the counters:
+ * - press then ECU echo: the gear moves at once and is confirmed by the echo,
+ *   frames older than the press and frames not yet shifted keep it pending;
+ * - multi-press: a shift through several gears stays pending part way;
+ * - mismatch: a Gear_Actual outside the shift rolls the display back;
+ * - timeout: no confirmation within the timeout rolls it back;
+ * - limits: no prediction below neutral or above the top gear.
+ *
+ * Times are in microseconds, as in the application (receive timebase).
+ */
+
+#include "../drivers/gear_pred.h"
+#include "gear_pred_test.h"
+#include "test_check.h"
+
+#define MAX_GEAR    9u
+#define TIMEOUT_MS  250u
+
+/**
+ * @brief Runs the gear prediction sequences.
+ *
+ * @return int Number of failed checks (0 = pass).
+ */
+int gear_pred_test(void) {
+    int fails = 0;
+    GearPredStats_t st;
+
+    printf("gear_pred_test: press / echo / mismatch / timeout sequences\n");
+    gear_pred_init(MAX_GEAR, TIMEOUT_MS);
+    gear_pred_ecu(2, 1000u);
+    TEST_CHECK(fails, gear_pred_shown() == 2u && !gear_pred_isPending());
+
+    /* Press UP, ECU echo after 50 ms */
+    TEST_CHECK(fails, gear_pred_shift(+1, 10000u));
+    TEST_CHECK(fails, gear_pred_shown() == 3u && gear_pred_isPending());
+    gear_pred_ecu(2, 9000u);                        /* Frame older than the press: ignored */
+    TEST_CHECK(fails, gear_pred_shown() == 3u && gear_pred_isPending());
+    gear_pred_ecu(2, 20000u);                       /* ECU not shifted yet */
+    TEST_CHECK(fails, gear_pred_shown() == 3u && gear_pred_isPending());
+    gear_pred_ecu(3, 60000u);                       /* Echo */
+    TEST_CHECK(fails, gear_pred_shown() == 3u && !gear_pred_isPending());
+    gear_pred_getStats(&st);
+    TEST_CHECK(fails, st.predictions == 1u && st.confirmed == 1u);
+    TEST_CHECK(fails, st.lat_last_us == 50000u && st.lat_min_us == 50000u && st.lat_max_us == 50000u);
+
+    /* Two presses UP (3 -> 5), ECU passes through 4 */
+    TEST_CHECK(fails, gear_pred_shift(+1, 100000u));
+    TEST_CHECK(fails, gear_pred_shift(+1, 120000u));
+    TEST_CHECK(fails, gear_pred_shown() == 5u);
+    gear_pred_ecu(4, 150000u);                      /* Part way: still pending */
+    TEST_CHECK(fails, gear_pred_shown() == 5u && gear_pred_isPending());
+    gear_pred_ecu(5, 170000u);                      /* Latency from the last press */
+    TEST_CHECK(fails, gear_pred_shown() == 5u && !gear_pred_isPending());
+    gear_pred_getStats(&st);
+    TEST_CHECK(fails, st.confirmed == 2u && st.lat_last_us == 50000u);
+
+    /* Mismatch: press DOWN (5 -> 4), ECU reports 7 */
+    TEST_CHECK(fails, gear_pred_shift(-1, 200000u));
+    TEST_CHECK(fails, gear_pred_shown() == 4u);
+    gear_pred_ecu(7, 230000u);
+    TEST_CHECK(fails, gear_pred_shown() == 7u && !gear_pred_isPending());
+    gear_pred_getStats(&st);
+    TEST_CHECK(fails, st.mismatches == 1u && st.confirmed == 2u);
+
+    /* Timeout: press UP (7 -> 8), no echo; rolled back after TIMEOUT_MS from the press */
+    TEST_CHECK(fails, gear_pred_shift(+1, 300000u));
+    gear_pred_ecu(7, 320000u);
+    gear_pred_update(300000u + TIMEOUT_MS * 1000u);
+    TEST_CHECK(fails, gear_pred_shown() == 8u && gear_pred_isPending());
+    gear_pred_update(300000u + TIMEOUT_MS * 1000u + 1u);
+    TEST_CHECK(fails, gear_pred_shown() == 7u && !gear_pred_isPending());
+    gear_pred_getStats(&st);
+    TEST_CHECK(fails, st.timeouts == 1u && st.predictions == 5u);
+
+    /* Timeout across the 32-bit wrap of the timebase */
+    gear_pred_ecu(7, 0xFFFFF000u);
+    TEST_CHECK(fails, gear_pred_shift(-1, 0xFFFFF000u));
+    gear_pred_update(0x00001000u);                  /* 8 ms later */
+    TEST_CHECK(fails, gear_pred_shown() == 6u && gear_pred_isPending());
+    gear_pred_ecu(6, 0x00002000u);
+    TEST_CHECK(fails, !gear_pred_isPending());
+    gear_pred_getStats(&st);
+    TEST_CHECK(fails, st.lat_last_us == 0x3000u);
+
+    /* Limits: neutral and top gear */
+    gear_pred_ecu(0, 0x00010000u);
+    TEST_CHECK(fails, !gear_pred_shift(-1, 0x00011000u));
+    gear_pred_ecu((uint8_t)MAX_GEAR, 0x00012000u);
+    TEST_CHECK(fails, !gear_pred_shift(+1, 0x00013000u));
+    TEST_CHECK(fails, gear_pred_shown() == MAX_GEAR && !gear_pred_isPending());
+
+    /* Counters clear, state kept */
+    gear_pred_resetStats();
+    gear_pred_getStats(&st);
+    TEST_CHECK(fails, st.predictions == 0u && st.confirmed == 0u && gear_pred_shown() == MAX_GEAR);
+
+    return test_report("gear_pred_test", fails);
+}
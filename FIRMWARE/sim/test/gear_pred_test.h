@@ -0,0 +1,19 @@
+/**
+ * @file gear_pred_test.h
+ * @brief Header for the predicted gear self-checking test.
+ */
+
+#ifndef GEAR_PRED_TEST_H
+#define GEAR_PRED_TEST_H
+
+/**
+ * @brief Executes the predicted gear test.
+ *
+ * Runs fixed press / ECU frame sequences against the prediction and
+ * prints every failed check.
+ *
+ * @return int Number of failed checks (0 = pass).
+ */
+int gear_pred_test(void);
+
+#endif /* GEAR_PRED_TEST_H */
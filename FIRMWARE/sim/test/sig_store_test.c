@@ -0,0 +1,93 @@
+/**
+ * @file sig_store_test.c
+ * @brief Self-checking test of the signal store (drivers/sig_store.c).
+ *
+ * @details
+ * Checks the change coalescing the consumers rely on:
+ * - a new subscriber sees every signal of its mask once;
+ * - several changes of a signal between two runs of a consumer are reported
+ *   once, with the latest value, while the sequence number counts them all;
+ * - a publish of the same value is not a change (no notification, no stamp);
+ * - a subscriber is only notified of its own signals;
+ * - sig_invalidate / sig_setMask stay within the subscription;
+ * - float signals compare bitwise (-0.0 differs from +0.0).
+ *
+ * The store is a singleton: run this test instead of app_main().
+ */
+
+#include "../drivers/sig_store.h"
+#include "sig_store_test.h"
+#include "test_check.h"
+
+enum { T_SIG_A, T_SIG_B, T_SIG_F, T_SIG_COUNT };
+
+static const SigDef_t test_sigs[T_SIG_COUNT] = {
+    [T_SIG_A] = { "a", SIG_T_I32 },
+    [T_SIG_B] = { "b", SIG_T_I32 },
+    [T_SIG_F] = { "f", SIG_T_F32 },
+};
+
+/**
+ * @brief Runs the signal store coalescing checks.
+ *
+ * @return int Number of failed checks (0 = pass).
+ */
+int sig_store_test(void) {
+    int fails = 0;
+
+    printf("sig_store_test: change coalescing and notification\n");
+    sig_init(test_sigs, T_SIG_COUNT);
+    uint8_t sub_ab = sig_subscribe(SIG_BIT(T_SIG_A) | SIG_BIT(T_SIG_B));
+    uint8_t sub_f  = sig_subscribe(SIG_BIT(T_SIG_F));
+
+    /* First run: every signal of the subscription */
+    TEST_CHECK(fails, sig_changed(sub_ab) == (SIG_BIT(T_SIG_A) | SIG_BIT(T_SIG_B)));
+    TEST_CHECK(fails, sig_changed(sub_f) == SIG_BIT(T_SIG_F));
+    TEST_CHECK(fails, sig_changed(sub_ab) == 0u);
+
+    /* Three changes in one slot: reported once, latest value, all counted */
+    sig_set_time(100u);
+    TEST_CHECK(fails, sig_publish_i32(T_SIG_A, 1));
+    TEST_CHECK(fails, sig_publish_i32(T_SIG_A, 2));
+    TEST_CHECK(fails, sig_publish_i32(T_SIG_A, 3));
+    TEST_CHECK(fails, sig_changed(sub_ab) == SIG_BIT(T_SIG_A));
+    TEST_CHECK(fails, sig_changed(sub_f) == 0u);
+    TEST_CHECK(fails, sig_get_i32(T_SIG_A) == 3 && sig_seq(T_SIG_A) == 3u);
+    TEST_CHECK(fails, sig_time_ms(T_SIG_A) == 100u && sig_epoch() == 3u);
+
+    /* Same value: not a change, time stamp kept */
+    sig_set_time(200u);
+    TEST_CHECK(fails, !sig_publish_i32(T_SIG_A, 3));
+    TEST_CHECK(fails, sig_changed(sub_ab) == 0u);
+    TEST_CHECK(fails, sig_seq(T_SIG_A) == 3u && sig_time_ms(T_SIG_A) == 100u);
+
+    /* Back and forth between two runs: still reported (the value moved) */
+    TEST_CHECK(fails, sig_publish_i32(T_SIG_B, 7));
+    TEST_CHECK(fails, sig_publish_i32(T_SIG_B, 0));
+    TEST_CHECK(fails, sig_changed(sub_ab) == SIG_BIT(T_SIG_B));
+    TEST_CHECK(fails, sig_get_i32(T_SIG_B) == 0 && sig_time_ms(T_SIG_B) == 200u);
+
+    /* Float: bitwise compare */
+    TEST_CHECK(fails, !sig_publish_f32(T_SIG_F, 0.0f));
+    TEST_CHECK(fails, sig_publish_f32(T_SIG_F, -0.0f));
+    TEST_CHECK(fails, sig_publish_f32(T_SIG_F, 1.5f));
+    TEST_CHECK(fails, sig_changed(sub_f) == SIG_BIT(T_SIG_F) && sig_get_f32(T_SIG_F) == 1.5f);
+    TEST_CHECK(fails, sig_changed(sub_ab) == 0u);
+
+    /* Invalidate: limited to the subscription */
+    sig_invalidate(sub_ab, SIG_BIT(T_SIG_A) | SIG_BIT(T_SIG_F));
+    TEST_CHECK(fails, sig_changed(sub_ab) == SIG_BIT(T_SIG_A));
+
+    /* setMask: pending changes of the dropped signals go, added ones are not pending */
+    sig_publish_i32(T_SIG_A, 4);
+    sig_publish_i32(T_SIG_B, 5);
+    sig_setMask(sub_ab, SIG_BIT(T_SIG_B) | SIG_BIT(T_SIG_F));
+    TEST_CHECK(fails, sig_changed(sub_ab) == SIG_BIT(T_SIG_B));
+    sig_publish_i32(T_SIG_A, 6);
+    TEST_CHECK(fails, sig_changed(sub_ab) == 0u);
+
+    /* Out of range IDs */
+    TEST_CHECK(fails, !sig_publish_i32(T_SIG_COUNT, 1) && sig_get_i32(T_SIG_COUNT) == 0);
+
+    return test_report("sig_store_test", fails);
+}
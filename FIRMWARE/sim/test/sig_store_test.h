@@ -0,0 +1,19 @@
+/**
+ * @file sig_store_test.h
+ * @brief Header for the signal store self-checking test.
+ */
+
+#ifndef SIG_STORE_TEST_H
+#define SIG_STORE_TEST_H
+
+/**
+ * @brief Executes the signal store test.
+ *
+ * Publishes fixed sequences and checks what the subscribers see, printing
+ * every failed check.
+ *
+ * @return int Number of failed checks (0 = pass).
+ */
+int sig_store_test(void);
+
+#endif /* SIG_STORE_TEST_H */
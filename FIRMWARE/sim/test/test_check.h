@@ -0,0 +1,31 @@
+/**
+ * @file test_check.h
+ * @brief Check macro of the self-checking driver tests (gear_pred, can_tx_sched, sig_store).
+ *
+ * @details
+ * Unlike the interactive tests, these run a fixed sequence of inputs against
+ * a driver, print every failed expectation with its line and return the
+ * number of failures (0 = pass).
+ */
+
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <stdio.h>
+
+/** @brief Counts and prints a failed expectation. */
+#define TEST_CHECK(fails, cond)                                              \
+    do {                                                                     \
+        if (!(cond)) {                                                       \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);         \
+            (fails)++;                                                       \
+        }                                                                    \
+    } while (0)
+
+/** @brief Prints the verdict of a test and returns its failure count. */
+static inline int test_report(const char *name, int fails) {
+    printf("%s: %s (%d failed)\n", name, (fails == 0) ? "PASS" : "FAIL", fails);
+    return fails;
+}
+
+#endif /* TEST_CHECK_H */
@@ -0,0 +1,176 @@
+"""
+@file can_flash.py
+@brief CAN flasher for the steering wheel bootloader (drivers/bootloader.c).
+
+@details
+Downloads an application image (raw binary linked at 0x4000, e.g. from
+`arm-none-eabi-objcopy -O binary SW_S32K118.elf app.bin` with the
+S32K118_25_flash_app.ld configuration) over UDS on ISO-TP:
+
+    10 02            programming session (the application resets into the bootloader)
+    3E 00            repeated until the bootloader answers
+    34 00 44 ...     RequestDownload (address, size)
+    36 seq block     TransferData, one 2 KB block each
+    37 crc32         RequestTransferExit (CRC-32 of the image, zlib)
+    11 01            ECUReset: start the new application
+
+and prints the time of each phase and the download throughput:
+
+    F1_CAN_IF=vbus:default python3 tools/can_flash.py app.bin
+    F1_CAN_IF=vbus:default python3 tools/can_flash.py --random 227328
+
+With --layout, a dashboard layout blob (tools/layout2c.py, drivers/layout.h)
+is downloaded to the running application instead, with the same 34/36/37
+services at the layout slot address: no session change and no reset, the
+wheel shows the new layout as soon as it is complete.
+
+    F1_CAN_IF=vbus:default python3 tools/can_flash.py --layout build/dash_layout.bin
+
+@note Standard library only with the virtual bus; python-can for SocketCAN.
+"""
+
+import argparse
+import os
+import sys
+import time
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from isotp_peer import IsoTpPeer, IsoTpError, open_bus  # noqa: E402
+
+APP_BASE = 0x4000
+LAYOUT_BASE = 0x3B800               # Application data sectors (bootloader.h BOOT_DATA_ADDR)
+LAYOUT_MAX = 0x3F800 - LAYOUT_BASE
+APP_MAX = LAYOUT_BASE - APP_BASE
+
+NRC_NAMES = {
+    0x11: "serviceNotSupported", 0x12: "subFunctionNotSupported",
+    0x13: "incorrectMessageLength", 0x22: "conditionsNotCorrect",
+    0x24: "requestSequenceError", 0x31: "requestOutOfRange",
+    0x72: "generalProgrammingFailure", 0x73: "wrongBlockSequenceCounter",
+}
+
+
+class FlashError(Exception):
+    pass
+
+
+class Flasher:
+    def __init__(self, peer):
+        self.peer = peer
+
+    def request(self, req, timeout=1.0):
+        """Sends one request and returns its positive response."""
+        self.peer.send(bytes(req))
+        end = time.monotonic() + timeout
+        while True:
+            left = end - time.monotonic()
+            if left <= 0:
+                raise FlashError("no response to %02X" % req[0])
+            try:
+                rsp = self.peer.receive(left)
+            except IsoTpError:
+                continue
+            if len(rsp) >= 3 and rsp[0] == 0x7F and rsp[1] == req[0]:
+                raise FlashError("%02X refused: NRC %02X (%s)" % (
+                    req[0], rsp[2], NRC_NAMES.get(rsp[2], "?")))
+            if rsp and rsp[0] == req[0] + 0x40:
+                return rsp
+            # Anything else (the application's loopback, a late answer) is skipped
+
+    def enter_bootloader(self, timeout):
+        """Programming session, then tester present until the bootloader answers."""
+        try:
+            self.request([0x10, 0x02], timeout=0.5)
+        except FlashError:
+            pass    # Wheel already in the bootloader and busy, or still starting
+        end = time.monotonic() + timeout
+        while time.monotonic() < end:
+            try:
+                self.request([0x3E, 0x00], timeout=0.1)
+                self.request([0x10, 0x02], timeout=0.5)
+                return
+            except FlashError:
+                time.sleep(0.05)
+        raise FlashError("bootloader not reached within %.1f s" % timeout)
+
+    def download(self, image, base=APP_BASE):
+        size = len(image)
+        rsp = self.request([0x34, 0x00, 0x44] + list(base.to_bytes(4, "big")) +
+                           list(size.to_bytes(4, "big")), timeout=1.0)
+        block = int.from_bytes(rsp[2:4], "big") - 2
+        seq = 1
+        for pos in range(0, size, block):
+            rsp = self.request([0x36, seq] + list(image[pos:pos + block]), timeout=2.0)
+            if rsp[1] != seq:
+                raise FlashError("block %d acknowledged as %d" % (seq, rsp[1]))
+            seq = (seq + 1) & 0xFF
+            done = min(pos + block, size)
+            if seq % 16 == 0 or done == size:
+                print("\r  %6d / %d bytes" % (done, size), end="", flush=True)
+        print()
+        self.request([0x37] + list(zlib.crc32(image).to_bytes(4, "big")), timeout=5.0)
+
+
+def layout(blob):
+    if not 0 < len(blob) <= LAYOUT_MAX:
+        sys.exit("layout size %d out of range (1..%d)" % (len(blob), LAYOUT_MAX))
+    bus = open_bus()
+    flasher = Flasher(IsoTpPeer(bus))
+    try:
+        t0 = time.monotonic()
+        flasher.download(blob, LAYOUT_BASE)
+        t1 = time.monotonic()
+    except (FlashError, IsoTpError) as e:
+        sys.exit("layout download failed: %s" % e)
+    finally:
+        bus.shutdown()
+    print("layout %d B in %.2f s  CRC %08X" % (len(blob), t1 - t0, zlib.crc32(blob)))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Flash the steering wheel application over CAN")
+    ap.add_argument("image", nargs="?", help="raw binary image, linked at 0x4000")
+    ap.add_argument("--random", type=int, metavar="BYTES", help="flash random data instead (test)")
+    ap.add_argument("--layout", metavar="BLOB", help="download a dashboard layout to the running application")
+    ap.add_argument("--no-reset", action="store_true", help="stay in the bootloader afterwards")
+    ap.add_argument("--wait", type=float, default=10.0, help="seconds to wait for the bootloader")
+    args = ap.parse_args()
+
+    if args.layout:
+        with open(args.layout, "rb") as f:
+            layout(f.read())
+        return
+    if args.random is not None:
+        image = os.urandom(args.random)
+    elif args.image:
+        with open(args.image, "rb") as f:
+            image = f.read()
+    else:
+        ap.error("an image or --random is required")
+    if not 0 < len(image) <= APP_MAX:
+        sys.exit("image size %d out of range (1..%d)" % (len(image), APP_MAX))
+
+    bus = open_bus()
+    flasher = Flasher(IsoTpPeer(bus))
+    try:
+        t0 = time.monotonic()
+        flasher.enter_bootloader(args.wait)
+        t1 = time.monotonic()
+        flasher.download(image)
+        t2 = time.monotonic()
+        if not args.no_reset:
+            flasher.request([0x11, 0x01], timeout=1.0)
+        t3 = time.monotonic()
+    except (FlashError, IsoTpError) as e:
+        sys.exit("flash failed: %s" % e)
+    finally:
+        bus.shutdown()
+
+    print("entry %.2f s  download %d B in %.2f s (%.1f kB/s)  reset %.2f s  total %.2f s  CRC %08X" % (
+        t1 - t0, len(image), t2 - t1, len(image) / (t2 - t1) / 1e3, t3 - t2, t3 - t0,
+        zlib.crc32(image)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,263 @@
+#!/usr/bin/env python3
+"""
+@file dbc2c.py
+@brief Generates C pack/unpack code from the CAN database (steering_wheel.dbc).
+
+@details
+Reads the `BO_` / `SG_` definitions of a DBC file and writes a header-only C
+module with, for every message:
+
+- `DBC_<MSG>_ID` / `DBC_<MSG>_DLC` constants,
+- a struct holding the raw (unscaled) signal values,
+- `dbc_pack_<Msg>()` / `dbc_unpack_<Msg>()` static inline functions,
+- `DBC_<MSG>_<SIG>_FACTOR` / `_OFFSET` macros to convert raw values to
+  physical units (physical = raw * FACTOR + OFFSET),
+- `DBC_<MSG>_IDX`, the position of the message in the database,
+
+plus `dbc_message_index()`, a collision-free (perfect) hash from CAN ID to
+message index computed at generation time, so receive dispatch costs one
+multiply, one shift and one compare whatever the number of messages, and its
+inverse `dbc_message_id()`, from which the receive filters of a node are built.
+
+Only the features used by the project DBC are supported: standard IDs,
+Intel (@1) byte order, unsigned and signed (+/-) integer signals up to 32 bits.
+The generated header is committed (drivers/steering_wheel_dbc.h) so the
+firmware build does not depend on Python; regenerate it after editing the DBC:
+
+    python3 tools/dbc2c.py drivers/steering_wheel.dbc drivers/steering_wheel_dbc.h
+
+@note Standard library only.
+"""
+
+import os
+import re
+import sys
+
+BO_RE = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)")
+SG_RE = re.compile(
+    r"^SG_\s+(\w+)\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*"
+    r"\(\s*([-+0-9.eE]+)\s*,\s*([-+0-9.eE]+)\s*\)\s*"
+    r"\[\s*([-+0-9.eE]+)\s*\|\s*([-+0-9.eE]+)\s*\]\s*\"([^\"]*)\"\s*(.*)$")
+
+
+class Signal:
+    def __init__(self, name, start, length, intel, signed, factor, offset, vmin, vmax, unit):
+        self.name, self.start, self.length = name, start, length
+        self.intel, self.signed = intel, signed
+        self.factor, self.offset = factor, offset
+        self.vmin, self.vmax, self.unit = vmin, vmax, unit
+
+    def ctype(self):
+        bits = 8 if self.length <= 8 else 16 if self.length <= 16 else 32
+        return ("int%d_t" if self.signed else "uint%d_t") % bits
+
+
+class Message:
+    def __init__(self, frame_id, name, dlc, sender):
+        self.id, self.name, self.dlc, self.sender = frame_id, name, dlc, sender
+        self.signals = []
+
+
+def parse_dbc(path):
+    messages = []
+    with open(path, encoding="utf-8") as f:
+        for raw in f:
+            line = raw.split("//")[0].strip()
+            m = BO_RE.match(line)
+            if m:
+                messages.append(Message(int(m.group(1)), m.group(2), int(m.group(3)), m.group(4)))
+                continue
+            s = SG_RE.match(line)
+            if s and messages:
+                sig = Signal(s.group(1), int(s.group(2)), int(s.group(3)), s.group(4) == "1",
+                             s.group(5) == "-", float(s.group(6)), float(s.group(7)),
+                             float(s.group(8)), float(s.group(9)), s.group(10))
+                if not sig.intel:
+                    sys.exit("dbc2c: %s.%s uses Motorola byte order (not supported)"
+                             % (messages[-1].name, sig.name))
+                if sig.length > 32 or sig.start + sig.length > messages[-1].dlc * 8:
+                    sys.exit("dbc2c: %s.%s does not fit the message" % (messages[-1].name, sig.name))
+                messages[-1].signals.append(sig)
+    return messages
+
+
+def c_float(v):
+    text = repr(float(v))
+    return text + "f"
+
+
+def gen_pack(msg, sig):
+    """Statements OR-ing one signal into d[] (Intel byte order)."""
+    out = []
+    mask = (1 << sig.length) - 1
+    out.append("    raw = (uint32_t)m->%s & 0x%Xu;" % (sig.name, mask))
+    bit, remaining, shift = sig.start, sig.length, 0
+    while remaining > 0:
+        byte, pos = bit // 8, bit % 8
+        n = min(8 - pos, remaining)
+        out.append("    d[%d] |= (uint8_t)(((raw >> %d) & 0x%Xu) << %d);" % (byte, shift, (1 << n) - 1, pos))
+        bit, remaining, shift = bit + n, remaining - n, shift + n
+    return out
+
+
+def gen_unpack(msg, sig):
+    out = []
+    parts = []
+    bit, remaining, shift = sig.start, sig.length, 0
+    while remaining > 0:
+        byte, pos = bit // 8, bit % 8
+        n = min(8 - pos, remaining)
+        parts.append("((uint32_t)((d[%d] >> %d) & 0x%Xu) << %d)" % (byte, pos, (1 << n) - 1, shift))
+        bit, remaining, shift = bit + n, remaining - n, shift + n
+    out.append("    raw = %s;" % "\n        | ".join(parts))
+    if sig.signed and sig.length < 32:
+        out.append("    if (raw & 0x%Xu) raw |= 0x%Xu; /* sign extension */"
+                   % (1 << (sig.length - 1), (0xFFFFFFFF << sig.length) & 0xFFFFFFFF))
+    out.append("    m->%s = (%s)raw;" % (sig.name, sig.ctype()))
+    return out
+
+
+def find_perfect_hash(ids):
+    """Smallest power-of-two table and (mul, shift) so that
+    ((id * mul) mod 2^32) >> shift) & (size - 1) is distinct for every ID."""
+    size = 1
+    while size < len(ids):
+        size *= 2
+    while size <= 256:
+        for mul in range(1, 1 << 16, 2):
+            for shift in range(0, 32):
+                slots = {(((i * mul) & 0xFFFFFFFF) >> shift) & (size - 1) for i in ids}
+                if len(slots) == len(ids):
+                    return size, mul, shift
+        size *= 2
+    sys.exit("dbc2c: no perfect hash found for %d IDs" % len(ids))
+
+
+def gen_dispatch(messages):
+    L = []
+    ids = [m.id for m in messages]
+    if len(set(ids)) != len(ids):
+        sys.exit("dbc2c: duplicate message IDs")
+    size, mul, shift = find_perfect_hash(ids)
+    table = [None] * size
+    for idx, m in enumerate(messages):
+        table[(((m.id * mul) & 0xFFFFFFFF) >> shift) & (size - 1)] = (m.id, idx, m.name)
+    L.append("")
+    L.append("/*--------------------------Receive dispatch (perfect hash)--------------------------*/")
+    L.append("")
+    L.append("#define DBC_HASH_SIZE   %-8s /**< Slots of the ID hash table (power of two). */" % ("%du" % size))
+    L.append("#define DBC_HASH_MUL    %-8s /**< Hash multiplier. */" % ("0x%04Xu" % mul))
+    L.append("#define DBC_HASH_SHIFT  %-8s /**< Hash shift. */" % ("%du" % shift))
+    L.append("#define DBC_NO_MESSAGE  %-8s /**< Index returned for IDs not in the database. */" % "0xFFu")
+    L.append("")
+    L.append("/** @brief Hash slot -> { CAN ID, message index }; empty slots hold an invalid ID. */")
+    L.append("static const struct { uint16_t id; uint8_t idx; } dbc_hash_table[DBC_HASH_SIZE] = {")
+    for slot, entry in enumerate(table):
+        if entry is None:
+            L.append("    { 0xFFFFu, DBC_NO_MESSAGE },  /* %d: empty */" % slot)
+        else:
+            L.append("    { 0x%03Xu, %du },  /* %d: %s */" % (entry[0], entry[1], slot, entry[2]))
+    L.append("};")
+    L.append("")
+    L.append("/**")
+    L.append(" * @brief Maps a standard CAN ID to its message index (DBC_<MSG>_IDX) in constant time.")
+    L.append(" * @return Message index, or ::DBC_NO_MESSAGE if the ID is not in the database.")
+    L.append(" */")
+    L.append("static inline uint8_t dbc_message_index(uint32_t id)")
+    L.append("{")
+    L.append("    uint32_t slot = ((id * DBC_HASH_MUL) >> DBC_HASH_SHIFT) & (DBC_HASH_SIZE - 1u);")
+    L.append("    return (dbc_hash_table[slot].id == id) ? dbc_hash_table[slot].idx : DBC_NO_MESSAGE;")
+    L.append("}")
+    L.append("")
+    L.append("/** @brief Message index -> CAN ID (acceptance filters built from a table indexed by DBC_<MSG>_IDX). */")
+    L.append("static const uint16_t dbc_message_ids[DBC_MESSAGE_COUNT] = {")
+    for idx, m in enumerate(messages):
+        L.append("    0x%03Xu,  /* %d: %s */" % (m.id, idx, m.name))
+    L.append("};")
+    L.append("")
+    L.append("/** @brief Returns the CAN ID of a message index (DBC_<MSG>_IDX, below ::DBC_MESSAGE_COUNT). */")
+    L.append("static inline uint32_t dbc_message_id(uint8_t idx)")
+    L.append("{")
+    L.append("    return dbc_message_ids[idx];")
+    L.append("}")
+    return L
+
+
+def generate(messages, dbc_name, guard):
+    L = []
+    L.append("/**")
+    L.append(" * @file %s" % OUT_NAME)
+    L.append(" * @brief CAN message definitions generated from %s." % dbc_name)
+    L.append(" *")
+    L.append(" * @details")
+    L.append(" * GENERATED FILE - DO NOT EDIT. Regenerate with:")
+    L.append(" *     python3 tools/dbc2c.py drivers/%s drivers/%s" % (dbc_name, OUT_NAME))
+    L.append(" *")
+    L.append(" * Structs hold raw signal values; convert to physical units with")
+    L.append(" * physical = raw * <SIGNAL>_FACTOR + <SIGNAL>_OFFSET.")
+    L.append(" */")
+    L.append("")
+    L.append("#ifndef %s" % guard)
+    L.append("#define %s" % guard)
+    L.append("")
+    L.append("#include <stdint.h>")
+    L.append("#include <string.h>")
+    L.append("")
+    L.append("#define DBC_MESSAGE_COUNT  %du  /**< Number of messages in the database. */" % len(messages))
+    for idx, msg in enumerate(messages):
+        up = msg.name.upper()
+        L.append("")
+        L.append("/*--------------------------%s (0x%03X, sender %s)--------------------------*/"
+                 % (msg.name, msg.id, msg.sender))
+        L.append("")
+        L.append("#define DBC_%s_ID   0x%03Xu" % (up, msg.id))
+        L.append("#define DBC_%s_DLC  %du" % (up, msg.dlc))
+        L.append("#define DBC_%s_IDX  %du" % (up, idx))
+        for sig in msg.signals:
+            if sig.factor != 1.0 or sig.offset != 0.0:
+                L.append("#define DBC_%s_%s_FACTOR  %s" % (up, sig.name.upper(), c_float(sig.factor)))
+                L.append("#define DBC_%s_%s_OFFSET  %s" % (up, sig.name.upper(), c_float(sig.offset)))
+        L.append("")
+        L.append("/** @brief Raw signal values of %s. */" % msg.name)
+        L.append("typedef struct {")
+        for sig in msg.signals:
+            unit = (" [%s]" % sig.unit) if sig.unit else ""
+            L.append("    %-9s %s; /**< bits %d..%d, %s%s */" % (
+                sig.ctype(), sig.name, sig.start, sig.start + sig.length - 1,
+                "signed" if sig.signed else "unsigned", unit))
+        L.append("} dbc_%s_t;" % msg.name)
+        L.append("")
+        L.append("/** @brief Encodes %s into an %d-byte payload. */" % (msg.name, msg.dlc))
+        L.append("static inline void dbc_pack_%s(uint8_t d[%d], const dbc_%s_t* m)"
+                 % (msg.name, msg.dlc, msg.name))
+        L.append("{")
+        L.append("    uint32_t raw;")
+        L.append("    memset(d, 0, %d);" % msg.dlc)
+        for sig in msg.signals:
+            L.extend(gen_pack(msg, sig))
+        L.append("}")
+        L.append("")
+        L.append("/** @brief Decodes an %d-byte payload into %s. */" % (msg.dlc, msg.name))
+        L.append("static inline void dbc_unpack_%s(dbc_%s_t* m, const uint8_t d[%d])"
+                 % (msg.name, msg.name, msg.dlc))
+        L.append("{")
+        L.append("    uint32_t raw;")
+        for sig in msg.signals:
+            L.extend(gen_unpack(msg, sig))
+        L.append("}")
+    L.extend(gen_dispatch(messages))
+    L.append("")
+    L.append("#endif /* %s */" % guard)
+    L.append("")
+    return "\n".join(L)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit("usage: dbc2c.py <input.dbc> <output.h>")
+    OUT_NAME = os.path.basename(sys.argv[2])
+    guard = re.sub(r"\W", "_", OUT_NAME).upper()
+    msgs = parse_dbc(sys.argv[1])
+    with open(sys.argv[2], "w", encoding="utf-8", newline="\n") as f:
+        f.write(generate(msgs, os.path.basename(sys.argv[1]), guard))
+    print("dbc2c: %d messages -> %s" % (len(msgs), sys.argv[2]))
@@ -0,0 +1,422 @@
+/**
+ * @file ecu_load.c
+ * @brief Native ECU stand-in and CAN load generator for stress testing the firmware.
+ *
+ * @details
+ * Replaces `ecu_sim.py` when the bus must be loaded realistically. It uses the
+ * host CAN HAL (SocketCAN `vcan0`/`can0` or the user-space `vbus:<name>`) and
+ * the definitions generated from the DBC (`drivers/steering_wheel_dbc.h`).
+ *
+ * Behaviour:
+ * - Decodes `SteeringWheel_Status` and applies the same gear / DRS / pit limiter
+ *   logic as `ecu_sim.py` (gear step on every change of Button_UP / Button_DOWN,
+ *   DRS and pit limiter toggled on rising edges).
+ * - Transmits `ECU_Status_Display` at a fixed rate and immediately after every
+ *   wheel frame that changes the state.
+ * - Transmits background traffic (random IDs in a range, 8-byte payload) at any
+ *   rate up to bus saturation, with optional period jitter and on/off bursts.
+ * - Logs the wheel's response: interval between `SteeringWheel_Status` frames
+ *   (min / avg / max, late frames) and the reaction time from a wheel event to
+ *   the ECU reply. Prints a summary every second and at exit.
+ *
+ * Build: `make ecu_load` (output in build/host_pc/<CONFIG>/bin/ecu_load).
+ *
+ * Example: 20 Hz status, 4000 frames/s background with 200 µs jitter and
+ * 100 ms bursts at 3x every second, on the user-space bus:
+ * @code
+ *   ecu_load -i vbus:default -s 20 -b 4000 -j 200 -p 100:900:3
+ * @endcode
+ */
+
+#define _GNU_SOURCE // clock_gettime, nanosleep, getopt with -std=c11
+
+#include "hal_can.h"
+#include "steering_wheel_dbc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+/* --- Defaults --- */
+#define DEFAULT_STATUS_HZ     20.0      /**< Same cadence as ecu_sim.py (50 ms). */
+#define DEFAULT_BG_ID_LO      0x300u
+#define DEFAULT_BG_ID_HI      0x6FFu
+#define WHEEL_PERIOD_MS       200u      /**< Wheel keep-alive period (app_main CAN_PERIOD_MS). */
+#define WHEEL_LATE_FACTOR     1.5       /**< Interval above factor * period counts as late. */
+#define TX_BATCH_MAX          32u       /**< Frames submitted per HAL call. */
+#define REPORT_PERIOD_US      1000000u
+
+/* --- Configuration (command line) --- */
+typedef struct {
+    const char* interface;
+    double   status_hz;
+    double   bg_rate;          /**< Background frames/s, 0 = off. */
+    bool     bg_saturate;      /**< Keep the TX path full (bus saturation). */
+    uint32_t bg_id_lo, bg_id_hi;
+    uint32_t jitter_us;        /**< Uniform ±jitter applied to every period. */
+    uint32_t burst_on_ms, burst_off_ms;
+    double   burst_mult;       /**< Background rate multiplier inside a burst. */
+    double   duration_s;       /**< 0 = run until Ctrl+C. */
+    bool     quiet;
+} load_cfg_t;
+
+/* --- Statistics --- */
+typedef struct {
+    uint64_t status_tx, status_tx_fail;
+    uint64_t bg_tx, bg_tx_fail;
+    uint64_t wheel_rx, other_rx;
+    uint64_t wheel_late;
+    uint64_t itv_min_us, itv_max_us, itv_sum_us, itv_n;
+    uint64_t react_max_us, react_sum_us, react_n;
+} load_stats_t;
+
+/* --- ECU model state (same logic as ecu_sim.py) --- */
+typedef struct {
+    uint8_t gear;
+    uint8_t pit_active;
+    uint8_t drs_status;
+    uint8_t prev_buttons;
+    uint8_t clutch, rotary;
+    double  temp1, temp2, target1, target2;
+} ecu_model_t;
+
+static volatile sig_atomic_t running = 1;
+
+static void on_sigint(int sig) { (void)sig; running = 0; }
+
+static uint64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static double frand(double lo, double hi) { return lo + (hi - lo) * ((double)rand() / RAND_MAX); }
+
+/** Period in µs for a rate, with uniform ±jitter. */
+static uint64_t next_period_us(double rate_hz, uint32_t jitter_us)
+{
+    double p = 1e6 / rate_hz;
+    if (jitter_us > 0) p += frand(-(double)jitter_us, (double)jitter_us);
+    return (p < 1.0) ? 1u : (uint64_t)p;
+}
+
+/* ------------------------------------------------------------------ */
+/* ECU model                                                            */
+/* ------------------------------------------------------------------ */
+
+/** Applies a wheel frame; returns true when the ECU state changed. */
+static bool ecu_apply_wheel(ecu_model_t* ecu, const dbc_SteeringWheel_Status_t* w)
+{
+    uint8_t buttons = (uint8_t)((w->Button_UP << 0) | (w->Button_DOWN << 1) |
+                                (w->Button_DRS << 2) | (w->Button_PitLimiter << 3));
+    uint8_t rising  = buttons & (uint8_t)~ecu->prev_buttons;
+    uint8_t changes = buttons ^ ecu->prev_buttons;
+    bool changed = (changes != 0) || (w->ClutchValue != ecu->clutch) || (w->RotaryPosition != ecu->rotary);
+
+    if ((changes & 0x01) && ecu->gear < 9) ecu->gear++;   /* Button_UP   */
+    if ((changes & 0x02) && ecu->gear > 0) ecu->gear--;   /* Button_DOWN */
+    if (rising & 0x08) ecu->pit_active ^= 1;              /* Pit limiter */
+    if (rising & 0x04) ecu->drs_status ^= 1;              /* DRS         */
+
+    ecu->prev_buttons = buttons;
+    ecu->clutch = w->ClutchValue;
+    ecu->rotary = w->RotaryPosition;
+    return changed;
+}
+
+/** Slow temperature dynamics, called once per status frame. */
+static void ecu_step_temps(ecu_model_t* ecu, uint64_t frame_no, double status_hz)
+{
+    uint64_t retarget = (uint64_t)(status_hz > 1.0 ? status_hz : 1.0);   /* about once per second */
+    if (frame_no % retarget == 0) {
+        ecu->target1 = frand(-10.0, 15.0);
+        ecu->target2 = frand(110.0, 145.0);
+    }
+    ecu->temp1 += (ecu->target1 - ecu->temp1) * 0.05 + frand(-0.05, 0.05);
+    ecu->temp2 += (ecu->target2 - ecu->temp2) * 0.05 + frand(-0.05, 0.05);
+}
+
+static uint16_t temp_to_raw(double t)
+{
+    double raw = (t - DBC_ECU_STATUS_DISPLAY_TEMP1_OFFSET) / DBC_ECU_STATUS_DISPLAY_TEMP1_FACTOR;
+    if (raw < 0.0) raw = 0.0;
+    if (raw > 65535.0) raw = 65535.0;
+    return (uint16_t)(raw + 0.5);
+}
+
+static int ecu_send_status(const ecu_model_t* ecu, load_stats_t* st)
+{
+    dbc_ECU_Status_Display_t m;
+    hal_can_frame_t f;
+
+    memset(&m, 0, sizeof(m));
+    m.Temp1             = temp_to_raw(ecu->temp1);
+    m.Temp2             = temp_to_raw(ecu->temp2);
+    m.PitLimiter_Active = ecu->pit_active;
+    m.DRS_Status        = ecu->drs_status;
+    m.LED2_PitLimiter   = ecu->pit_active;
+    m.LED1_Temperature  = (ecu->temp2 > 130.0) ? 1 : 0;
+    m.Gear_Actual       = ecu->gear;
+    m.Clutch_Feedback   = ecu->clutch;
+    m.Rotary_Feedback   = ecu->rotary;
+
+    f.id = DBC_ECU_STATUS_DISPLAY_ID;
+    f.len = DBC_ECU_STATUS_DISPLAY_DLC;
+    f.timestamp_us = 0;
+    dbc_pack_ECU_Status_Display(f.data, &m);
+
+    if (hal_can_send_frames(&f, 1) == 1) { st->status_tx++; return 1; }
+    st->status_tx_fail++;
+    return 0;
+}
+
+/* ------------------------------------------------------------------ */
+/* Background traffic                                                   */
+/* ------------------------------------------------------------------ */
+
+static void bg_fill(hal_can_frame_t* f, const load_cfg_t* cfg, uint32_t counter)
+{
+    uint32_t span = cfg->bg_id_hi - cfg->bg_id_lo + 1u;
+    f->id = cfg->bg_id_lo + (uint32_t)rand() % span;
+    /* Never impersonate the two application messages */
+    if (f->id == DBC_STEERINGWHEEL_STATUS_ID || f->id == DBC_ECU_STATUS_DISPLAY_ID) f->id = cfg->bg_id_lo;
+    f->len = 8;
+    f->timestamp_us = 0;
+    memcpy(f->data, &counter, sizeof(counter));
+    f->data[4] = 0xA5; f->data[5] = 0x5A; f->data[6] = 0xA5; f->data[7] = 0x5A;
+}
+
+static bool in_burst(const load_cfg_t* cfg, uint64_t t_us, uint64_t t0_us)
+{
+    uint64_t cycle = (uint64_t)(cfg->burst_on_ms + cfg->burst_off_ms) * 1000u;
+    if (cfg->burst_on_ms == 0 || cycle == 0) return false;
+    return ((t_us - t0_us) % cycle) < (uint64_t)cfg->burst_on_ms * 1000u;
+}
+
+/* ------------------------------------------------------------------ */
+/* Reporting                                                            */
+/* ------------------------------------------------------------------ */
+
+static void report(const load_stats_t* st, double elapsed_s, const char* tag)
+{
+    printf("[%s] t=%.1fs  status_tx=%llu (fail %llu)  bg_tx=%llu (fail %llu, %.0f/s)  "
+           "wheel_rx=%llu late=%llu  itv min/avg/max=%.1f/%.1f/%.1f ms  react avg/max=%.0f/%.0f us\n",
+           tag, elapsed_s,
+           (unsigned long long)st->status_tx, (unsigned long long)st->status_tx_fail,
+           (unsigned long long)st->bg_tx, (unsigned long long)st->bg_tx_fail,
+           elapsed_s > 0 ? (double)st->bg_tx / elapsed_s : 0.0,
+           (unsigned long long)st->wheel_rx, (unsigned long long)st->wheel_late,
+           st->itv_n ? st->itv_min_us / 1000.0 : 0.0,
+           st->itv_n ? (double)st->itv_sum_us / st->itv_n / 1000.0 : 0.0,
+           st->itv_max_us / 1000.0,
+           st->react_n ? (double)st->react_sum_us / st->react_n : 0.0,
+           (double)st->react_max_us);
+    fflush(stdout);
+}
+
+static void usage(const char* prog)
+{
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  -i IF        CAN interface (vcan0, can0, vbus:<name>; default $F1_CAN_IF or vcan0)\n"
+        "  -s HZ        ECU_Status_Display rate (default %.0f)\n"
+        "  -b RATE      background frames/s, or 'max' to saturate the bus (default 0)\n"
+        "  -n LO-HI     background ID range, hex (default %03X-%03X)\n"
+        "  -j US        period jitter, uniform +/-US microseconds (default 0)\n"
+        "  -p ON:OFF:M  burst profile: ON ms at M x background rate every ON+OFF ms\n"
+        "  -t SEC       run time in seconds (default: until Ctrl+C)\n"
+        "  -q           quiet (summary only)\n",
+        prog, DEFAULT_STATUS_HZ, DEFAULT_BG_ID_LO, DEFAULT_BG_ID_HI);
+}
+
+static int parse_args(int argc, char** argv, load_cfg_t* cfg)
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "i:s:b:n:j:p:t:qh")) != -1) {
+        switch (opt) {
+        case 'i': cfg->interface = optarg; break;
+        case 's': cfg->status_hz = atof(optarg); break;
+        case 'b':
+            if (strcmp(optarg, "max") == 0) cfg->bg_saturate = true;
+            else cfg->bg_rate = atof(optarg);
+            break;
+        case 'n':
+            if (sscanf(optarg, "%x-%x", &cfg->bg_id_lo, &cfg->bg_id_hi) != 2 ||
+                cfg->bg_id_lo > cfg->bg_id_hi || cfg->bg_id_hi > 0x7FFu) return -1;
+            break;
+        case 'j': cfg->jitter_us = (uint32_t)strtoul(optarg, NULL, 10); break;
+        case 'p':
+            if (sscanf(optarg, "%u:%u:%lf", &cfg->burst_on_ms, &cfg->burst_off_ms, &cfg->burst_mult) != 3) return -1;
+            break;
+        case 't': cfg->duration_s = atof(optarg); break;
+        case 'q': cfg->quiet = true; break;
+        default: return -1;
+        }
+    }
+    if (cfg->status_hz <= 0.0) return -1;
+    return 0;
+}
+
+/* ------------------------------------------------------------------ */
+/* Main loop                                                            */
+/* ------------------------------------------------------------------ */
+
+int main(int argc, char** argv)
+{
+    load_cfg_t cfg = {
+        .interface = getenv("F1_CAN_IF") ? getenv("F1_CAN_IF") : "vcan0",
+        .status_hz = DEFAULT_STATUS_HZ,
+        .bg_id_lo = DEFAULT_BG_ID_LO, .bg_id_hi = DEFAULT_BG_ID_HI,
+        .burst_mult = 1.0,
+    };
+    load_stats_t st;
+    ecu_model_t ecu;
+
+    if (parse_args(argc, argv, &cfg) < 0) { usage(argv[0]); return 2; }
+
+    /* The command line wins over F1_CAN_IF inside the HAL */
+    unsetenv("F1_CAN_IF");
+    if (hal_can_init(cfg.interface) < 0) return 1;
+    static const hal_can_filter_t filters[] = {
+        { DBC_STEERINGWHEEL_STATUS_ID,  HAL_CAN_STD_MASK },
+        { DBC_STEERINGWHEEL_CANDIAG_ID, HAL_CAN_STD_MASK },
+    };
+    hal_can_set_filters(filters, 2);
+
+    signal(SIGINT, on_sigint);
+    signal(SIGTERM, on_sigint);
+    srand((unsigned)now_us());
+
+    memset(&st, 0, sizeof(st));
+    st.itv_min_us = UINT64_MAX;
+    memset(&ecu, 0, sizeof(ecu));
+    ecu.temp1 = ecu.target1 = frand(-10.0, 10.0);
+    ecu.temp2 = ecu.target2 = frand(110.0, 130.0);
+
+    const uint64_t t0 = now_us();
+    uint64_t next_status = t0;
+    uint64_t next_bg     = t0;
+    uint64_t next_report = t0 + REPORT_PERIOD_US;
+    uint64_t last_wheel  = 0;
+    uint64_t status_no   = 0;
+    uint32_t bg_counter  = 0;
+
+    printf("[ECU_LOAD] if=%s status=%.1f Hz bg=%s%.0f/s ids=%03X-%03X jitter=%u us burst=%u:%u:%.1f\n",
+           cfg.interface, cfg.status_hz, cfg.bg_saturate ? "max " : "", cfg.bg_rate,
+           cfg.bg_id_lo, cfg.bg_id_hi, cfg.jitter_us, cfg.burst_on_ms, cfg.burst_off_ms, cfg.burst_mult);
+
+    while (running) {
+        uint64_t t = now_us();
+
+        /* --- RX: wheel frames --- */
+        hal_can_frame_t rx;
+        while (hal_can_receive_frame(&rx) > 0) {
+            if (rx.id == DBC_STEERINGWHEEL_CANDIAG_ID) {
+                /* Wheel-side view of the bus (1 Hz) */
+                dbc_SteeringWheel_CanDiag_t d;
+                dbc_unpack_SteeringWheel_CanDiag(&d, rx.data);
+                if (!cfg.quiet) {
+                    printf("[DIAG] wheel: state=%s tec=%u rec=%u load=%.1f%% overruns=%u retries=%u bus_off=%u\n",
+                           d.ErrState == 0 ? "active" : d.ErrState == 1 ? "passive" : "bus-off",
+                           d.TxErrCount, d.RxErrCount, d.BusLoad * DBC_STEERINGWHEEL_CANDIAG_BUSLOAD_FACTOR,
+                           d.RxOverruns, d.TxRetries, d.BusOffCount);
+                }
+                continue;
+            }
+            if (rx.id != DBC_STEERINGWHEEL_STATUS_ID) { st.other_rx++; continue; }
+
+            uint64_t t_rx = now_us();
+            if (last_wheel != 0) {
+                uint64_t itv = t_rx - last_wheel;
+                if (itv < st.itv_min_us) st.itv_min_us = itv;
+                if (itv > st.itv_max_us) st.itv_max_us = itv;
+                st.itv_sum_us += itv;
+                st.itv_n++;
+                if (itv > (uint64_t)(WHEEL_PERIOD_MS * 1000u * WHEEL_LATE_FACTOR)) st.wheel_late++;
+            }
+            last_wheel = t_rx;
+            st.wheel_rx++;
+
+            dbc_SteeringWheel_Status_t w;
+            dbc_unpack_SteeringWheel_Status(&w, rx.data);
+            if (ecu_apply_wheel(&ecu, &w)) {
+                /* Event: answer immediately and measure the reaction time */
+                if (ecu_send_status(&ecu, &st)) {
+                    uint64_t react = now_us() - t_rx;
+                    if (react > st.react_max_us) st.react_max_us = react;
+                    st.react_sum_us += react;
+                    st.react_n++;
+                }
+                if (!cfg.quiet) {
+                    printf("[WHEEL] btn=%u%u%u%u rot=%u clutch=%u -> gear=%u drs=%u pit=%u\n",
+                           w.Button_UP, w.Button_DOWN, w.Button_DRS, w.Button_PitLimiter,
+                           w.RotaryPosition, w.ClutchValue, ecu.gear, ecu.drs_status, ecu.pit_active);
+                }
+            }
+        }
+
+        /* --- Periodic ECU_Status_Display --- */
+        if (t >= next_status) {
+            ecu_step_temps(&ecu, status_no++, cfg.status_hz);
+            ecu_send_status(&ecu, &st);
+            next_status += next_period_us(cfg.status_hz, cfg.jitter_us);
+            if (next_status < t) next_status = t;   /* We fell behind: do not burst-catch-up */
+        }
+
+        /* --- Background traffic --- */
+        if (cfg.bg_saturate) {
+            hal_can_frame_t batch[TX_BATCH_MAX];
+            for (uint32_t i = 0; i < TX_BATCH_MAX; i++) bg_fill(&batch[i], &cfg, bg_counter + i);
+            int sent = hal_can_send_frames(batch, TX_BATCH_MAX);
+            if (sent > 0) { st.bg_tx += (uint64_t)sent; bg_counter += (uint32_t)sent; }
+        } else if (cfg.bg_rate > 0.0) {
+            double rate = cfg.bg_rate * (in_burst(&cfg, t, t0) ? cfg.burst_mult : 1.0);
+            hal_can_frame_t batch[TX_BATCH_MAX];
+            uint8_t n = 0;
+            while (t >= next_bg && n < TX_BATCH_MAX) {
+                bg_fill(&batch[n], &cfg, bg_counter++);
+                n++;
+                next_bg += next_period_us(rate, cfg.jitter_us);
+            }
+            if (n > 0) {
+                int sent = hal_can_send_frames(batch, n);
+                if (sent < 0) sent = 0;
+                st.bg_tx += (uint64_t)sent;
+                st.bg_tx_fail += (uint64_t)(n - sent);
+            }
+            if (next_bg + 100000u < t) next_bg = t;  /* More than 100 ms behind: resync */
+        }
+
+        /* --- Reporting and end of run --- */
+        if (t >= next_report) {
+            if (!cfg.quiet) report(&st, (t - t0) / 1e6, "STAT");
+            next_report += REPORT_PERIOD_US;
+        }
+        if (cfg.duration_s > 0.0 && (double)(t - t0) / 1e6 >= cfg.duration_s) break;
+
+        /* Sleep until the next deadline (max 1 ms so RX stays responsive) */
+        if (cfg.bg_saturate) {
+            struct timespec ts = { 0, 200000L };   /* TX path full: let the bus drain */
+            nanosleep(&ts, NULL);
+        } else {
+            uint64_t next = next_status;
+            if (cfg.bg_rate > 0.0 && next_bg < next) next = next_bg;
+            uint64_t now = now_us();
+            uint64_t wait = (next > now) ? next - now : 0;
+            if (wait > 1000u) wait = 1000u;
+            if (wait > 0) {
+                struct timespec ts = { 0, (long)(wait * 1000u) };
+                nanosleep(&ts, NULL);
+            }
+        }
+    }
+
+    report(&st, (now_us() - t0) / 1e6, "SUMMARY");
+    hal_can_shutdown();
+    return 0;
+}
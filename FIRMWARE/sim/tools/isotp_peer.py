@@ -0,0 +1,186 @@
+"""
+@file isotp_peer.py
+@brief ISO-TP tester peer for the steering wheel (drivers/isotp.c).
+
+@details
+Sends messages to the wheel on 0x7E4 and receives its answers on 0x7EC, with
+segmentation and flow control on both sides. Until the layout / table
+consumers exist the wheel sends every message back (loopback), so this tool
+checks the round trip byte for byte and reports the throughput:
+
+    F1_CAN_IF=vbus:default python3 tools/isotp_peer.py --size 4000 --count 5
+    F1_CAN_IF=vbus:default python3 tools/isotp_peer.py --size 1024 --bs 4 --stmin 2
+
+@note Standard library only with the virtual bus; python-can for SocketCAN.
+"""
+
+import argparse
+import os
+import random
+import sys
+import time
+
+REQ_ID = 0x7E4      # Tester -> wheel
+RSP_ID = 0x7EC      # Wheel -> tester
+PAD = 0xCC
+
+
+class Frame:
+    """Outgoing frame (python-can compatible attribute names)."""
+
+    def __init__(self, data):
+        self.arbitration_id = REQ_ID
+        self.data = bytes(data) + bytes([PAD]) * (8 - len(data))
+        self.is_extended_id = False
+
+
+class IsoTpError(Exception):
+    pass
+
+
+def stmin_seconds(st):
+    if st <= 0x7F:
+        return st / 1000.0
+    if 0xF1 <= st <= 0xF9:
+        return (st - 0xF0) / 10000.0
+    return 0.127
+
+
+class IsoTpPeer:
+    def __init__(self, bus, bs=0, stmin=0, timeout=1.0):
+        self.bus = bus
+        self.bs = bs            # Block size we advertise when receiving
+        self.stmin = stmin      # STmin we advertise when receiving
+        self.timeout = timeout  # N_Bs / N_Cr
+
+    def _recv(self, timeout):
+        end = time.monotonic() + timeout
+        while time.monotonic() < end:
+            msg = self.bus.recv(end - time.monotonic())
+            if msg is not None and msg.arbitration_id == RSP_ID:
+                return bytes(msg.data)
+        raise IsoTpError("timeout")
+
+    def _send(self, data):
+        while True:
+            try:
+                self.bus.send(Frame(data))
+                return
+            except Exception:       # TX queue full: retry
+                time.sleep(0.0005)
+
+    def _wait_fc(self):
+        while True:
+            d = self._recv(self.timeout)
+            if d[0] >> 4 != 3:
+                continue
+            fs = d[0] & 0x0F
+            if fs == 0:
+                return d[1], stmin_seconds(d[2])
+            if fs == 2:
+                raise IsoTpError("receiver overflow (FC.OVFLW)")
+            # FC.WAIT: keep waiting
+
+    def send(self, payload):
+        n = len(payload)
+        if n <= 7:
+            self._send(bytes([n]) + payload)
+            return
+        if n <= 4095:
+            first = bytes([0x10 | (n >> 8), n & 0xFF]) + payload[:6]
+            pos = 6
+        else:
+            first = bytes([0x10, 0x00]) + n.to_bytes(4, "big") + payload[:2]
+            pos = 2
+        self._send(first)
+        sn = 1
+        bs, stmin = self._wait_fc()
+        block = 0
+        while pos < n:
+            self._send(bytes([0x20 | sn]) + payload[pos:pos + 7])
+            pos += 7
+            sn = (sn + 1) & 0x0F
+            block += 1
+            if pos >= n:
+                break
+            if bs and block >= bs:
+                bs, stmin = self._wait_fc()
+                block = 0
+            elif stmin:
+                time.sleep(stmin)
+
+    def receive(self, timeout=2.0):
+        while True:
+            d = self._recv(timeout)
+            pci = d[0] >> 4
+            if pci == 0:
+                return d[1:1 + (d[0] & 0x0F)]
+            if pci == 1:
+                break
+        n = ((d[0] & 0x0F) << 8) | d[1]
+        if n == 0:
+            n = int.from_bytes(d[2:6], "big")
+            buf = bytearray(d[6:8])
+        else:
+            buf = bytearray(d[2:8])
+        self._send(bytes([0x30, self.bs, self.stmin]))
+        sn, block = 1, 0
+        while len(buf) < n:
+            d = self._recv(self.timeout)
+            if d[0] >> 4 != 2:
+                continue
+            if d[0] & 0x0F != sn:
+                raise IsoTpError("sequence error (got %d, expected %d)" % (d[0] & 0x0F, sn))
+            buf += d[1:8]
+            sn = (sn + 1) & 0x0F
+            block += 1
+            if self.bs and block >= self.bs and len(buf) < n:
+                self._send(bytes([0x30, self.bs, self.stmin]))
+                block = 0
+        return bytes(buf[:n])
+
+
+def open_bus():
+    channel = os.environ.get("F1_CAN_IF", "vcan0")
+    if channel.startswith("vbus:"):
+        sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+        from vbus import VirtualBus
+        return VirtualBus(channel)
+    import can
+    return can.interface.Bus(channel=channel, bustype="socketcan",
+                             can_filters=[{"can_id": RSP_ID, "can_mask": 0x7FF}])
+
+
+def main():
+    ap = argparse.ArgumentParser(description="ISO-TP loopback test against the steering wheel")
+    ap.add_argument("--size", type=int, default=1000, help="message length in bytes")
+    ap.add_argument("--count", type=int, default=3, help="messages to send")
+    ap.add_argument("--bs", type=int, default=0, help="block size advertised for the answers")
+    ap.add_argument("--stmin", type=int, default=0, help="STmin advertised for the answers (raw byte)")
+    args = ap.parse_args()
+
+    bus = open_bus()
+    peer = IsoTpPeer(bus, args.bs, args.stmin)
+    failures = 0
+    try:
+        for i in range(args.count):
+            payload = bytes(random.getrandbits(8) for _ in range(args.size))
+            t0 = time.monotonic()
+            peer.send(payload)
+            t1 = time.monotonic()
+            echo = peer.receive()
+            t2 = time.monotonic()
+            ok = echo == payload
+            failures += not ok
+            print("#%d %d B  send %.1f ms (%.1f kB/s)  echo %.1f ms (%.1f kB/s)  %s" % (
+                i, args.size, (t1 - t0) * 1e3, args.size / (t1 - t0) / 1e3,
+                (t2 - t1) * 1e3, args.size / (t2 - t1) / 1e3, "OK" if ok else "MISMATCH"))
+    except IsoTpError as e:
+        sys.exit("ISO-TP: %s" % e)
+    finally:
+        bus.shutdown()
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
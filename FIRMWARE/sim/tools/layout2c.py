@@ -0,0 +1,473 @@
+#!/usr/bin/env python3
+"""
+@file layout2c.py
+@brief Compiles the dashboard layout description into the binary blob walked by layout.c.
+
+@details
+Reads a JSON layout (drivers/dash_layout.json) and the signal table of the
+application (enum SIG_* and sig_defs[] in app/app_main.c), then writes the
+blob described in drivers/layout.h:
+
+- the static layer of every page (labels, frames: everything that never
+  changes) is rendered into a full-screen RGB565 image with the pixel rules
+  of the TFT_LCD driver (5x8 font of TFT_LCD.h scaled by the size, 6 * size
+  advance) and encoded in the LCD_draw_rle format: one byte per run, palette
+  index in the high nibble, length 1..15 in the low nibble, a low nibble of
+  0 followed by a 16-bit little-endian length;
+- every widget becomes a fixed-size record with its signal index, colors,
+  rules, and its precomputed text origin, dirty rectangle and signal mask.
+
+Layout description:
+
+    { "background": "BLACK",
+      "groups": { "header": [ <widget>, ... ] },
+      "pages": [ { "name": "race",
+                   "items":   [ { "text": "GEAR", "at": [135, 105], "size": 2, "color": "WHITE" },
+                                { "rect": [133, 135, 54, 60], "color": "WHITE" },
+                                { "fill": [0, 20, 320, 1], "color": "GRAY" } ],
+                   "widgets": [ "header",
+                                { "use": "message", "at": [180, 80] },
+                                { "type": "number", "signal": "t1", "at": [12, 20], "size": 2,
+                                  "prefix": "T1:", "suffix": "C", "chars": 7,
+                                  "rules": [ { "if": "can_active == 0", "fg": "GRAY" } ] } ] } ] }
+
+Widgets (common keys: "signal", "at", "rect", "size", "fg", "bg", "border",
+"rules"; "use" inserts a group, its other keys override the group's):
+
+- label:  "text"; "align": "center" centres the text in "rect".
+- number: "prefix", "suffix", "divisor", "decimals", "chars" (width of the
+          area in characters, prefix and suffix included).
+- text:   "strings", indexed by the signal value.
+- bar:    "rect", "min" (empty), "max" (full).
+- dot:    "at" is the centre, "radius".
+- trend:  "rect" (one column per x), "min" (bottom), "max" (top), "period"
+          (ms per column), "border" (sweep cursor color); "scroll": true
+          scrolls the panel instead, for a rect of full screen height whose
+          band of columns holds nothing else. No rules: a trend is sampled
+          every slot, not redrawn on a change (drivers/trend.h).
+
+A rule is "<signal> <op> <value>" with op ==, !=, >, < or & (any bit set),
+and sets "fg" and/or "bg"; for each color the first matching rule wins.
+Colors are the names of TFT_LCD.h or RGB565 numbers ("0x8410").
+
+The generated header (drivers/dash_layout.h) is committed so the firmware
+build does not depend on Python. The optional binary output is the same blob
+for tools/can_flash.py --layout. Regenerate after editing the description or
+the signal table (`make layout`):
+
+    python3 tools/layout2c.py drivers/dash_layout.json app/app_main.c drivers/dash_layout.h [dash_layout.bin]
+
+@note Standard library only.
+"""
+
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+SCREEN_W, SCREEN_H = 320, 240       # Landscape (TFT_ORIGIN 0x28)
+TFT_LCD_H = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "drivers", "TFT_LCD.h")
+
+# Must match drivers/layout.h
+MAGIC, VERSION = 0x594C3146, 2
+HEADER = struct.Struct("<IHHIIHHBBHII")
+PAGE = struct.Struct("<8sIIIIIBBH")
+WIDGET = struct.Struct("<BBBBBBHhhhhhhHHIIIIiii")
+RULE = struct.Struct("<BBBBiHH")
+TYPES = {"label": 0, "number": 1, "text": 2, "bar": 3, "dot": 4, "trend": 5}
+OPS = {"==": 0, "!=": 1, ">": 2, "<": 3, "&": 4}
+FG, BG = 0, 1
+NO_SIGNAL, F_BORDER, F_SCROLL = 0xFF, 0x01, 0x02
+PAGE_MAX = 8
+TREND_MAX, TREND_POOL_SIZE = 4, 1536    # Must match drivers/trend.h
+
+
+def fail(msg):
+    sys.exit("layout2c: " + msg)
+
+
+def load_tft_header(path):
+    """Returns (colors by name, font bytes) parsed from TFT_LCD.h."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    colors = {m.group(1): int(m.group(2), 16)
+              for m in re.finditer(r"#define\s+(\w+)\s+\(0x([0-9A-Fa-f]{4})\)", text)}
+    body = text.split("#define TFT_FONT", 1)[1].split("}", 1)[0]
+    body = re.sub(r"/\*.*?\*/", "", body)
+    font = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", body)]
+    if len(font) < 128 * 5:
+        fail("TFT_FONT too short (%d bytes)" % len(font))
+    return colors, font
+
+
+def load_signals(path):
+    """Returns [(name, type)] in store order, parsed from the SIG_ enum and sig_defs[] of the application."""
+    with open(path, encoding="utf-8") as f:
+        text = re.sub(r"/\*.*?\*/", "", f.read(), flags=re.S)
+    enum = re.search(r"enum\s*\{([^}]*\bSIG_COUNT\b[^}]*)\}", text)
+    if enum is None:
+        fail("%s: no SIG_ enum" % path)
+    ids = re.findall(r"\b(SIG_\w+)\s*,", enum.group(1).split("SIG_COUNT")[0])
+    defs = {m.group(1): (m.group(2), m.group(3))
+            for m in re.finditer(r"\[(SIG_\w+)\]\s*=\s*\{\s*\"(\w+)\"\s*,\s*(SIG_T_\w+)", text)}
+    missing = [i for i in ids if i not in defs]
+    if missing:
+        fail("%s: no sig_defs entry for %s" % (path, ", ".join(missing)))
+    return [defs[i] for i in ids]
+
+
+class Canvas:
+    def __init__(self, w, h, color):
+        self.w, self.h = w, h
+        self.px = [color] * (w * h)
+
+    def fill(self, x, y, w, h, color):
+        for yy in range(max(y, 0), min(y + h, self.h)):
+            for xx in range(max(x, 0), min(x + w, self.w)):
+                self.px[yy * self.w + xx] = color
+
+    def rect(self, x, y, w, h, color):
+        self.fill(x, y, w, 1, color)
+        self.fill(x, y + h - 1, w, 1, color)
+        self.fill(x, y, 1, h, color)
+        self.fill(x + w - 1, y, 1, h, color)
+
+    def char(self, font, x, y, ch, fg, bg, size):
+        code = ord(ch)
+        for bit in range(8):
+            for col in range(5):
+                color = fg if (font[code * 5 + col] >> bit) & 1 else bg
+                self.fill(x + col * size, y + bit * size, size, size, color)
+
+    def text(self, font, x, y, s, fg, bg, size):
+        for i, ch in enumerate(s):
+            self.char(font, x + i * 6 * size, y, ch, fg, bg, size)
+
+
+def encode(px):
+    """Returns (palette, encoded bytes) of a pixel list."""
+    palette = []
+    for c in px:
+        if c not in palette:
+            palette.append(c)
+    if len(palette) > 16:
+        fail("more than 16 colors in a layer")
+
+    out = bytearray()
+    i = 0
+    while i < len(px):
+        j = i
+        while j < len(px) and px[j] == px[i] and j - i < 0xFFFF:
+            j += 1
+        n, idx = j - i, palette.index(px[i])
+        if n < 16:
+            out.append((idx << 4) | n)
+        else:
+            out += bytes(((idx << 4), n & 0xFF, n >> 8))
+        i = j
+    return palette, bytes(out)
+
+
+def ascii_text(value):
+    if not isinstance(value, str) or any(ord(c) >= 128 for c in value):
+        fail("%r is not an ASCII string" % (value,))   # Indexed like LCD_draw_char (int8_t)
+    return value
+
+
+class Compiler:
+    def __init__(self, desc, signals, colors, font):
+        self.desc, self.colors, self.font = desc, colors, font
+        self.signals = signals
+        self.sig_index = {name: i for i, (name, _) in enumerate(signals)}
+        self.background = self.color(desc.get("background", "BLACK"))
+
+    def color(self, value):
+        if isinstance(value, int):
+            return value
+        if value in self.colors:
+            return self.colors[value]
+        try:
+            return int(value, 0)
+        except ValueError:
+            fail("unknown color %r" % value)
+
+    def signal(self, name, bound=False):
+        if name not in self.sig_index:
+            fail("unknown signal %r" % name)
+        index = self.sig_index[name]
+        if bound and self.signals[index][1] != "SIG_T_I32":
+            fail("signal %r is not an integer" % name)
+        return index
+
+    def render(self, page):
+        canvas = Canvas(SCREEN_W, SCREEN_H, self.background)
+        for item in page.get("items", []):
+            color = self.color(item.get("color", "WHITE"))
+            if "text" in item:
+                x, y = item["at"]
+                bg = self.color(item["bg"]) if "bg" in item else self.background
+                canvas.text(self.font, x, y, ascii_text(item["text"]), color, bg, item.get("size", 1))
+            elif "rect" in item:
+                canvas.rect(*item["rect"], color)
+            elif "fill" in item:
+                canvas.fill(*item["fill"], color)
+            else:
+                fail("page %s: unknown item %r" % (page["name"], item))
+        return canvas.px
+
+    def expand(self, page):
+        """Widgets of a page with the groups inserted."""
+        groups = self.desc.get("groups", {})
+        out = []
+        for entry in page.get("widgets", []):
+            if isinstance(entry, str):
+                entry = {"use": entry}
+            if "use" in entry:
+                if entry["use"] not in groups:
+                    fail("page %s: unknown group %r" % (page["name"], entry["use"]))
+                override = {k: v for k, v in entry.items() if k != "use"}
+                out += [dict(w, **override) for w in groups[entry["use"]]]
+            else:
+                out.append(entry)
+        return out
+
+    def rules(self, w):
+        """[(signal, op, target, value, color)], fg before bg for a rule setting both."""
+        out = []
+        for rule in w.get("rules", []):
+            m = re.match(r"^\s*(\w+)\s*(==|!=|>|<|&)\s*(-?\w+)\s*$", rule.get("if", ""))
+            if m is None:
+                fail("bad rule condition %r" % rule.get("if"))
+            sig, op, value = self.signal(m.group(1)), OPS[m.group(2)], int(m.group(3), 0)
+            for key, target in (("fg", FG), ("bg", BG)):
+                if key in rule:
+                    out.append((sig, op, target, value, self.color(rule[key])))
+        return out
+
+    def widget(self, w):
+        """Returns the record fields of a widget, strings and rules still unresolved."""
+        kind = w.get("type")
+        if kind not in TYPES:
+            fail("unknown widget type %r" % kind)
+        size = w.get("size", 1)
+        char_w, char_h = 6 * size, 8 * size
+        x, y = w.get("at", (0, 0))
+        rect = w.get("rect")
+        fields = {"type": TYPES[kind], "size": size, "x": x, "y": y, "flags": 0, "border": 0,
+                  "fg": self.color(w.get("fg", "WHITE")), "bg": self.color(w.get("bg", self.background)),
+                  "signal": NO_SIGNAL, "text": None, "suffix": None, "a": 0, "b": 0, "c": 0}
+        if "border" in w:
+            fields["border"] = self.color(w["border"])
+            fields["flags"] |= F_BORDER if kind not in ("dot", "trend") else 0
+        if kind != "label":
+            if "signal" not in w:
+                fail("%s widget without signal" % kind)
+            fields["signal"] = self.signal(w["signal"], bound=True)
+
+        if kind == "label":
+            text = ascii_text(w["text"])
+            fields["text"] = text
+            if rect is None:
+                rect = (x, y, len(text) * char_w, char_h)
+            elif w.get("align") == "center":
+                fields["x"] = rect[0] + (rect[2] - len(text) * char_w) // 2
+                fields["y"] = rect[1] + (rect[3] - char_h) // 2
+        elif kind == "number":
+            prefix, suffix = ascii_text(w.get("prefix", "")), ascii_text(w.get("suffix", ""))
+            fields["text"], fields["suffix"] = prefix, (suffix or None)
+            fields["a"], fields["b"] = w.get("divisor", 1), w.get("decimals", 0)
+            if fields["a"] <= 0 or not 0 <= fields["b"] <= 3:
+                fail("number %s: divisor > 0 and decimals 0..3" % w["signal"])
+            chars = w.get("chars", len(prefix) + len(suffix) + 6)
+            rect = rect or (x, y, chars * char_w, char_h)
+        elif kind == "text":
+            strings = [ascii_text(s) for s in w["strings"]]
+            fields["text"], fields["a"] = strings, len(strings)
+            rect = rect or (x, y, max(len(s) for s in strings) * char_w, char_h)
+        elif kind == "bar":
+            if rect is None:
+                fail("bar %s without rect" % w["signal"])
+            fields["x"], fields["y"] = rect[0], rect[1]
+            fields["a"], fields["b"] = w.get("min", 0), w.get("max", 100)
+            if fields["b"] <= fields["a"]:
+                fail("bar %s: max <= min" % w["signal"])
+        elif kind == "trend":
+            if rect is None:
+                fail("trend %s without rect" % w["signal"])
+            x0, y0, rw, rh = rect
+            if x0 < 0 or y0 < 0 or x0 + rw > SCREEN_W or y0 + rh > SCREEN_H or rw < 2 or rh < 2:
+                fail("trend %s: rect outside the screen" % w["signal"])
+            fields["a"], fields["b"], fields["c"] = w.get("min", 0), w.get("max", 100), w.get("period", 500)
+            if fields["b"] <= fields["a"] or fields["c"] <= 0:
+                fail("trend %s: max <= min or period <= 0" % w["signal"])
+            if w.get("rules"):
+                fail("trend %s: no rules on a trend" % w["signal"])
+            fields["border"] = self.color(w.get("border", "GRAY"))
+            if w.get("scroll"):
+                if y0 != 0 or rh != SCREEN_H:
+                    fail("trend %s: a scrolled trend spans the full screen height" % w["signal"])
+                fields["flags"] |= F_SCROLL
+        else:
+            r = w.get("radius", 3)
+            fields["a"] = r
+            fields["border"] = self.color(w.get("border", "WHITE"))
+            rect = rect or (x - r, y - r, 2 * r + 1, 2 * r + 1)
+
+        fields["rect"] = tuple(rect)
+        fields["rules"] = self.rules(w)
+        mask = 0 if fields["signal"] == NO_SIGNAL or kind == "trend" else 1 << fields["signal"]
+        for rule in fields["rules"]:
+            mask |= 1 << rule[0]
+        fields["mask"] = mask
+        return fields
+
+    def check_scroll(self, page, widgets, px):
+        """A scrolled trend moves its whole band of columns: nothing else may be drawn in it."""
+        scrolled = [w for w in widgets if w["flags"] & F_SCROLL and w["type"] == TYPES["trend"]]
+        if len(scrolled) > 1:
+            fail("page %s: one scrolled trend per page (one scrolling area)" % page["name"])
+        for band in scrolled:
+            x0, x1 = band["rect"][0], band["rect"][0] + band["rect"][2]
+            for w in widgets:
+                if w is not band and w["rect"][0] < x1 and w["rect"][0] + w["rect"][2] > x0:
+                    fail("page %s: a widget overlaps the band of the scrolled trend" % page["name"])
+            if any(px[y * SCREEN_W + x] != self.background for y in range(SCREEN_H) for x in range(x0, x1)):
+                fail("page %s: static items in the band of the scrolled trend" % page["name"])
+
+    def compile(self):
+        pages = self.desc["pages"]
+        if not 0 < len(pages) <= PAGE_MAX:
+            fail("1 to %d pages" % PAGE_MAX)
+        if len(self.signals) > 32:
+            fail("more than 32 signals")
+
+        blob = Blob()
+        blob.add(bytes(HEADER.size))
+        sig_names = blob.add(b"".join(name.encode() + b"\0" for name, _ in self.signals), 4)
+        page_tab = blob.add(bytes(PAGE.size * len(pages)), 4)
+
+        compiled = []
+        for page in pages:
+            widgets = [self.widget(w) for w in self.expand(page)]
+            if len(widgets) > 255:
+                fail("page %s: too many widgets" % page["name"])
+            compiled.append((page, widgets, blob.add(bytes(WIDGET.size * len(widgets)), 4)))
+
+        trends = [w for _, widgets, _ in compiled for w in widgets if w["type"] == TYPES["trend"]]
+        trend_bytes = sum(2 * ((w["rect"][2] * 2 + 3) & ~3) for w in trends)
+        if len(trends) > TREND_MAX or trend_bytes > TREND_POOL_SIZE:
+            fail("%d trends, %d bytes of history: at most %d, %d bytes" % (
+                len(trends), trend_bytes, TREND_MAX, TREND_POOL_SIZE))
+
+        stats = []
+        for index, (page, widgets, widget_tab) in enumerate(compiled):
+            name = page["name"].encode()
+            if len(name) > 7:
+                fail("page name %r longer than 7 characters" % page["name"])
+            px = self.render(page)
+            self.check_scroll(page, widgets, px)
+            palette, layer = encode(px)
+            pal_off = blob.add(struct.pack("<%dH" % len(palette), *palette), 4)
+            layer_off = blob.add(layer, 4)
+
+            page_mask = 0
+            for i, w in enumerate(widgets):
+                rules_off = blob.add(b"".join(RULE.pack(s, op, t, 0, v, c, 0) for s, op, t, v, c in w["rules"]), 4)
+                if isinstance(w["text"], list):
+                    text_off = blob.add(struct.pack("<%dI" % len(w["text"]), *[blob.string(s) for s in w["text"]]), 4)
+                else:
+                    text_off = blob.string(w["text"]) if w["text"] is not None else 0
+                suffix_off = blob.string(w["suffix"]) if w["suffix"] is not None else 0
+                blob.put(widget_tab + i * WIDGET.size, WIDGET.pack(
+                    w["type"], w["signal"], w["size"], len(w["rules"]), w["flags"], 0, w["border"],
+                    w["x"], w["y"], *w["rect"], w["fg"], w["bg"], w["mask"],
+                    rules_off, text_off, suffix_off, w["a"], w["b"], w["c"]))
+                page_mask |= w["mask"]
+
+            blob.put(page_tab + index * PAGE.size, PAGE.pack(
+                name, layer_off, len(layer), pal_off, widget_tab, page_mask, len(palette), len(widgets), 0))
+            stats.append((page["name"], len(layer), len(widgets)))
+
+        blob.align(4)
+        data = bytes(blob.data)
+        crc = zlib.crc32(data[HEADER.size:]) & 0xFFFFFFFF
+        header = HEADER.pack(MAGIC, VERSION, HEADER.size, len(data), crc, SCREEN_W, SCREEN_H,
+                             len(pages), len(self.signals), 0, page_tab, sig_names)
+        return header + data[HEADER.size:], stats
+
+
+class Blob:
+    def __init__(self):
+        self.data = bytearray()
+        self.strings = {}
+
+    def align(self, n):
+        self.data += bytes(-len(self.data) % n)
+
+    def add(self, data, align=1):
+        self.align(align)
+        off = len(self.data)
+        self.data += data
+        return off
+
+    def put(self, off, data):
+        self.data[off:off + len(data)] = data
+
+    def string(self, s):
+        if s not in self.strings:
+            self.strings[s] = self.add(s.encode() + b"\0")
+        return self.strings[s]
+
+
+def generate_header(blob, stats, src_name, out_name):
+    guard = re.sub(r"\W", "_", out_name).upper()
+    words = struct.unpack("<%dI" % (len(blob) // 4), blob)
+
+    L = []
+    L.append("/**")
+    L.append(" * @file %s" % out_name)
+    L.append(" * @brief Built-in dashboard layout generated from %s." % src_name)
+    L.append(" *")
+    L.append(" * @details")
+    L.append(" * GENERATED FILE - DO NOT EDIT. Regenerate with `make layout`:")
+    L.append(" *     python3 tools/layout2c.py drivers/%s app/app_main.c drivers/%s" % (src_name, out_name))
+    L.append(" *")
+    L.append(" * Blob in the layout.h format, stored as words for its alignment:")
+    for name, layer, widgets in stats:
+        L.append(" * - %-8s static layer %5d bytes, %2d widgets" % (name, layer, widgets))
+    L.append(" */")
+    L.append("")
+    L.append("#ifndef %s" % guard)
+    L.append("#define %s" % guard)
+    L.append("")
+    L.append("#include <stdint.h>")
+    L.append("")
+    L.append("#define DASH_LAYOUT_SIZE  %du  /**< Bytes of the blob. */" % len(blob))
+    L.append("")
+    L.append("static const uint32_t dash_layout[DASH_LAYOUT_SIZE / 4u] = {")
+    for i in range(0, len(words), 8):
+        L.append("    " + ", ".join("0x%08X" % w for w in words[i:i + 8]) + ",")
+    L.append("};")
+    L.append("")
+    L.append("#endif /* %s */" % guard)
+    L.append("")
+    return "\n".join(L)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) not in (4, 5):
+        sys.exit("usage: layout2c.py <layout.json> <app_main.c> <output.h> [output.bin]")
+    with open(sys.argv[1], encoding="utf-8") as f:
+        DESC = json.load(f)
+    COLORS, FONT = load_tft_header(TFT_LCD_H)
+    BLOB, STATS = Compiler(DESC, load_signals(sys.argv[2]), COLORS, FONT).compile()
+    TEXT = generate_header(BLOB, STATS, os.path.basename(sys.argv[1]), os.path.basename(sys.argv[3]))
+    with open(sys.argv[3], "w", encoding="utf-8", newline="\n") as f:
+        f.write(TEXT)
+    if len(sys.argv) == 5:
+        with open(sys.argv[4], "wb") as f:
+            f.write(BLOB)
+    print("layout2c: %d pages, %d widgets, %d bytes -> %s"
+          % (len(STATS), sum(s[2] for s in STATS), len(BLOB), " ".join(sys.argv[3:])))
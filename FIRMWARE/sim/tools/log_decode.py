@@ -0,0 +1,196 @@
+"""
+@file log_decode.py
+@brief Decoder for the tokenized UART log of the target (hal/hal_log.h).
+
+@details
+The target sends HAL_LOG calls as binary records and HAL_UART_Printf output
+as plain text, in the same stream:
+
+    00 n id_lo id_hi arg0 .. arg(n-1)     (arguments: 32-bit little-endian)
+
+The ID is the offset of the format string in the `.log_str` section of the
+ELF that runs on the target. Text is passed through unchanged; each record
+is printed with its format string and arguments. Binary frames (`00 FF`
+... `00`, see tools/telem_view.py) are skipped:
+
+    python3 tools/log_decode.py SW_S32K118.elf /dev/ttyACM0      (pyserial, 115200)
+    python3 tools/log_decode.py SW_S32K118.elf capture.bin
+    cat /dev/ttyACM0 | python3 tools/log_decode.py SW_S32K118.elf -
+
+`%s` arguments are flash addresses of string constants, read from the ELF.
+
+@note Standard library only, except pyserial for a serial port.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+MARKER = 0x00
+MAX_ARGS = 8
+FRAME_TAG = 0xFF        # 00 FF <COBS data> 00: binary frame (telemetry), skipped here
+FRAME_MAX = 300         # Longest frame kept while waiting for its end
+
+# printf conversion: flags, width, precision, length modifiers, conversion
+CONV_RE = re.compile(r"%([-+ #0]*[0-9]*(?:\.[0-9]*)?)(?:hh|h|ll|l|L|q|j|z|t)?([diouxXcfFeEgGsp%])")
+
+
+class Elf:
+    """Sections of an ELF file (32 or 64 bits, little-endian)."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF" or data[5] != 1:
+            raise ValueError("%s: not a little-endian ELF file" % path)
+        if data[4] == 1:
+            shoff, = struct.unpack_from("<I", data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+            sh_fmt = "<IIIIIIIIII"
+        else:
+            shoff, = struct.unpack_from("<Q", data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x3A)
+            sh_fmt = "<IIQQQQIIQQ"
+
+        headers = [struct.unpack_from(sh_fmt, data, shoff + i * shentsize) for i in range(shnum)]
+        names = headers[shstrndx]
+        names = data[names[4]:names[4] + names[5]]
+
+        self.sections = {}      # name -> (type, flags, addr, bytes)
+        for name, typ, flags, addr, off, size, *_ in headers:
+            name = names[name:names.index(b"\0", name)].decode()
+            content = data[off:off + size] if typ != 8 else b""     # SHT_NOBITS: no content
+            self.sections[name] = (typ, flags, addr, content)
+
+    def log_strings(self):
+        if ".log_str" not in self.sections:
+            raise ValueError("no .log_str section: not built with HAL_LOG")
+        return self.sections[".log_str"][3]
+
+    def string_at(self, addr):
+        """NUL-terminated string at a load address (allocated sections only)."""
+        for typ, flags, base, content in self.sections.values():
+            if flags & 0x2 and content and base <= addr < base + len(content):
+                pos = addr - base
+                end = content.find(b"\0", pos)
+                return content[pos:end if end >= 0 else len(content)].decode(errors="replace")
+        return "<str@0x%08X>" % addr
+
+
+def c_string(table, offset):
+    end = table.find(b"\0", offset)
+    return table[offset:end].decode(errors="replace")
+
+
+def format_record(elf, table, fmt_id, args):
+    """Rebuilds the text of one record, conversion by conversion."""
+    if fmt_id >= len(table):
+        return "<log: unknown id 0x%04X %s>\n" % (fmt_id, " ".join("%08X" % a for a in args))
+    fmt = c_string(table, fmt_id)
+    it = iter(args)
+
+    def conv(m):
+        spec, c = m.group(1), m.group(2)
+        if c == "%":
+            return "%"
+        v = next(it, 0)
+        if c in "di":
+            return ("%" + spec + "d") % (v - (1 << 32) if v & 0x80000000 else v)
+        if c in "fFeEgG":
+            return ("%" + spec + c) % struct.unpack("<f", struct.pack("<I", v))[0]
+        if c == "s":
+            return ("%" + spec + "s") % elf.string_at(v)
+        if c == "c":
+            return ("%" + spec + "c") % chr(v & 0xFF)
+        if c == "p":
+            return "0x%08x" % v
+        return ("%" + spec + c) % v
+
+    return CONV_RE.sub(conv, fmt)
+
+
+def decode(elf, stream, out):
+    """Passes text through and expands the records, until the end of the stream."""
+    table = elf.log_strings()
+    buf = bytearray()
+    while True:
+        chunk = stream.read1(4096)
+        if not chunk:
+            break
+        buf += chunk
+        while buf:
+            if buf[0] != MARKER:
+                # Plain text up to the next record
+                end = buf.find(bytes([MARKER]))
+                end = len(buf) if end < 0 else end
+                out.write(buf[:end].decode(errors="replace"))
+                del buf[:end]
+                continue
+            if len(buf) >= 2 and buf[1] == FRAME_TAG:
+                end = buf.find(bytes([MARKER]), 2)
+                if end < 0 and len(buf) < FRAME_MAX:
+                    break
+                del buf[:end + 1 if end >= 0 else 2]
+                continue
+            need = _needed(buf)
+            if need is None:
+                # Not a record (corrupted stream): skip the marker byte
+                del buf[:1]
+                continue
+            if len(buf) < need:
+                break
+            n = buf[1]
+            fmt_id = buf[2] | (buf[3] << 8)
+            args = struct.unpack_from("<%dI" % n, buf, 4)
+            out.write(format_record(elf, table, fmt_id, args))
+            del buf[:need]
+        out.flush()
+
+
+def _needed(buf):
+    """Length of the record at the start of buf, None if it cannot be one."""
+    if len(buf) < 2:
+        return 4
+    if buf[1] > MAX_ARGS:
+        return None
+    return 4 + 4 * buf[1]
+
+
+class SerialInput:
+    """Serial port with the read1() of a file: whatever has arrived, at least one byte."""
+
+    def __init__(self, name, baud):
+        import serial   # pyserial
+        self.port = serial.Serial(name, baud)
+
+    def read1(self, size):
+        return self.port.read(max(1, min(size, self.port.in_waiting)))
+
+
+def open_input(name, baud):
+    if name == "-":
+        return sys.stdin.buffer
+    if name.startswith("/dev/") or name.upper().startswith("COM"):
+        return SerialInput(name, baud)
+    return open(name, "rb")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Decode the tokenized UART log of the steering wheel")
+    ap.add_argument("elf", help="ELF image running on the target (with the .log_str section)")
+    ap.add_argument("input", nargs="?", default="-", help="serial port, capture file or - (stdin)")
+    ap.add_argument("--baud", type=int, default=115200, help="serial baud rate")
+    args = ap.parse_args()
+
+    try:
+        elf = Elf(args.elf)
+        decode(elf, open_input(args.input, args.baud), sys.stdout)
+    except (OSError, ValueError) as e:
+        sys.exit("log_decode: %s" % e)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
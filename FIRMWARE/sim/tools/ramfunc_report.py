@@ -0,0 +1,93 @@
+"""
+@file ramfunc_report.py
+@brief Lists the functions linked into SRAM (HAL_RAMFUNC, hal/hal_ramfunc.h).
+
+@details
+Reads the symbol table of the target ELF and prints every function of the
+`.code` output section (the `.code_ram` input sections, copied from flash
+to SRAM at startup) with its size, then the total against the budget
+checked by the linker scripts:
+
+    python3 tools/ramfunc_report.py SW_S32K118.elf
+    python3 tools/ramfunc_report.py SW_S32K118.elf --budget 1024
+
+Linker veneers (`__*_veneer`) between flash and RAM code are listed
+separately: many of them in a hot path mean a callee was left in flash.
+The exit status is 1 when the section exceeds the budget.
+
+@note Standard library only.
+"""
+
+import argparse
+import struct
+import sys
+
+SECTION = ".code"
+BUDGET = 2048           # HAL_RAMFUNC_BUDGET
+STT_FUNC = 2
+
+
+def read_elf(path):
+    """Returns ({section name: (index, addr, size)}, [(name, value, size, type, shndx)])."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+        raise ValueError("%s: not a 32-bit little-endian ELF file" % path)
+
+    shoff, = struct.unpack_from("<I", data, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+    headers = [struct.unpack_from("<IIIIIIIIII", data, shoff + i * shentsize) for i in range(shnum)]
+
+    def cstr(table, off):
+        end = data.index(b"\x00", table + off)
+        return data[table + off:end].decode("ascii", "replace")
+
+    shstr = headers[shstrndx][4]
+    sections = {cstr(shstr, h[0]): (i, h[3], h[5]) for i, h in enumerate(headers)}
+
+    symbols = []
+    for h in headers:
+        if h[1] != 2:           # SHT_SYMTAB
+            continue
+        strtab = headers[h[6]][4]
+        for off in range(h[4], h[4] + h[5], 16):
+            name, value, size, info, _, shndx = struct.unpack_from("<IIIBBH", data, off)
+            symbols.append((cstr(strtab, name), value, size, info & 0xF, shndx))
+    return sections, symbols
+
+
+def main():
+    ap = argparse.ArgumentParser(description="List the HAL_RAMFUNC functions of a target ELF")
+    ap.add_argument("elf", help="target ELF (with its symbol table)")
+    ap.add_argument("--budget", type=int, default=BUDGET, help="SRAM budget in bytes")
+    args = ap.parse_args()
+
+    try:
+        sections, symbols = read_elf(args.elf)
+    except (OSError, ValueError) as e:
+        sys.exit("ramfunc_report: %s" % e)
+    if SECTION not in sections:
+        sys.exit("ramfunc_report: no %s section in %s" % (SECTION, args.elf))
+    index, addr, size = sections[SECTION]
+
+    funcs = sorted(((v & ~1, s, n) for n, v, s, t, x in symbols if x == index and t == STT_FUNC),
+                   key=lambda f: f[0])
+    veneers = [f for f in funcs if f[2].endswith("_veneer")]
+
+    print("%s at 0x%08X, %d bytes (budget %d, %d %%)" % (SECTION, addr, size, args.budget,
+                                                          100 * size // args.budget if args.budget else 0))
+    print("  %-10s %6s  %s" % ("address", "bytes", "function"))
+    for a, s, n in funcs:
+        if not n.endswith("_veneer"):
+            print("  0x%08X %6d  %s" % (a, s, n))
+    if veneers:
+        print("veneers:")
+        for a, s, n in veneers:
+            print("  0x%08X %6d  %s" % (a, s, n))
+    if size > args.budget:
+        print("over budget by %d bytes" % (size - args.budget), file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,229 @@
+"""
+@file telem_view.py
+@brief Live viewer for the binary telemetry stream (drivers/telemetry.h).
+
+@details
+Decodes the COBS frames (`00 FF` + COBS(record) + `00`) from the target UART
+or from the simulator, checks the CRC and the sequence, and prints one line
+per record, plots the values live (matplotlib) or writes them to a CSV file.
+Text and HAL_LOG records in the same stream are ignored.
+
+    F1_TELEM=pty make run                                  (prints the pty name)
+    python3 tools/telem_view.py /dev/pts/5
+    python3 tools/telem_view.py /dev/ttyACM0 --plot        (target, 115200 baud)
+    python3 tools/telem_view.py capture.bin --csv run.csv
+
+@note Standard library only; matplotlib for --plot.
+"""
+
+import argparse
+import collections
+import os
+import struct
+import sys
+import termios
+import time
+
+FRAME_LEAD = b"\x00\xff"
+FRAME_MAX = 64          # Longer frames are garbage (resynchronize)
+VERSION = 1
+RECORD = struct.Struct("<BBIBBBBHHhhhhBBHHHHHH")
+FIELDS = ("version", "seq", "now_ms", "buttons", "position", "leds", "flags",
+          "rotary_adc", "clutch_adc", "clutch_raw", "clutch_filt", "t1", "t2",
+          "gear", "reserved", "loop_us", "loop_max_us", "can_tx_age_ms",
+          "can_rx_age_ms", "bus_load", "crc")
+
+
+def crc16_ccitt(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+class Decoder:
+    """Frames out of a byte stream; counts the CRC errors and the lost records."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.last_seq = None
+        self.records = 0
+        self.bad_frames = 0
+        self.lost = 0
+
+    def feed(self, data):
+        self.buf += data
+        while True:
+            start = self.buf.find(FRAME_LEAD)
+            if start < 0:
+                del self.buf[:max(0, len(self.buf) - 1)]     # Keep a trailing 00
+                return
+            end = self.buf.find(b"\x00", start + 2)
+            if end < 0:
+                if len(self.buf) - start > FRAME_MAX:
+                    del self.buf[:start + 2]
+                    continue
+                del self.buf[:start]
+                return
+            rec = self._record(bytes(self.buf[start + 2:end]))
+            del self.buf[:end]      # The end 00 may lead the next frame
+            if rec is not None:
+                yield rec
+
+    def _record(self, encoded):
+        raw = cobs_decode(encoded)
+        if raw is None or len(raw) != RECORD.size or raw[0] != VERSION:
+            self.bad_frames += 1
+            return None
+        if crc16_ccitt(raw[:-2]) != struct.unpack_from("<H", raw, RECORD.size - 2)[0]:
+            self.bad_frames += 1
+            return None
+        rec = dict(zip(FIELDS, RECORD.unpack(raw)))
+        rec["clutch_raw"] /= 10.0
+        rec["clutch_filt"] /= 10.0
+        rec["bus_load"] /= 10.0
+        if self.last_seq is not None:
+            self.lost += (rec["seq"] - self.last_seq - 1) & 0xFF
+        self.last_seq = rec["seq"]
+        self.records += 1
+        return rec
+
+
+def open_input(name, baud):
+    """Returns a read(n) callable: stdin, a file, or a tty in raw mode (pty, serial port)."""
+    if name == "-":
+        return sys.stdin.buffer.read1
+    fd = os.open(name, os.O_RDONLY | os.O_NOCTTY)
+    if os.isatty(fd):
+        attrs = termios.tcgetattr(fd)
+        attrs[0] = attrs[1] = attrs[3] = 0          # Raw: no translation, no echo
+        attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        speed = getattr(termios, "B%d" % baud)
+        attrs[4] = attrs[5] = speed
+        attrs[6][termios.VMIN] = 1
+        attrs[6][termios.VTIME] = 0
+        termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    return lambda n: os.read(fd, n)
+
+
+def line(rec, dec):
+    return ("%8d ms  btn %02X  pos %2d  clutch %5.1f/%5.1f %%  adc %4d/%4d  T %3d/%3d  gear %d  "
+            "LED %d%d  loop %5d/%5d us  CAN tx %5d rx %5d ms %s load %4.1f %%  lost %d bad %d") % (
+        rec["now_ms"], rec["buttons"], rec["position"], rec["clutch_raw"], rec["clutch_filt"],
+        rec["rotary_adc"], rec["clutch_adc"], rec["t1"], rec["t2"], rec["gear"],
+        rec["leds"] & 1, (rec["leds"] >> 1) & 1, rec["loop_us"], rec["loop_max_us"],
+        rec["can_tx_age_ms"], rec["can_rx_age_ms"], "ok  " if rec["flags"] & 1 else "LOST",
+        rec["bus_load"], dec.lost, dec.bad_frames)
+
+
+class Plot:
+    """Scrolling plot of the last `span` seconds (matplotlib, interactive mode)."""
+
+    PANELS = (
+        ("Clutch (%)", ("clutch_raw", "clutch_filt")),
+        ("Rotary", ("position",)),
+        ("Temperature (°C)", ("t1", "t2")),
+        ("Loop (us)", ("loop_us", "loop_max_us")),
+        ("CAN age (ms)", ("can_tx_age_ms", "can_rx_age_ms")),
+    )
+
+    def __init__(self, span):
+        import matplotlib.pyplot as plt
+        self.plt = plt
+        self.span = span
+        self.t = collections.deque()
+        self.data = {k: collections.deque() for _, keys in self.PANELS for k in keys}
+        plt.ion()
+        self.fig, axes = plt.subplots(len(self.PANELS), 1, sharex=True, figsize=(10, 9))
+        self.lines = {}
+        for ax, (title, keys) in zip(axes, self.PANELS):
+            ax.set_ylabel(title)
+            ax.grid(True)
+            for k in keys:
+                self.lines[k], = ax.plot([], [], label=k)
+            ax.legend(loc="upper left", fontsize="small")
+        self.axes = axes
+        axes[-1].set_xlabel("time (s)")
+        self.last_draw = 0.0
+
+    def add(self, rec):
+        self.t.append(rec["now_ms"] / 1000.0)
+        for k, d in self.data.items():
+            d.append(rec[k])
+        while self.t and self.t[-1] - self.t[0] > self.span:
+            self.t.popleft()
+            for d in self.data.values():
+                d.popleft()
+
+    def draw(self):
+        if time.monotonic() - self.last_draw < 0.1 or not self.t:
+            return
+        self.last_draw = time.monotonic()
+        for k, ln in self.lines.items():
+            ln.set_data(self.t, self.data[k])
+        for ax in self.axes:
+            ax.relim()
+            ax.autoscale_view()
+        self.plt.pause(0.001)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Decode and plot the steering wheel telemetry stream")
+    ap.add_argument("input", help="pty / serial port, capture file or - (stdin)")
+    ap.add_argument("--baud", type=int, default=115200, help="serial baud rate")
+    ap.add_argument("--plot", action="store_true", help="live plot (matplotlib)")
+    ap.add_argument("--span", type=float, default=20.0, help="plotted time window (s)")
+    ap.add_argument("--csv", metavar="FILE", help="write every record to a CSV file")
+    ap.add_argument("--quiet", action="store_true", help="no line per record")
+    args = ap.parse_args()
+
+    try:
+        read = open_input(args.input, args.baud)
+    except (OSError, AttributeError) as e:
+        sys.exit("telem_view: %s" % e)
+    plot = Plot(args.span) if args.plot else None
+    csv = open(args.csv, "w") if args.csv else None
+    if csv:
+        csv.write(",".join(FIELDS[:-1]) + "\n")
+
+    dec = Decoder()
+    try:
+        while True:
+            data = read(4096)
+            if not data:
+                break
+            for rec in dec.feed(data):
+                if not args.quiet:
+                    print(line(rec, dec), flush=True)
+                if csv:
+                    csv.write(",".join(str(rec[k]) for k in FIELDS[:-1]) + "\n")
+                if plot:
+                    plot.add(rec)
+            if plot:
+                plot.draw()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if csv:
+            csv.close()
+    print("%d records, %d lost, %d bad frames" % (dec.records, dec.lost, dec.bad_frames), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,254 @@
+"""
+@file vbus.py
+@brief Python node for the user-space virtual CAN bus (hal/host_pc/hal_can_vbus.c).
+
+@details
+Lets Python tools (ecu_sim.py, test harnesses) join the same virtual bus as the
+firmware simulation without the vcan kernel module. The shared file layout,
+the flock() locking and the lazy arbitration/bit-timing model mirror the C
+implementation exactly; keep both files in sync when changing the layout.
+
+The API is a small subset of python-can:
+
+    bus = VirtualBus("vbus:default")
+    bus.send(msg)            # any object with .arbitration_id and .data
+    msg = bus.recv(0.1)      # -> VirtualMessage or None
+    bus.shutdown()
+
+@note Standard library only (mmap, fcntl, struct).
+"""
+
+import fcntl
+import mmap
+import os
+import struct
+import time
+
+# --------------------------------------------------------------------------
+# Shared layout (must match hal_can_vbus.c)
+# --------------------------------------------------------------------------
+VBUS_MAGIC = 0x53554256
+VBUS_VERSION = 1
+VBUS_MAX_NODES = 8
+VBUS_TX_QUEUE = 32
+VBUS_RING_SIZE = 1024
+VBUS_DEFAULT_BITRATE = 500000
+
+HDR_FMT = "<IIIIQQQQQQ"             # magic, version, bitrate, ring_size, bus_time, next_seq, stats x4
+NODE_FMT = "<IIIIII16s"             # pid, tx_head, tx_tail, tx_frames, tx_dropped, pad, name
+SLOT_FMT = "<QQIBB2x8s"             # seq, t_us, id, len, node, pad, data
+
+HDR_SIZE = struct.calcsize(HDR_FMT)
+NODE_HDR_SIZE = struct.calcsize(NODE_FMT)
+SLOT_SIZE = struct.calcsize(SLOT_FMT)
+NODE_SIZE = NODE_HDR_SIZE + VBUS_TX_QUEUE * SLOT_SIZE
+RING_OFFSET = HDR_SIZE + VBUS_MAX_NODES * NODE_SIZE
+TOTAL_SIZE = RING_OFFSET + VBUS_RING_SIZE * SLOT_SIZE
+
+
+def frame_bits(length):
+    """Worst-case stuffed length of a standard data frame (same as hal_can_frame_bits())."""
+    return 8 * length + 44 + (34 + 8 * length - 1) // 4
+
+
+def now_us():
+    return time.monotonic_ns() // 1000
+
+
+class VirtualMessage:
+    """Received frame (python-can compatible attribute names)."""
+
+    def __init__(self, arbitration_id, data, timestamp):
+        self.arbitration_id = arbitration_id
+        self.data = bytes(data)
+        self.dlc = len(self.data)
+        self.timestamp = timestamp          # seconds, CLOCK_MONOTONIC
+        self.is_extended_id = False
+
+    def __repr__(self):
+        return "VirtualMessage(id=0x%03X, data=%s, t=%.6f)" % (
+            self.arbitration_id, self.data.hex(), self.timestamp)
+
+
+class VirtualBus:
+    """One node on the virtual bus `vbus:<name>` (file /tmp/f1_vbus_<name>)."""
+
+    def __init__(self, channel="vbus:default"):
+        name = channel[len("vbus:"):] if channel.startswith("vbus:") else channel
+        self.path = "/tmp/f1_vbus_%s" % (name or "default")
+        self.fd = os.open(self.path, os.O_RDWR | os.O_CREAT, 0o666)
+
+        with self._locked():
+            if os.fstat(self.fd).st_size < TOTAL_SIZE:
+                os.ftruncate(self.fd, TOTAL_SIZE)
+            self.mm = mmap.mmap(self.fd, TOTAL_SIZE)
+            hdr = self._hdr()
+            now = now_us()
+            # A file from an earlier boot has times ahead of CLOCK_MONOTONIC
+            if (hdr[0] != VBUS_MAGIC or hdr[1] != VBUS_VERSION or hdr[3] != VBUS_RING_SIZE
+                    or hdr[2] == 0 or hdr[9] > now
+                    or hdr[4] > now + frame_bits(8) * 1000000 // hdr[2] + 1):
+                self._format()
+            self.node = self._take_slot()
+            self.rx_seq = self._hdr()[5]
+        self.rx_overruns = 0
+
+    # ---------------- internal helpers ----------------
+    def _locked(self):
+        bus = self
+
+        class _Lock:
+            def __enter__(self):
+                fcntl.flock(bus.fd, fcntl.LOCK_EX)
+
+            def __exit__(self, *exc):
+                fcntl.flock(bus.fd, fcntl.LOCK_UN)
+        return _Lock()
+
+    def _format(self):
+        bitrate = int(os.environ.get("F1_VBUS_BITRATE", VBUS_DEFAULT_BITRATE))
+        if not 0 < bitrate <= 1000000:
+            bitrate = VBUS_DEFAULT_BITRATE
+        self.mm[0:TOTAL_SIZE] = bytes(TOTAL_SIZE)
+        struct.pack_into(HDR_FMT, self.mm, 0, VBUS_MAGIC, VBUS_VERSION, bitrate,
+                         VBUS_RING_SIZE, 0, 0, 0, 0, 0, now_us())
+
+    def _hdr(self):
+        return list(struct.unpack_from(HDR_FMT, self.mm, 0))
+
+    def _node_off(self, n):
+        return HDR_SIZE + n * NODE_SIZE
+
+    def _node(self, n):
+        return list(struct.unpack_from(NODE_FMT, self.mm, self._node_off(n)))
+
+    @staticmethod
+    def _alive(pid):
+        if not pid:
+            return False
+        try:
+            os.kill(pid, 0)
+        except ProcessLookupError:
+            return False
+        except PermissionError:
+            pass
+        return True
+
+    def _reap(self):
+        """Drops the slots and queued frames of dead nodes, as bus_reap() does."""
+        for n in range(VBUS_MAX_NODES):
+            if n == getattr(self, "node", -1):
+                continue
+            node = self._node(n)
+            if node[0] and not self._alive(node[0]):
+                node[0] = 0
+                node[1] = node[2]
+                struct.pack_into(NODE_FMT, self.mm, self._node_off(n), *node)
+
+    def _take_slot(self):
+        self._reap()
+        for n in range(VBUS_MAX_NODES):
+            if not self._node(n)[0]:
+                off = self._node_off(n)
+                self.mm[off:off + NODE_SIZE] = bytes(NODE_SIZE)
+                struct.pack_into(NODE_FMT, self.mm, off, os.getpid(), 0, 0, 0, 0, 0,
+                                 b"python"[:15])
+                return n
+        raise RuntimeError("virtual CAN bus %s has no free node slot" % self.path)
+
+    def _tx_head_slot(self, n, node):
+        off = self._node_off(n) + NODE_HDR_SIZE + (node[1] % VBUS_TX_QUEUE) * SLOT_SIZE
+        return off, struct.unpack_from(SLOT_FMT, self.mm, off)
+
+    def _advance(self, now):
+        """Lazy arbitration, identical to bus_advance() in hal_can_vbus.c."""
+        self._reap()
+        hdr = self._hdr()
+        while True:
+            pending = []
+            for n in range(VBUS_MAX_NODES):
+                node = self._node(n)
+                if node[0] == 0 or node[1] == node[2]:
+                    continue
+                _, slot = self._tx_head_slot(n, node)
+                pending.append((n, node, slot))
+            if not pending:
+                break
+            start = max(hdr[4], min(p[2][1] for p in pending))
+            if start > now:
+                break
+            contenders = [p for p in pending if p[2][1] <= start]
+            n, node, slot = min(contenders, key=lambda p: (p[2][2], p[0]))
+
+            bits = frame_bits(slot[3])
+            dur = (bits * 1000000 + hdr[2] - 1) // hdr[2]
+            seq = hdr[5]
+            struct.pack_into(SLOT_FMT, self.mm, RING_OFFSET + (seq % VBUS_RING_SIZE) * SLOT_SIZE,
+                             seq, start + dur, slot[2], slot[3], n, slot[5])
+            hdr[4] = start + dur
+            hdr[5] = seq + 1
+            hdr[6] += 1
+            hdr[7] += bits
+            hdr[8] += dur
+            node[3] += 1
+            node[1] += 1
+            struct.pack_into(NODE_FMT, self.mm, self._node_off(n), *node)
+        struct.pack_into(HDR_FMT, self.mm, 0, *hdr)
+
+    # ---------------- public API ----------------
+    def send(self, msg, timeout=None):
+        data = bytes(msg.data)[:8]
+        now = now_us()
+        with self._locked():
+            self._advance(now)
+            node = self._node(self.node)
+            if node[2] - node[1] >= VBUS_TX_QUEUE:
+                node[4] += 1
+                struct.pack_into(NODE_FMT, self.mm, self._node_off(self.node), *node)
+                raise RuntimeError("virtual CAN bus TX queue full")
+            off = self._node_off(self.node) + NODE_HDR_SIZE + (node[2] % VBUS_TX_QUEUE) * SLOT_SIZE
+            struct.pack_into(SLOT_FMT, self.mm, off, 0, now, msg.arbitration_id & 0x7FF,
+                             len(data), self.node, data.ljust(8, b"\0"))
+            node[2] += 1
+            struct.pack_into(NODE_FMT, self.mm, self._node_off(self.node), *node)
+
+    def recv(self, timeout=None):
+        deadline = None if timeout is None else time.monotonic() + timeout
+        while True:
+            now = now_us()
+            with self._locked():
+                self._advance(now)
+                next_seq = self._hdr()[5]
+                if next_seq - self.rx_seq > VBUS_RING_SIZE:
+                    self.rx_overruns += next_seq - self.rx_seq - VBUS_RING_SIZE
+                    self.rx_seq = next_seq - VBUS_RING_SIZE
+                while self.rx_seq < next_seq:
+                    slot = struct.unpack_from(
+                        SLOT_FMT, self.mm, RING_OFFSET + (self.rx_seq % VBUS_RING_SIZE) * SLOT_SIZE)
+                    if slot[1] > now:
+                        break
+                    self.rx_seq += 1
+                    if slot[4] != self.node:
+                        return VirtualMessage(slot[2], slot[5][:slot[3]], slot[1] / 1e6)
+            if deadline is not None and time.monotonic() >= deadline:
+                return None
+            time.sleep(0.0005)
+
+    def stats(self):
+        """Bus statistics: dict with frames, bits, busy_us, elapsed_us, load_percent."""
+        now = now_us()
+        with self._locked():
+            self._advance(now)
+            hdr = self._hdr()
+        elapsed = max(now - hdr[9], 1)
+        return {"bitrate": hdr[2], "frames": hdr[6], "bits": hdr[7], "busy_us": hdr[8],
+                "elapsed_us": elapsed, "load_percent": 100.0 * hdr[8] / elapsed}
+
+    def shutdown(self):
+        if self.mm is not None:
+            with self._locked():
+                off = self._node_off(self.node)
+                struct.pack_into("<I", self.mm, off, 0)
+            self.mm.close()
+            self.mm = None
+        os.close(self.fd)
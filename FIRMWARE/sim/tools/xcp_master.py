@@ -0,0 +1,226 @@
+"""
+@file xcp_master.py
+@brief Minimal XCP-on-CAN master for the steering wheel (drivers/xcp.c).
+
+@details
+Reads and writes the calibration parameters and streams measurement variables
+with a DAQ list bound to the main-loop event. Works with the firmware sim
+(SocketCAN or the user-space virtual bus) and with the target through any
+SocketCAN adapter.
+
+    F1_CAN_IF=vbus:default python3 tools/xcp_master.py list
+    F1_CAN_IF=vbus:default python3 tools/xcp_master.py get clutch_tau_ms
+    F1_CAN_IF=vbus:default python3 tools/xcp_master.py set clutch_tau_ms 150
+    F1_CAN_IF=vbus:default python3 tools/xcp_master.py daq clutch_raw clutch_filt --seconds 5
+
+The variable table below mirrors AppCal_t / AppMeas_t in app_main.c
+(XCP_CAL_ADDR / XCP_MEAS_ADDR + field offset); keep them in sync.
+
+@note Standard library only with the virtual bus; python-can for SocketCAN.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+
+CRO_ID = 0x7E0
+DTO_ID = 0x7E1
+
+XCP_CAL_ADDR = 0x00010000
+XCP_MEAS_ADDR = 0x00020000
+
+# name -> (address, struct format, writable)
+VARIABLES = {
+    # AppCal_t
+    "clutch_tau_ms":     (XCP_CAL_ADDR + 0x00, "<f", True),
+    "clutch_deadband":   (XCP_CAL_ADDR + 0x04, "<H", True),
+    "clutch_min_gap_ms": (XCP_CAL_ADDR + 0x06, "<H", True),
+    "display_period_ms": (XCP_CAL_ADDR + 0x08, "<I", True),
+    "ui_period_ms":      (XCP_CAL_ADDR + 0x0C, "<I", True),
+    "debounce_count":    (XCP_CAL_ADDR + 0x10, "<B", True),
+    "telem_period_ms":   (XCP_CAL_ADDR + 0x14, "<I", True),
+    "temp_slew_c_per_s": (XCP_CAL_ADDR + 0x18, "<f", True),
+    "gear_pred_timeout_ms": (XCP_CAL_ADDR + 0x1C, "<I", True),
+    # AppMeas_t
+    "now_ms":            (XCP_MEAS_ADDR + 0x00, "<I", False),
+    "clutch_raw":        (XCP_MEAS_ADDR + 0x04, "<f", False),
+    "clutch_filt":       (XCP_MEAS_ADDR + 0x08, "<f", False),
+    "clutch_adc":        (XCP_MEAS_ADDR + 0x0C, "<H", False),
+    "rotary_adc":        (XCP_MEAS_ADDR + 0x0E, "<H", False),
+    "t1":                (XCP_MEAS_ADDR + 0x10, "<h", False),
+    "t2":                (XCP_MEAS_ADDR + 0x12, "<h", False),
+    "buttons":           (XCP_MEAS_ADDR + 0x14, "<B", False),
+    "position":          (XCP_MEAS_ADDR + 0x15, "<B", False),
+    "gear":              (XCP_MEAS_ADDR + 0x16, "<B", False),
+    "tx_reasons":        (XCP_MEAS_ADDR + 0x17, "<B", False),
+}
+
+ODT_PAYLOAD = 7     # MAX_DTO - PID
+
+
+class Frame:
+    """Outgoing frame (python-can compatible attribute names)."""
+
+    def __init__(self, data):
+        self.arbitration_id = CRO_ID
+        self.data = bytes(data)
+        self.is_extended_id = False
+
+
+class XcpError(Exception):
+    pass
+
+
+class XcpMaster:
+    def __init__(self, bus, timeout=0.5):
+        self.bus = bus
+        self.timeout = timeout
+
+    def _recv_dto(self, timeout):
+        end = time.monotonic() + timeout
+        while time.monotonic() < end:
+            msg = self.bus.recv(end - time.monotonic())
+            if msg is not None and msg.arbitration_id == DTO_ID:
+                return bytes(msg.data)
+        return None
+
+    def command(self, *cro):
+        self.bus.send(Frame(cro))
+        end = time.monotonic() + self.timeout
+        while True:
+            res = self._recv_dto(max(0.0, end - time.monotonic()))
+            if res is None:
+                raise XcpError("timeout (command 0x%02X)" % cro[0])
+            if res[0] == 0xFF:
+                return res
+            if res[0] == 0xFE:
+                raise XcpError("command 0x%02X: error 0x%02X" % (cro[0], res[1]))
+            # DAQ frame of a list still running: skip
+
+    def connect(self):
+        res = self.command(0xFF, 0x00)
+        if res[2] & 0x01:
+            raise XcpError("slave uses Motorola byte order")
+        return res
+
+    def disconnect(self):
+        self.command(0xFE)
+
+    def upload(self, addr, n):
+        res = self.command(0xF4, n, 0, 0, *struct.pack("<I", addr))
+        return res[1:1 + n]
+
+    def download(self, addr, data):
+        self.command(0xF6, 0, 0, 0, *struct.pack("<I", addr))
+        for i in range(0, len(data), 6):
+            chunk = data[i:i + 6]
+            self.command(0xF0, len(chunk), *chunk)
+
+    def setup_daq(self, entries, prescaler=1):
+        """Packs (address, size) entries into ODTs of one DAQ list; returns the PID layout."""
+        odts, cur, used = [], [], 0
+        for addr, size in entries:
+            if used + size > ODT_PAYLOAD:
+                odts.append(cur)
+                cur, used = [], 0
+            cur.append((addr, size))
+            used += size
+        odts.append(cur)
+
+        self.command(0xD6)                                     # FREE_DAQ
+        self.command(0xD5, 0, 1, 0)                            # ALLOC_DAQ: 1 list
+        self.command(0xD4, 0, 0, 0, len(odts))                 # ALLOC_ODT
+        for i, odt in enumerate(odts):
+            self.command(0xD3, 0, 0, 0, i, len(odt))           # ALLOC_ODT_ENTRY
+        for i, odt in enumerate(odts):
+            self.command(0xE2, 0, 0, 0, i, 0)                  # SET_DAQ_PTR
+            for addr, size in odt:
+                self.command(0xE1, 0xFF, size, 0, *struct.pack("<I", addr))   # WRITE_DAQ
+        self.command(0xE0, 0x00, 0, 0, 0, 0, prescaler, 0)     # SET_DAQ_LIST_MODE: event 0
+        res = self.command(0xDE, 2, 0, 0)                      # START_STOP_DAQ_LIST: select
+        self.command(0xDD, 1)                                  # START_STOP_SYNCH: start selected
+        return res[1], odts
+
+
+def open_bus():
+    channel = os.environ.get("F1_CAN_IF", "vcan0")
+    if channel.startswith("vbus:"):
+        sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+        from vbus import VirtualBus
+        return VirtualBus(channel)
+    import can
+    return can.interface.Bus(channel=channel, bustype="socketcan",
+                             can_filters=[{"can_id": DTO_ID, "can_mask": 0x7FF}])
+
+
+def main():
+    ap = argparse.ArgumentParser(description="XCP-on-CAN master for the steering wheel")
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    sub.add_parser("list")
+    p = sub.add_parser("get")
+    p.add_argument("names", nargs="+")
+    p = sub.add_parser("set")
+    p.add_argument("name")
+    p.add_argument("value")
+    p = sub.add_parser("daq")
+    p.add_argument("names", nargs="+")
+    p.add_argument("--prescaler", type=int, default=1)
+    p.add_argument("--seconds", type=float, default=5.0)
+    args = ap.parse_args()
+
+    if args.cmd == "list":
+        for name, (addr, fmt, wr) in VARIABLES.items():
+            print("%-18s 0x%08X %-3s %s" % (name, addr, fmt[1:], "cal" if wr else "meas"))
+        return
+
+    for name in getattr(args, "names", [getattr(args, "name", None)]):
+        if name not in VARIABLES:
+            sys.exit("unknown variable '%s' (see 'list')" % name)
+
+    bus = open_bus()
+    xcp = XcpMaster(bus)
+    try:
+        xcp.connect()
+        if args.cmd == "get":
+            for name in args.names:
+                addr, fmt, _ = VARIABLES[name]
+                print("%s = %s" % (name, struct.unpack(fmt, xcp.upload(addr, struct.calcsize(fmt)))[0]))
+
+        elif args.cmd == "set":
+            addr, fmt, _ = VARIABLES[args.name]
+            value = float(args.value) if fmt[1] == "f" else int(args.value, 0)
+            xcp.download(addr, struct.pack(fmt, value))
+            print("%s = %s" % (args.name, struct.unpack(fmt, xcp.upload(addr, struct.calcsize(fmt)))[0]))
+
+        elif args.cmd == "daq":
+            entries = [(VARIABLES[n][0], struct.calcsize(VARIABLES[n][1])) for n in args.names]
+            first_pid, odts = xcp.setup_daq(entries, args.prescaler)
+            names_by_addr = {VARIABLES[n][0]: n for n in args.names}
+            values, samples = {}, 0
+            end = time.monotonic() + args.seconds
+            while time.monotonic() < end:
+                dto = xcp._recv_dto(0.1)
+                if dto is None or dto[0] >= first_pid + len(odts) or dto[0] < first_pid:
+                    continue
+                odt = dto[0] - first_pid
+                pos = 1
+                for addr, size in odts[odt]:
+                    name = names_by_addr[addr]
+                    values[name] = struct.unpack(VARIABLES[name][1], dto[pos:pos + size])[0]
+                    pos += size
+                if odt == len(odts) - 1:
+                    samples += 1
+                    print("  ".join("%s=%s" % (n, values.get(n)) for n in args.names))
+            xcp.command(0xDD, 0)                               # Stop all
+            print("%d samples in %.1f s" % (samples, args.seconds))
+        xcp.disconnect()
+    except XcpError as e:
+        sys.exit("XCP: %s" % e)
+    finally:
+        bus.shutdown()
+
+
+if __name__ == "__main__":
+    main()
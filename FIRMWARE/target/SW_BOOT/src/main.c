@@ -0,0 +1,78 @@
+/*
+ * main.c - Entry point of the CAN bootloader on S32K118.
+ *
+ * The bootloader sits in the first 16 KB of the P-Flash (S32K118_25_boot.ld)
+ * and decides after every reset:
+ *  - the application asked for the programming session (hal_boot_request),
+ *    or the slot holds no valid image         -> stay and serve the tester,
+ *  - a tester sends `10 02` within 20 ms       -> stay and serve the tester,
+ *  - otherwise                                 -> start the application.
+ *
+ * Protocol, memory map and fallback: drivers/bootloader.h.
+ */
+
+#include "system_S32K118.h"
+#include "hal_wdog.h"
+#include "hal_clocks.h"
+#include "hal_uart.h"
+#include "hal_can.h"
+#include "hal_time.h"
+#include "hal_boot.h"
+#include "isotp.h"
+#include "bootloader.h"
+
+/** @brief Only the tester requests reach the bootloader. */
+static const hal_can_filter_t boot_filters[] = {
+    { ISOTP_RX_ID, HAL_CAN_STD_MASK },
+};
+
+/**
+ * @brief Main entry point of the bootloader.
+ */
+int main(void)
+{
+    BootStats_t stats;
+    uint32_t reported_ms = 0;
+
+    /* Read before anything else: the request word is cleared by the call */
+    bool requested = hal_boot_requested();
+
+    HAL_WDOG_Disable();
+    hal_time_init();                /* Timebase of the bounded FlexCAN mode waits */
+    SOSC_init_20MHz();
+    RUN_mode_48MHz();
+    SystemCoreClockUpdate();
+    HAL_UART_Init(115200);
+
+    hal_can_init("can0");
+    hal_can_set_filters(boot_filters, sizeof(boot_filters) / sizeof(boot_filters[0]));
+    boot_init();
+
+    bool valid = boot_app_valid();
+    if (!requested && valid && !boot_entry_window())
+    {
+        HAL_UART_Flush();       /* The application re-initializes the UART and its TX ring */
+        hal_can_shutdown();
+        hal_boot_jump(BOOT_APP_BASE);
+    }
+
+    HAL_UART_Printf("[BOOT] Bootloader resident (%s)\r\n",
+                    requested ? "requested by the application" : (valid ? "tester" : "no valid image"));
+
+    for (;;)
+    {
+        boot_poll();
+
+        /* One line per completed download (flashing time, for the logs) */
+        boot_getStats(&stats);
+        if (stats.elapsed_ms != 0u && stats.elapsed_ms != reported_ms)
+        {
+            reported_ms = stats.elapsed_ms;
+            HAL_UART_Printf("[BOOT] %lu bytes in %lu ms (erase %lu ms, program %lu ms)\r\n",
+                            (unsigned long)stats.bytes, (unsigned long)stats.elapsed_ms,
+                            (unsigned long)stats.erase_ms, (unsigned long)stats.program_ms);
+        }
+    }
+
+    return 0;
+}
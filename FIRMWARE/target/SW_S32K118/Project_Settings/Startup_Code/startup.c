@@ -56,6 +56,15 @@
  ******************************************************************************/
 static volatile uint32_t * const s_vectors[NUMBER_OF_CORES] = FEATURE_INTERRUPT_INT_VECTORS;
 
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+/* Word copy / clear loops with LDM/STM (16 bytes per step), in startup_S32K118.S */
+void startup_copy_words(uint32_t * dst, const uint32_t * src, const uint32_t * src_end);
+void startup_zero_words(uint32_t * start, const uint32_t * end);
+#endif
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -68,6 +77,8 @@ static volatile uint32_t * const s_vectors[NUMBER_OF_CORES] = FEATURE_INTERRUPT_
  * - Copy initialized data from ROM to RAM.
  * - Copy code that should reside in RAM from ROM
  * - Clear the zero-initialized data section.
+ * The sections are copied and cleared one 32-bit word at a time (LDM/STM
+ * blocks with GCC): the linker files align their start and end to 4 bytes.
  *
  * Tool Chains:
  *   __GNUC__           : GNU Compiler Collection
@@ -87,14 +98,14 @@ void init_data_bss(void)
 #if !defined(__ARMCC_VERSION)
     /* Declare pointers for various data sections. These pointers
      * are initialized using values pulled in from the linker file */
-    uint8_t * data_ram;
-    uint8_t * code_ram;
-    uint8_t * bss_start;
-    uint8_t * custom_ram;
-    const uint8_t * data_rom, * data_rom_end;
-    const uint8_t * code_rom, * code_rom_end;
-    const uint8_t * bss_end;
-    const uint8_t * custom_rom, * custom_rom_end;
+    uint32_t * data_ram;
+    uint32_t * code_ram;
+    uint32_t * bss_start;
+    uint32_t * custom_ram;
+    const uint32_t * data_rom, * data_rom_end;
+    const uint32_t * code_rom, * code_rom_end;
+    const uint32_t * bss_end;
+    const uint32_t * custom_rom, * custom_rom_end;
 #endif
     /* Addresses for VECTOR_TABLE and VECTOR_RAM come from the linker file */
 
@@ -150,25 +161,37 @@ void init_data_bss(void)
     extern uint32_t __CUSTOM_END[];
 
     /* Data */
-    data_ram        = (uint8_t *)__DATA_RAM;
-    data_rom        = (uint8_t *)__DATA_ROM;
-    data_rom_end    = (uint8_t *)__DATA_END;
+    data_ram        = __DATA_RAM;
+    data_rom        = __DATA_ROM;
+    data_rom_end    = __DATA_END;
     /* CODE RAM */
-    code_ram        = (uint8_t *)__CODE_RAM;
-    code_rom        = (uint8_t *)__CODE_ROM;
-    code_rom_end    = (uint8_t *)__CODE_END;
+    code_ram        = __CODE_RAM;
+    code_rom        = __CODE_ROM;
+    code_rom_end    = __CODE_END;
     /* BSS */
-    bss_start       = (uint8_t *)__BSS_START;
-    bss_end         = (uint8_t *)__BSS_END;
+    bss_start       = __BSS_START;
+    bss_end         = __BSS_END;
 
 	/* Custom section */
-    custom_ram      = CUSTOMSECTION_SECTION_START;
-    custom_rom      = (uint8_t *)__CUSTOM_ROM;
-    custom_rom_end  = (uint8_t *)__CUSTOM_END;
+    custom_ram      = (uint32_t *)CUSTOMSECTION_SECTION_START;
+    custom_rom      = __CUSTOM_ROM;
+    custom_rom_end  = __CUSTOM_END;
 
 #endif
 
-#if !defined(__ARMCC_VERSION)
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+    /* Copy initialized data from ROM to RAM */
+    startup_copy_words(data_ram, data_rom, data_rom_end);
+
+    /* Copy functions from ROM to RAM */
+    startup_copy_words(code_ram, code_rom, code_rom_end);
+
+    /* Clear the zero-initialized data section */
+    startup_zero_words(bss_start, bss_end);
+
+    /* Copy customsection rom to ram */
+    startup_copy_words(custom_ram, custom_rom, custom_rom_end);
+#elif !defined(__ARMCC_VERSION)
     /* Copy initialized data from ROM to RAM */
     while (data_rom_end != data_rom)
     {
@@ -8,6 +8,7 @@
 #include "device_registers.h"
 #include "hal_adc.h"
 #include "hal_uart.h"
+#include "hal_log.h"
 
 /* ============================================================================
  * 							ADC PIN DEFINITIONS
@@ -106,7 +107,7 @@ void hal_adc_init(void)
     /* From this moment ADC0 can receive conversions commands
      * transmit the value on SC1[0].
      */
-    HAL_UART_Printf(
+    HAL_LOG(
         "[ADC] ADC0 init: CFG1=0x%08lX CFG2=0x%08lX SC2=0x%08lX SC3=0x%08lX\r\n",
         (uint32_t)IP_ADC0->CFG1,
         (uint32_t)IP_ADC0->CFG2,
@@ -0,0 +1,14 @@
+/**
+ * @file hal_adc_port.h
+ * @brief S32K118 board ADC channels, included by hal_adc.h.
+ */
+
+#ifndef HAL_ADC_PORT_H
+#define HAL_ADC_PORT_H
+
+/* S32K118 board: PTC15 = ADC0_SE13 (clutch), PTC14 = ADC0_SE12 (rotary switch). */
+
+#define HAL_ADC_CH_CLUTCH   13u     /**< Clutch paddle potentiometer. */
+#define HAL_ADC_CH_ROTARY   12u     /**< Rotary switch resistor ladder. */
+
+#endif /* HAL_ADC_PORT_H */
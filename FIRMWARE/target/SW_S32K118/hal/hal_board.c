@@ -0,0 +1,180 @@
+/**
+ * @file hal_board.c
+ * @brief HAL implementation of the board bring-up on S32K118 (SOSC, ILI9341 panel, register dump).
+ */
+
+#include "hal_board.h"
+#include "hal_clocks.h"
+#include "hal_uart.h"
+#include "TFT_LCD.h"
+#include "device_registers.h"
+
+/*======================================================================
+ *  PUBLIC API
+ *====================================================================*/
+
+/* The SPI is clocked from SOSCDIV2: GPIO and inputs are configured while it starts */
+void hal_board_clock_start(void)
+{
+    SOSC_start_20MHz();
+}
+
+bool hal_board_clock_ready(void)
+{
+    return SOSC_isValid();
+}
+
+/* Reset and sleep-out waits of the panel overlap the rest of the boot */
+void hal_board_display_start(void)
+{
+    LCD_display9341_start();
+}
+
+bool hal_board_display_ready(void)
+{
+    return LCD_display9341_poll();
+}
+
+void hal_board_dump(void)
+{
+    HAL_UART_Printf("\r\n=================== REGISTER DUMP ===================\r\n");
+
+    /* --------------------------------------------------
+     * WDOG
+     * -------------------------------------------------- */
+    HAL_UART_Printf("[WDOG]\r\n");
+    HAL_UART_Printf("  CS     = 0x%08X\r\n", IP_WDOG->CS);
+    HAL_UART_Printf("  CNT    = 0x%08X\r\n", IP_WDOG->CNT);
+    HAL_UART_Printf("  TOVAL  = 0x%08X\r\n", IP_WDOG->TOVAL);
+
+    /* --------------------------------------------------
+     * CLOCKS (SCG)
+     * -------------------------------------------------- */
+    HAL_UART_Printf("\r\n[SCG]\r\n");
+    HAL_UART_Printf("  CSR     = 0x%08X\r\n", IP_SCG->CSR);
+    HAL_UART_Printf("  RCCR    = 0x%08X\r\n", IP_SCG->RCCR);
+    HAL_UART_Printf("  SOSCCSR = 0x%08X\r\n", IP_SCG->SOSCCSR);
+    HAL_UART_Printf("  SOSCDIV = 0x%08X\r\n", IP_SCG->SOSCDIV);
+    HAL_UART_Printf("  SOSCCFG = 0x%08X\r\n", IP_SCG->SOSCCFG);
+    HAL_UART_Printf("  FIRCCSR = 0x%08X\r\n", IP_SCG->FIRCCSR);
+    HAL_UART_Printf("  FIRCDIV = 0x%08X\r\n", IP_SCG->FIRCDIV);
+    //HAL_UART_Printf("  FIRCCTL = 0x%08X\r\n", IP_SCG->FIRCCTL);
+    HAL_UART_Printf("  SIRCDIV = 0x%08X\r\n", IP_SCG->SIRCDIV);
+
+    /* --------------------------------------------------
+     * PCC (Clock gating)
+     * -------------------------------------------------- */
+    HAL_UART_Printf("\r\n[PCC]\r\n");
+    HAL_UART_Printf("  PCC_PORTA    = 0x%08X\r\n", IP_PCC->PCCn[PCC_PORTA_INDEX]);
+    HAL_UART_Printf("  PCC_PORTB    = 0x%08X\r\n", IP_PCC->PCCn[PCC_PORTB_INDEX]);
+    HAL_UART_Printf("  PCC_PORTC    = 0x%08X\r\n", IP_PCC->PCCn[PCC_PORTC_INDEX]);
+    HAL_UART_Printf("  PCC_LPUART0  = 0x%08X\r\n", IP_PCC->PCCn[PCC_LPUART0_INDEX]);
+    HAL_UART_Printf("  PCC_LPSPI0   = 0x%08X\r\n", IP_PCC->PCCn[PCC_LPSPI0_INDEX]);
+    HAL_UART_Printf("  PCC_ADC0     = 0x%08X\r\n", IP_PCC->PCCn[PCC_ADC0_INDEX]);
+    HAL_UART_Printf("  PCC_FlexCAN0 = 0x%08X\r\n", IP_PCC->PCCn[PCC_FlexCAN0_INDEX]);
+
+    /* --------------------------------------------------
+     * PORT MUX (PCR) – PINs
+     * -------------------------------------------------- */
+    HAL_UART_Printf("\r\n[PORTA PCR 0..16]\r\n");
+    for (int i = 0; i <= 16; i++) {
+        HAL_UART_Printf("  PORTA->PCR[%2d] = 0x%08X\r\n", i, IP_PORTA->PCR[i]);
+    }
+
+    HAL_UART_Printf("\r\n[PORTB PCR 0..16]\r\n");
+    for (int i = 0; i <= 16; i++) {
+        HAL_UART_Printf("  PORTB->PCR[%2d] = 0x%08X\r\n", i, IP_PORTB->PCR[i]);
+    }
+
+    HAL_UART_Printf("\r\n[PORTC PCR 0..16]\r\n");
+    for (int i = 0; i <= 16; i++) {
+        HAL_UART_Printf("  PORTC->PCR[%2d] = 0x%08X\r\n", i, IP_PORTC->PCR[i]);
+    }
+
+    /* It is posible to check:
+     * - PTA2/PTA3 -> UART (MUX=6)
+     * - PTB0 -> TFT_CS (MUX=1)
+     * - PTB3/PTB4 -> btns, etc.
+     * - PTC8/PTC9 -> TFT DC/RST (MUX=1)
+     * - PTC14/PTC15 -> ADC (MUX=0)
+     * - PTC2/PTC3 -> CAN (MUX=3)
+     */
+
+    /* --------------------------------------------------
+     * GPIO DIRECTIONS (LEDs, TFT, Buttons)
+     * -------------------------------------------------- */
+    HAL_UART_Printf("\r\n[GPIOA]\r\n");
+    HAL_UART_Printf("  PDOR = 0x%08X\r\n", IP_PTA->PDOR);
+    HAL_UART_Printf("  PDIR = 0x%08X\r\n", IP_PTA->PDIR);
+    HAL_UART_Printf("  PDDR = 0x%08X\r\n", IP_PTA->PDDR);
+
+    HAL_UART_Printf("\r\n[GPIOB]\r\n");
+    HAL_UART_Printf("  PDOR = 0x%08X\r\n", IP_PTB->PDOR);
+    HAL_UART_Printf("  PDIR = 0x%08X\r\n", IP_PTB->PDIR);
+    HAL_UART_Printf("  PDDR = 0x%08X\r\n", IP_PTB->PDDR);
+
+    HAL_UART_Printf("\r\n[GPIOC]\r\n");
+    HAL_UART_Printf("  PDOR = 0x%08X\r\n", IP_PTC->PDOR);
+    HAL_UART_Printf("  PDIR = 0x%08X\r\n", IP_PTC->PDIR);
+    HAL_UART_Printf("  PDDR = 0x%08X\r\n", IP_PTC->PDDR);
+
+    /* --------------------------------------------------
+     * LPUART0
+     * -------------------------------------------------- */
+    HAL_UART_Printf("\r\n[LPUART0]\r\n");
+    HAL_UART_Printf("  BAUD   = 0x%08X\r\n", IP_LPUART0->BAUD);
+    HAL_UART_Printf("  CTRL   = 0x%08X\r\n", IP_LPUART0->CTRL);
+    HAL_UART_Printf("  STAT   = 0x%08X\r\n", IP_LPUART0->STAT);
+
+    /* --------------------------------------------------
+     * LPSPI0
+     * -------------------------------------------------- */
+    HAL_UART_Printf("\r\n[LPSPI0]\r\n");
+    HAL_UART_Printf("  CR     = 0x%08X\r\n", IP_LPSPI0->CR);
+    HAL_UART_Printf("  SR     = 0x%08X\r\n", IP_LPSPI0->SR);
+    HAL_UART_Printf("  IER    = 0x%08X\r\n", IP_LPSPI0->IER);
+    HAL_UART_Printf("  DER    = 0x%08X\r\n", IP_LPSPI0->DER);
+    HAL_UART_Printf("  CFGR0  = 0x%08X\r\n", IP_LPSPI0->CFGR0);
+    HAL_UART_Printf("  CFGR1  = 0x%08X\r\n", IP_LPSPI0->CFGR1);
+    HAL_UART_Printf("  TCR    = 0x%08X\r\n", IP_LPSPI0->TCR);
+    HAL_UART_Printf("  CCR    = 0x%08X\r\n", IP_LPSPI0->CCR);
+
+    /* --------------------------------------------------
+     * ADC0
+     * -------------------------------------------------- */
+    HAL_UART_Printf("\r\n[ADC0]\r\n");
+    HAL_UART_Printf("  SC1[0] = 0x%08X\r\n", IP_ADC0->SC1[0]);
+    HAL_UART_Printf("  CFG1   = 0x%08X\r\n", IP_ADC0->CFG1);
+    HAL_UART_Printf("  CFG2   = 0x%08X\r\n", IP_ADC0->CFG2);
+    HAL_UART_Printf("  SC2    = 0x%08X\r\n", IP_ADC0->SC2);
+    HAL_UART_Printf("  SC3    = 0x%08X\r\n", IP_ADC0->SC3);
+
+    /* --------------------------------------------------
+     * FLEXCAN0
+     * -------------------------------------------------- */
+    HAL_UART_Printf("\r\n[FLEXCAN0]\r\n");
+    HAL_UART_Printf("  MCR     = 0x%08X\r\n", IP_FLEXCAN0->MCR);
+    HAL_UART_Printf("  CTRL1   = 0x%08X\r\n", IP_FLEXCAN0->CTRL1);
+    HAL_UART_Printf("  ECR     = 0x%08X\r\n", IP_FLEXCAN0->ECR);
+    HAL_UART_Printf("  ESR1    = 0x%08X\r\n", IP_FLEXCAN0->ESR1);
+    HAL_UART_Printf("  IMASK1  = 0x%08X\r\n", IP_FLEXCAN0->IMASK1);
+    HAL_UART_Printf("  IFLAG1  = 0x%08X\r\n", IP_FLEXCAN0->IFLAG1);
+    HAL_UART_Printf("  RXMGMASK= 0x%08X\r\n", IP_FLEXCAN0->RXMGMASK);
+
+    HAL_UART_Printf("\r\n================= END REGISTER DUMP =================\r\n\r\n");
+}
+
+/* The main loop runs until reset: no events, the panel is written directly */
+void hal_board_poll(int *running)
+{
+    (void)running;
+}
+
+void hal_board_present(void)
+{
+}
+
+/* The slot wait is a busy bus poll: the next ISO-TP flow control leaves early */
+void hal_board_idle(void)
+{
+}
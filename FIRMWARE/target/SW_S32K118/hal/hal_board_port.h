@@ -0,0 +1,13 @@
+/**
+ * @file hal_board_port.h
+ * @brief S32K118 board settings, included by hal_board.h.
+ */
+
+#ifndef HAL_BOARD_PORT_H
+#define HAL_BOARD_PORT_H
+
+#define HAL_BOARD_LCD_FITTED    0       /**< 1 when the ILI9341 panel is fitted. */
+#define HAL_BOARD_TP_BUF_SIZE   1024u   /**< SRAM: a layout is downloaded in blocks of 1022 bytes. */
+#define HAL_BOARD_UI_PERIOD_MS  0u      /**< Text page off: the telemetry stream carries the same values. */
+
+#endif /* HAL_BOARD_PORT_H */
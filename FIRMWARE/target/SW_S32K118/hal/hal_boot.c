@@ -0,0 +1,53 @@
+/**
+ * @file hal_boot.c
+ * @brief HAL implementation for the bootloader handover on S32K118.
+ */
+
+#include "hal_boot.h"
+#include "device_registers.h"
+
+/* Last word of SRAM_L (m_custom): neither the ECC RAM init nor init_data_bss touch it */
+#define BOOT_REQUEST_ADDR   0x1FFFFFFCu
+#define BOOT_REQUEST_MAGIC  0xB0070AD5u
+
+#define BOOT_REQUEST_WORD   (*(volatile uint32_t *)BOOT_REQUEST_ADDR)
+
+/*======================================================================
+ *  PUBLIC API
+ *====================================================================*/
+
+void hal_boot_request(void)
+{
+    DISABLE_INTERRUPTS();
+    BOOT_REQUEST_WORD = BOOT_REQUEST_MAGIC;
+
+    /* Software reset: RCM_SRS[SW] tells the bootloader the word is valid */
+    S32_SCB->AIRCR = S32_SCB_AIRCR_VECTKEY(0x5FAu) | S32_SCB_AIRCR_SYSRESETREQ_MASK;
+    for (;;) {}
+}
+
+bool hal_boot_requested(void)
+{
+    /* After power-on the word is random (and its ECC not initialized): only read it after a SW reset */
+    bool requested = ((IP_RCM->SRS & RCM_SRS_SW_MASK) != 0u) &&
+                     (BOOT_REQUEST_WORD == BOOT_REQUEST_MAGIC);
+
+    BOOT_REQUEST_WORD = 0u;     /* 32-bit write also initializes the ECC */
+    return requested;
+}
+
+void hal_boot_jump(uint32_t base)
+{
+    const volatile uint32_t *vectors = (const volatile uint32_t *)(uintptr_t)base;
+    uint32_t sp = vectors[0];
+    uint32_t pc = vectors[1];
+
+    DISABLE_INTERRUPTS();
+    S32_SCB->VTOR = base;
+
+    /* The application startup masks interrupts again and reloads SP from its linker symbols */
+    __asm volatile ("msr msp, %0\n\t"
+                    "bx  %1"
+                    : : "r" (sp), "r" (pc) : "memory");
+    for (;;) {}
+}
@@ -1,7 +1,11 @@
 #include "hal_can.h"
 #include "device_registers.h"
 #include <stddef.h>
+#include <stdbool.h>
 #include "hal_uart.h"
+#include "hal_log.h"
+#include "hal_ramfunc.h"
+#include "hal_time.h"
 
 
 
@@ -10,13 +14,124 @@
 #define CAN_TX_PIN 	3
 
 #define MSG_BUF_SIZE  4		/* Msg Buffer Size. (CAN 2.0AB: 1 Cfg + 1 ID + 2 data= 4 words) */
-#define TX_MB_IDX  0
-#define RX_MB_IDX  1
+#define RX_MB_FIRST  1		/* RX mailboxes MB1..MB7: one per acceptance filter */
+#define TX_MB_FIRST  8		/* TX mailboxes MB8..MB15: one per queued frame of a batch */
+#define TX_MB_COUNT  8
+
+#define MB_CODE(cs)      (((cs) >> 24) & 0x0F)
+#define MB_CODE_TX_INACT 0x8
+#define MB_CODE_TX_DATA  0xC
+#define MB_CODE_RX_OVERRUN 0x6	/* RX mailbox overwritten before it was read */
+
+#define CAN_BITRATE  500000u	/* Nominal bit-rate programmed in CTRL1 */
+#define CAN_US_PER_BIT  (1000000u / CAN_BITRATE)	/* TIMER tick in µs (2 µs at 500 kbit/s) */
+#define CAN_SHUTDOWN_DRAIN_US 5000u	/* Longest wait for pending TX mailboxes in hal_can_shutdown */
+#define CAN_MODE_TIMEOUT_US   2000u	/* Longest wait for a freeze / ready acknowledge (a frame in progress ends first) */
+
+/* ESR1 error flags (cleared by reading ESR1) */
+#define ESR1_TX_ERRORS  (FLEXCAN_ESR1_ACKERR_MASK | FLEXCAN_ESR1_BIT0ERR_MASK | FLEXCAN_ESR1_BIT1ERR_MASK)
+#define ESR1_RX_ERRORS  (FLEXCAN_ESR1_CRCERR_MASK | FLEXCAN_ESR1_FRMERR_MASK | FLEXCAN_ESR1_STFERR_MASK)
+
+#define RX_MB_FLAGS  (((1UL << HAL_CAN_MAX_FILTERS) - 1UL) << RX_MB_FIRST)
+
+#define RX_STASH_SIZE  64u	/* Frames kept by hal_can_rx_stash() (power of two) */
+
+#define NVIC_ISER  (*(volatile uint32_t *)0xE000E100u)
+#define NVIC_ICER  (*(volatile uint32_t *)0xE000E180u)
+#define NVIC_ICPR  (*(volatile uint32_t *)0xE000E280u)
+
+/* Raw mailbox words of a frame moved out by hal_can_rx_stash() */
+typedef struct {
+    uint32_t cs;
+    uint32_t id;
+    uint32_t w0;
+    uint32_t w1;
+    uint32_t bit_time;	/* Reception time in the extended timebase, taken when stashed */
+} can_raw_mb_t;
+
+/* Frames moved out of the RX mailboxes by the MB interrupt (or while the flash is busy) */
+static can_raw_mb_t rx_stash[RX_STASH_SIZE];
+static volatile uint8_t rx_stash_head = 0;
+static volatile uint8_t rx_stash_tail = 0;
+
+/* Health and traffic counters returned by hal_can_get_stats() */
+static hal_can_stats_t can_stats;
+/* TIMER value and hal_time_us() at the previous can_timer_extend() call (TIMER: 16-bit, one tick per bit time) */
+static uint16_t timer_last = 0;
+static uint32_t timer_last_us = 0;
+
+/* Extends the 16-bit TIMER into can_stats.bit_time; returns the TIMER value read.
+ * The TIMER wraps every 131 ms; a caller blocked longer (a full-screen draw takes
+ * ~0.8 s) misses whole periods, which the free-running hal_time_us() clock puts
+ * back: the periods added are those that bring the TIMER delta nearest to the
+ * elapsed µs (exact while the two clocks drift apart by less than half a period).
+ * The RX interrupt calls it too, so thread-mode callers mask interrupts around it.
+ * Reading TIMER also unlocks a mailbox locked by a CS read. Runs from RAM: the
+ * stash calls it while the flash is busy (a sector erase lasts up to ~130 ms). */
+HAL_RAMFUNC
+static uint16_t can_timer_extend(void)
+{
+    uint16_t timer_now = (uint16_t)IP_FLEXCAN0->TIMER;
+    uint32_t now_us = hal_time_us();
+    uint32_t ticks = (uint16_t)(timer_now - timer_last);
+    uint32_t expect = (now_us - timer_last_us) / CAN_US_PER_BIT;
+
+    if (expect > ticks)
+    {
+        ticks += (expect - ticks + 0x8000u) & 0xFFFF0000u;     /* Whole TIMER periods missed */
+    }
+    can_stats.bit_time += ticks;
+    timer_last = timer_now;
+    timer_last_us = now_us;
+    return timer_now;
+}
+
+/* Masks interrupts (the RX interrupt shares the stash and the timebase); returns the previous PRIMASK */
+static inline uint32_t can_lock(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+    DISABLE_INTERRUPTS();
+    return primask;
+}
+
+static inline void can_unlock(uint32_t primask)
+{
+    if (primask == 0u) ENABLE_INTERRUPTS();
+}
+
+/* Waits until the MCR bits in mask equal value; false after CAN_MODE_TIMEOUT_US
+ * (no CAN clock, module held in reset), instead of hanging the boot */
+static bool can_wait_mcr(uint32_t mask, uint32_t value)
+{
+    uint32_t t0 = hal_time_us();
+
+    while ((IP_FLEXCAN0->MCR & mask) != value)
+    {
+        if ((hal_time_us() - t0) > CAN_MODE_TIMEOUT_US) return false;
+    }
+    return true;
+}
+
+/* Puts FlexCAN in freeze mode (configuration allowed) */
+static bool can_enter_freeze(void)
+{
+    IP_FLEXCAN0->MCR |= (FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK);
+    return can_wait_mcr(FLEXCAN_MCR_FRZACK_MASK, FLEXCAN_MCR_FRZACK_MASK);
+}
+
+/* Leaves freeze mode and waits for the module to be ready (it then synchronizes to the bus) */
+static bool can_exit_freeze(void)
+{
+    IP_FLEXCAN0->MCR &= ~(FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK);
+    return can_wait_mcr(FLEXCAN_MCR_FRZACK_MASK, 0u) && can_wait_mcr(FLEXCAN_MCR_NOTRDY_MASK, 0u);
+}
 
 int hal_can_init(const char* interface_name)
 {
     (void)interface_name;
-    HAL_UART_Printf("CAN init: 1-\r\n");
+    HAL_LOG("CAN init: 1-\r\n");
 
     /* 1. Config PIN */
     IP_PCC->PCCn[PCC_PORTC_INDEX] |= PCC_PCCn_CGC_MASK;
@@ -24,14 +139,14 @@ int hal_can_init(const char* interface_name)
     CAN_PORT->PCR[CAN_RX_PIN] |= PORT_PCR_MUX(3);
     CAN_PORT->PCR[CAN_TX_PIN] &= ~PORT_PCR_MUX_MASK;
     CAN_PORT->PCR[CAN_TX_PIN] |= PORT_PCR_MUX(3);
-    HAL_UART_Printf("CAN init: 2- Mux PIN\r\n");
+    HAL_LOG("CAN init: 2- Mux PIN\r\n");
 
 
     /* ==== 2. Select CAN Clock Source (48 MHz bus clock) ==== */
     IP_PCC->PCCn[PCC_FlexCAN0_INDEX] &= ~PCC_PCCn_PCS_MASK;
     IP_PCC->PCCn[PCC_FlexCAN0_INDEX] |=  PCC_PCCn_PCS(0b00);   // Bus clock (48MHz)
     IP_PCC->PCCn[PCC_FlexCAN0_INDEX] |=  PCC_PCCn_CGC_MASK;    // Enable clock
-    HAL_UART_Printf("PCC CAN = 0x%08X\r\n", IP_PCC->PCCn[PCC_FlexCAN0_INDEX]);
+    HAL_LOG("PCC CAN = 0x%08X\r\n", IP_PCC->PCCn[PCC_FlexCAN0_INDEX]);
 
 
     /* ==== 3. Disable module before changing CLKSRC ==== */
@@ -39,11 +154,15 @@ int hal_can_init(const char* interface_name)
     IP_FLEXCAN0->CTRL1 |= FLEXCAN_CTRL1_CLKSRC_MASK; 	// CLKSRC=1 → SYSCLK = 48MHz
     IP_FLEXCAN0->MCR &= ~FLEXCAN_MCR_MDIS_MASK;      	// Enable module (FRZ+HALT set)
 
-    HAL_UART_Printf("CAN init: 3-MDIS cleared\r\n");
+    HAL_LOG("CAN init: 3-MDIS cleared\r\n");
 
     /* Wait for freeze acknowledge */
-    while (!(IP_FLEXCAN0->MCR & FLEXCAN_MCR_FRZACK_MASK)) {}
-    HAL_UART_Printf("CAN init: 4-FRZACK=1\r\n");
+    if (!can_wait_mcr(FLEXCAN_MCR_FRZACK_MASK, FLEXCAN_MCR_FRZACK_MASK))
+    {
+        HAL_LOG("CAN init: FRZACK timeout, MCR=0x%08X\r\n", IP_FLEXCAN0->MCR);
+        return -3;
+    }
+    HAL_LOG("CAN init: 4-FRZACK=1\r\n");
 
     /* ==== 4. Configure Bit Timing for 48 MHz → 500 kbps ==== */
         /*
@@ -77,7 +196,7 @@ int hal_can_init(const char* interface_name)
             | FLEXCAN_CTRL1_PSEG2(1)         /* 2 TQ   (1+1) */
             | FLEXCAN_CTRL1_RJW(0);          /* SJW = 1 TQ (0+1) - Resync jump width */
 
-        HAL_UART_Printf("CAN init: 6-CTRL1 set for 500k 87.5%%\r\n");
+        HAL_LOG("CAN init: 6-CTRL1 set for 500k 87.5%%\r\n");
     // --- REFERENCE: Bit timing para FlexCAN0 con F_CAN = 20 MHz, 500 kbit/s ---
     // if it is use CAN a with a soource of 20 MHz:
     //
@@ -89,18 +208,19 @@ int hal_can_init(const char* interface_name)
     //     | FLEXCAN_CTRL1_RJW(1)       // RJW = 1 (2 TQ)
     //     | FLEXCAN_CTRL1_SMP(1)       // triple sampling
 
-    HAL_UART_Printf("CAN init: 6-CTRL1 set\r\n");
+    HAL_LOG("CAN init: 6-CTRL1 set\r\n");
 
     /* Configuration of the quantity of mailboxes (0..15 → 16 MBs) */
     IP_FLEXCAN0->MCR &= ~FLEXCAN_MCR_MAXMB_MASK;
-    IP_FLEXCAN0->MCR |= FLEXCAN_MCR_MAXMB(15); // actually we are using 2 MB (1 Tx_MB y 1 RX_MB)
+    IP_FLEXCAN0->MCR |= FLEXCAN_MCR_MAXMB(15); // MB1..7 RX (filters), MB8..15 TX
+    IP_FLEXCAN0->MCR |= FLEXCAN_MCR_IRMQ_MASK;  // Individual RX masks (RXIMR) per mailbox
 
     /* ==== 5. Clear RAM ==== */
     for(int i = 0; i < 128; i++)
     {
     	IP_FLEXCAN0->RAMn[i] = 0;
     }
-    HAL_UART_Printf("CAN init: 7-RAM cleared\r\n");
+    HAL_LOG("CAN init: 7-RAM cleared\r\n");
 
     /* Accept all IDs DON'T CARE */
     for(int i = 0; i < 16; i++)
@@ -108,113 +228,325 @@ int hal_can_init(const char* interface_name)
     	IP_FLEXCAN0->RXIMR[i] = 0x00000000;
     }
 
-    HAL_UART_Printf("CAN init: 8-Masks set\r\n");
+    HAL_LOG("CAN init: 8-Masks set\r\n");
 
 
     IP_FLEXCAN0->RXMGMASK = 0x00000000;					/* Global acceptance mask: Don't check check all ID bits 	*/
 
     /* ==== 6. Configure RX Mailbox (MB1) ==== */
-    IP_FLEXCAN0->RAMn[RX_MB_IDX * MSG_BUF_SIZE+ 0] = 0x04000000;  // RX, CODE=4
-    IP_FLEXCAN0->RAMn[RX_MB_IDX * MSG_BUF_SIZE + 1] = 0x00000000; // ID = 0; the mask 0, it accept all the IDs
+    /* Until hal_can_set_filters() is called MB1 accepts every ID */
+    IP_FLEXCAN0->RAMn[RX_MB_FIRST * MSG_BUF_SIZE+ 0] = 0x04000000;  // RX, CODE=4
+    IP_FLEXCAN0->RAMn[RX_MB_FIRST * MSG_BUF_SIZE + 1] = 0x00000000; // ID = 0; the mask 0, it accept all the IDs
 
-    HAL_UART_Printf("CAN init: 9-RX MB configured\r\n");
+    HAL_LOG("CAN init: 9-RX MB configured\r\n");
 
-    /* ==== 7. Configure TX Mailbox (MB0) ==== */
-    IP_FLEXCAN0->RAMn[TX_MB_IDX * MSG_BUF_SIZE] = 0x08000000;      // INACTIVE
-    HAL_UART_Printf("CAN init: 10-TX MB configured\r\n");
+    /* ==== 7. Configure TX Mailboxes (MB8..MB15) ==== */
+    for(int i = 0; i < TX_MB_COUNT; i++)
+    {
+    	IP_FLEXCAN0->RAMn[(TX_MB_FIRST + i) * MSG_BUF_SIZE] = 0x08000000;      // INACTIVE
+    }
+    HAL_LOG("CAN init: 10-TX MB configured\r\n");
 
     /* ==== 8. Exit freeze ==== */
-    IP_FLEXCAN0->MCR &= ~(FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK);
+    /* Good practice: wait for FRZACK to clear (not in freeze mode) and NOTRDY to clear (module ready) */
+    if (!can_exit_freeze())
+    {
+        HAL_LOG("CAN init: not ready, MCR=0x%08X\r\n", IP_FLEXCAN0->MCR);
+        return -3;
+    }
+    HAL_LOG("CAN init: 11-READY\r\n");
+
+    /* Statistics start from a clean state and the current TIMER value */
+    can_stats = (hal_can_stats_t){0};
+    can_stats.bitrate = CAN_BITRATE;
+    timer_last = (uint16_t)IP_FLEXCAN0->TIMER;
+    timer_last_us = hal_time_us();
+    (void)IP_FLEXCAN0->ESR1;                        /* Discard error flags raised during init */
+    IP_FLEXCAN0->ESR1 = FLEXCAN_ESR1_BOFFINT_MASK;
+
+    /* RX mailboxes drained by interrupt: a burst (ISO-TP block, BS=8 STmin=0) on one ID
+     * would overrun its single mailbox while the application runs the slot body */
+    rx_stash_tail = rx_stash_head;
+    IP_FLEXCAN0->IMASK1 = RX_MB_FLAGS;
+    NVIC_ICPR = 1uL << CAN0_ORed_0_31_MB_IRQn;
+    NVIC_ISER = 1uL << CAN0_ORed_0_31_MB_IRQn;
 
-    //while ((IP_FLEXCAN0->MCR && FLEXCAN_MCR_FRZACK_MASK) >> FLEXCAN_MCR_FRZACK_SHIFT)  {}
-      /* Good practice: wait for FRZACK to clear (not in freeze mode) */
+    return 0;
+}
 
-    //while ((IP_FLEXCAN0->MCR && FLEXCAN_MCR_NOTRDY_MASK) >> FLEXCAN_MCR_NOTRDY_SHIFT)  {}
-    	/* Good practice: wait for NOTRDY to clear (module ready) */
 
-    while (IP_FLEXCAN0->MCR & FLEXCAN_MCR_FRZACK_MASK) {}
-    while (IP_FLEXCAN0->MCR & FLEXCAN_MCR_NOTRDY_MASK) {}
-    HAL_UART_Printf("CAN init: 11-READY\r\n");
 
-    return 0;
+int hal_can_set_filters(const hal_can_filter_t* filters, uint8_t count)
+{
+    if (count > HAL_CAN_MAX_FILTERS || (count > 0 && filters == NULL)) return -1;
+
+    if (!can_enter_freeze())
+    {
+        (void)can_exit_freeze();        /* Withdraw the request: the filters stay as they were */
+        return -3;
+    }
+
+    for (uint8_t i = 0; i < HAL_CAN_MAX_FILTERS; i++)
+    {
+        uint32_t mb = RX_MB_FIRST + i;
+
+        if (i < count)
+        {
+            /* Standard ID lives in bits 28..18 of both the ID word and RXIMR */
+            IP_FLEXCAN0->RXIMR[mb] = (filters[i].mask & HAL_CAN_STD_MASK) << 18;
+            IP_FLEXCAN0->RAMn[mb * MSG_BUF_SIZE + 1] = (filters[i].id & HAL_CAN_STD_MASK) << 18;
+            IP_FLEXCAN0->RAMn[mb * MSG_BUF_SIZE + 0] = 0x04000000;  // RX, CODE=4 (Empty)
+        }
+        else if (i == 0)
+        {
+            /* No filters: MB1 accepts every ID */
+            IP_FLEXCAN0->RXIMR[mb] = 0x00000000;
+            IP_FLEXCAN0->RAMn[mb * MSG_BUF_SIZE + 1] = 0x00000000;
+            IP_FLEXCAN0->RAMn[mb * MSG_BUF_SIZE + 0] = 0x04000000;
+        }
+        else
+        {
+            IP_FLEXCAN0->RAMn[mb * MSG_BUF_SIZE + 0] = 0x00000000;  // CODE=0 (Inactive)
+        }
+    }
+    uint32_t primask = can_lock();
+    IP_FLEXCAN0->IFLAG1 = RX_MB_FLAGS;  // Discard frames received under the old set
+    rx_stash_tail = rx_stash_head;
+    IP_FLEXCAN0->IMASK1 = RX_MB_FLAGS;
+    can_unlock(primask);
+
+    return can_exit_freeze() ? 0 : -3;
 }
 
+int hal_can_send_frames(const hal_can_frame_t* frames, uint8_t count)
+{
+    uint8_t sent = 0;
 
+    for (uint32_t mb = TX_MB_FIRST; mb < TX_MB_FIRST + TX_MB_COUNT && sent < count; mb++)
+    {
+        /* A TX mailbox is free once the FlexCAN has set it back to INACTIVE */
+        if (MB_CODE(IP_FLEXCAN0->RAMn[mb * MSG_BUF_SIZE]) != MB_CODE_TX_INACT) continue;
+
+        const hal_can_frame_t* f = &frames[sent];
+        if (f->len > 8) return -1;
+
+        /* 1. Write the ID (Standard 11-bit << 18) */
+        IP_FLEXCAN0->RAMn[mb*MSG_BUF_SIZE + 1] = (f->id << 18);
+
+        /* 2. Prepare data of 2word=4Bytes=32-bit */
+        uint32_t data_word0 = 0;
+        uint32_t data_word1 = 0;
+
+        if(f->len > 0) data_word0 |= ((uint32_t)f->data[0] << 24);
+        if(f->len > 1) data_word0 |= ((uint32_t)f->data[1] << 16);
+        if(f->len > 2) data_word0 |= ((uint32_t)f->data[2] << 8);
+        if(f->len > 3) data_word0 |= ((uint32_t)f->data[3]);
+
+        if(f->len > 4) data_word1 |= ((uint32_t)f->data[4] << 24);
+        if(f->len > 5) data_word1 |= ((uint32_t)f->data[5] << 16);
+        if(f->len > 6) data_word1 |= ((uint32_t)f->data[6] << 8);
+        if(f->len > 7) data_word1 |= ((uint32_t)f->data[7]);
+
+        IP_FLEXCAN0->RAMn[mb*MSG_BUF_SIZE + 2] = data_word0;
+        IP_FLEXCAN0->RAMn[mb*MSG_BUF_SIZE + 3] = data_word1;
+#ifdef CAN_DEBUG_TX
+        HAL_LOG(" [CAN TX] Sending ID=%03X, len=%u\r\n", f->id, f->len);
+#endif
+
+        /* 3. Activate the Transmission: Code=0xC, DLC=len */
+        IP_FLEXCAN0->RAMn[mb*MSG_BUF_SIZE + 0] = ((uint32_t)MB_CODE_TX_DATA << 24) | ((uint32_t)f->len << 16);
+        can_stats.tx_bits += hal_can_frame_bits(f->len);
+        sent++;
+    }
+
+    can_stats.tx_frames  += sent;
+    can_stats.tx_dropped += (uint32_t)(count - sent);  /* All TX mailboxes busy */
+    return sent;
+}
+
+int hal_can_tx_free(void)
+{
+    int free_mb = 0;
+
+    for (uint32_t mb = TX_MB_FIRST; mb < TX_MB_FIRST + TX_MB_COUNT; mb++)
+    {
+        if (MB_CODE(IP_FLEXCAN0->RAMn[mb * MSG_BUF_SIZE]) == MB_CODE_TX_INACT) {
+            free_mb++;
+        } else if (free_mb > 0) {
+            return 0;   /* A hole below a pending mailbox would be filled first and overtake it */
+        }
+    }
+    return free_mb;
+}
 
-/* ... (Le funzioni hal_can_send, receive, shutdown restano uguali) ... */
-/* INCOLLA QUI SOTTO IL RESTO DEL FILE ORIGINALE SE NECESSARIO */
 int hal_can_send(uint32_t id, const uint8_t* data, uint8_t len)
 {
     if (len > 8) return -1;
 
-    /* 1. Prepare Buffer: Code=8 (Inactive) for write secure */
-    IP_FLEXCAN0->RAMn[TX_MB_IDX*MSG_BUF_SIZE + 0] = 0x08000000;
-
-    /* 2. Write the ID (Standard 11-bit << 18) */
-    IP_FLEXCAN0->RAMn[TX_MB_IDX*MSG_BUF_SIZE + 1] = (id << 18);
+    hal_can_frame_t frame;
+    frame.id = id;
+    frame.len = len;
+    for (uint8_t i = 0; i < len; i++) frame.data[i] = data[i];
+    frame.timestamp_us = 0;
 
-    /* Prepare data of 2word=4Bytes=32-bit */
-    uint32_t data_word0 = 0;
-    uint32_t data_word1 = 0;
+    return (hal_can_send_frames(&frame, 1) == 1) ? 0 : -2;  // -2: all TX mailboxes busy
+}
 
-    if(len > 0) data_word0 |= ((uint32_t)data[0] << 24);
-    if(len > 1) data_word0 |= ((uint32_t)data[1] << 16);
-    if(len > 2) data_word0 |= ((uint32_t)data[2] << 8);
-    if(len > 3) data_word0 |= ((uint32_t)data[3]);
+/* Runs from RAM: no calls into flash code (the flash may be busy).
+ * Called by the MB interrupt and, interrupts masked, by flash_run() and hal_can_receive_frame() */
+HAL_RAMFUNC
+void hal_can_rx_stash(void)
+{
+    /* Keeps the timebase extended during a long flash command, frames or not */
+    (void)can_timer_extend();
 
-    if(len > 4) data_word1 |= ((uint32_t)data[4] << 24);
-    if(len > 5) data_word1 |= ((uint32_t)data[5] << 16);
-    if(len > 6) data_word1 |= ((uint32_t)data[6] << 8);
-    if(len > 7) data_word1 |= ((uint32_t)data[7]);
+    uint32_t pending = IP_FLEXCAN0->IFLAG1 & RX_MB_FLAGS;
 
-    IP_FLEXCAN0->RAMn[TX_MB_IDX*MSG_BUF_SIZE + 2] = data_word0;
-    IP_FLEXCAN0->RAMn[TX_MB_IDX*MSG_BUF_SIZE + 3] = data_word1;
-    HAL_UART_Printf(" [CAN TX] Sending ID=%03X, len=%u\r\n",id,len);
-    /* 4. Activate the Transmission: Code=0xC, DLC=len */
-    IP_FLEXCAN0->RAMn[TX_MB_IDX*MSG_BUF_SIZE + 0] = (0xC << 24) | ((uint32_t)len << 16);
+    for (uint32_t mb = RX_MB_FIRST; pending != 0u; mb++)
+    {
+        if (!(pending & (1UL << mb))) continue;
+        pending &= ~(1UL << mb);
+
+        uint8_t next = (uint8_t)((rx_stash_head + 1u) & (RX_STASH_SIZE - 1u));
+        if (next == rx_stash_tail)
+        {
+            /* Stash full: leave the frame in its mailbox, interrupt off until a frame is read */
+            IP_FLEXCAN0->IMASK1 = 0u;
+            continue;
+        }
+
+        /* Same sequence as hal_can_receive_frame(): CS locks, TIMER unlocks */
+        can_raw_mb_t* r = &rx_stash[rx_stash_head];
+        r->cs = IP_FLEXCAN0->RAMn[mb*MSG_BUF_SIZE + 0];
+        r->id = IP_FLEXCAN0->RAMn[mb*MSG_BUF_SIZE + 1];
+        r->w0 = IP_FLEXCAN0->RAMn[mb*MSG_BUF_SIZE + 2];
+        r->w1 = IP_FLEXCAN0->RAMn[mb*MSG_BUF_SIZE + 3];
+        IP_FLEXCAN0->IFLAG1 = (1UL << mb);
+        uint16_t timer_now = can_timer_extend();
+        IP_FLEXCAN0->RAMn[mb*MSG_BUF_SIZE] = 0x04000000; // Code=4 (Active/Empty)
+
+        /* Time stamp extended now: the frame may wait in the stash longer than a TIMER period */
+        r->bit_time = can_stats.bit_time - (uint16_t)(timer_now - (uint16_t)(r->cs & 0xFFFFu));
+        rx_stash_head = next;
+    }
+}
 
-    return 0;
+/* MB interrupt: moves the received frames into the stash. In RAM like the
+ * stash itself, so it keeps running while the flash is being programmed. */
+HAL_RAMFUNC
+void CAN0_ORed_0_31_MB_IRQHandler(void)
+{
+    hal_can_rx_stash();
 }
 
-int hal_can_receive(uint32_t* id, uint8_t* data, uint8_t* len)
+int hal_can_receive_frame(hal_can_frame_t* frame)
 {
-    /* Check the flag interrupt (New Data) for the MB 1 */
-    if (IP_FLEXCAN0->IFLAG1 & (1 << RX_MB_IDX))
+    if (rx_stash_tail == rx_stash_head)
     {
-        uint32_t cs = IP_FLEXCAN0->RAMn[RX_MB_IDX*MSG_BUF_SIZE + 0];
+        /* Nothing queued: collect the mailboxes here (interrupts masked, or a stash left full) */
+        uint32_t primask = can_lock();
+        hal_can_rx_stash();
+        can_unlock(primask);
+        if (rx_stash_tail == rx_stash_head) return 0; // No message
+    }
 
-        /* Read DLC and ID */
-        *len = (cs >> 16) & 0x0F;
-        *id = (IP_FLEXCAN0->RAMn[RX_MB_IDX*MSG_BUF_SIZE + 1] >> 18) & 0x7FF;
+    /* Frames leave in arrival order, all through the stash */
+    const can_raw_mb_t* r = &rx_stash[rx_stash_tail];
+    uint32_t cs = r->cs;
+    uint32_t id = r->id;
+    uint32_t w0 = r->w0;
+    uint32_t w1 = r->w1;
+    uint32_t rx_bit_time = r->bit_time;
+    rx_stash_tail = (uint8_t)((rx_stash_tail + 1u) & (RX_STASH_SIZE - 1u));
+    IP_FLEXCAN0->IMASK1 = RX_MB_FLAGS;     /* Room again, if the stash had filled */
+
+    /* OVERRUN: at least one frame was overwritten by this one */
+    if (MB_CODE(cs) == MB_CODE_RX_OVERRUN) can_stats.rx_overruns++;
+
+    /* Read DLC and ID */
+    frame->len = (cs >> 16) & 0x0F;
+    if (frame->len > 8) frame->len = 8;
+    frame->id = (id >> 18) & 0x7FF;
+
+    frame->data[0] = (w0 >> 24) & 0xFF;
+    frame->data[1] = (w0 >> 16) & 0xFF;
+    frame->data[2] = (w0 >> 8)  & 0xFF;
+    frame->data[3] = (w0)       & 0xFF;
+    frame->data[4] = (w1 >> 24) & 0xFF;
+    frame->data[5] = (w1 >> 16) & 0xFF;
+    frame->data[6] = (w1 >> 8)  & 0xFF;
+    frame->data[7] = (w1)       & 0xFF;
+
+    frame->timestamp_us = rx_bit_time * CAN_US_PER_BIT;
+
+    can_stats.rx_frames++;
+    can_stats.rx_bits += hal_can_frame_bits(frame->len);
+    return 1; // Message received
+}
 
-        /* Read Data */
-        uint32_t w0 = IP_FLEXCAN0->RAMn[RX_MB_IDX*MSG_BUF_SIZE + 2];
-        uint32_t w1 = IP_FLEXCAN0->RAMn[RX_MB_IDX*MSG_BUF_SIZE + 3];
+int hal_can_receive(uint32_t* id, uint8_t* data, uint8_t* len)
+{
+    hal_can_frame_t frame;
 
-        data[0] = (w0 >> 24) & 0xFF;
-        data[1] = (w0 >> 16) & 0xFF;
-        data[2] = (w0 >> 8)  & 0xFF;
-        data[3] = (w0)       & 0xFF;
-        data[4] = (w1 >> 24) & 0xFF;
-        data[5] = (w1 >> 16) & 0xFF;
-        data[6] = (w1 >> 8)  & 0xFF;
-        data[7] = (w1)       & 0xFF;
+    if (hal_can_receive_frame(&frame) <= 0) return 0; // No message
 
-        /* Clean the flag and unlock mailbox by reading the timer */
-        IP_FLEXCAN0->IFLAG1 = (1 << RX_MB_IDX);
-        volatile uint32_t dummy = IP_FLEXCAN0->TIMER;
-        (void)dummy;
+    *id = frame.id;
+    *len = frame.len;
+    for (uint8_t i = 0; i < 8; i++) data[i] = frame.data[i];
 
-        IP_FLEXCAN0->RAMn[RX_MB_IDX*MSG_BUF_SIZE] = 0x04000000; // Code=4 (Active/Empty)
+    return 1; // Message received
+}
 
-        return 1; // Message received
+int hal_can_get_stats(hal_can_stats_t* stats)
+{
+    if (stats == NULL) return -1;
+
+    /* Error counters and fault confinement state */
+    uint32_t ecr = IP_FLEXCAN0->ECR;
+    can_stats.tx_err_count = (uint8_t)((ecr & FLEXCAN_ECR_TXERRCNT_MASK) >> FLEXCAN_ECR_TXERRCNT_SHIFT);
+    can_stats.rx_err_count = (uint8_t)((ecr & FLEXCAN_ECR_RXERRCNT_MASK) >> FLEXCAN_ECR_RXERRCNT_SHIFT);
+
+    /* Reading ESR1 clears the error flags: errors since the previous read count once per call */
+    uint32_t esr1 = IP_FLEXCAN0->ESR1;
+    uint32_t fltconf = (esr1 & FLEXCAN_ESR1_FLTCONF_MASK) >> FLEXCAN_ESR1_FLTCONF_SHIFT;
+    can_stats.err_state = (fltconf == 0u) ? HAL_CAN_ERR_ACTIVE
+                        : (fltconf == 1u) ? HAL_CAN_ERR_PASSIVE : HAL_CAN_BUS_OFF;
+
+    if (esr1 & ESR1_TX_ERRORS) can_stats.tx_retries++;
+    if (esr1 & ESR1_RX_ERRORS) can_stats.rx_errors++;
+    if (esr1 & FLEXCAN_ESR1_BOFFINT_MASK)
+    {
+        can_stats.bus_off_events++;
+        IP_FLEXCAN0->ESR1 = FLEXCAN_ESR1_BOFFINT_MASK;  /* W1C */
     }
 
-    return 0; // No message
+    /* Extend the 16-bit TIMER (one tick per bit time, wraps every 131 ms at 500 kbit/s) */
+    uint32_t primask = can_lock();
+    (void)can_timer_extend();
+    *stats = can_stats;
+    can_unlock(primask);
+    return 0;
+}
+
+uint32_t hal_can_get_time_us(void)
+{
+    uint32_t primask = can_lock();
+    (void)can_timer_extend();
+    uint32_t bit_time = can_stats.bit_time;
+    can_unlock(primask);
+    return bit_time * CAN_US_PER_BIT;
 }
 
 void hal_can_shutdown(void)
 {
+    /* Let queued frames (a last response before a reset) leave, bounded if the bus is stuck */
+    uint32_t t0 = hal_can_get_time_us();
+    while (hal_can_tx_free() < TX_MB_COUNT && (hal_can_get_time_us() - t0) < CAN_SHUTDOWN_DRAIN_US) {}
+
+    /* No RX interrupt from here on (the bootloader jumps to the application next) */
+    NVIC_ICER = 1uL << CAN0_ORed_0_31_MB_IRQn;
+    IP_FLEXCAN0->IMASK1 = 0u;
+
 	/* Enter MDIS (module disabled) */
     IP_FLEXCAN0->MCR |= FLEXCAN_MCR_MDIS_MASK;
 
@@ -0,0 +1,11 @@
+/**
+ * @file hal_can_port.h
+ * @brief S32K118 settings of the CAN HAL, included by hal_can.h.
+ */
+
+#ifndef HAL_CAN_PORT_H
+#define HAL_CAN_PORT_H
+
+#define HAL_CAN_DEFAULT_IF   "can0" /**< Channel opened by default: FlexCAN0 (the name is not used by the driver). */
+
+#endif /* HAL_CAN_PORT_H */
@@ -6,6 +6,12 @@
  */
 
 void SOSC_init_20MHz(void)
+{
+    SOSC_start_20MHz();
+    while (!SOSC_isValid());
+}
+
+void SOSC_start_20MHz(void)
 {
 	/*! SOSC Initialization (20 MHz External Crystal):
 	 * ===============================================
@@ -30,8 +36,12 @@ void SOSC_init_20MHz(void)
     IP_SCG->SOSCCSR = SCG_SOSCCSR_SOSCEN_MASK; 		/* Enable oscillator */
                                                     /* Altri bit a 0 per default (Monitor disabled, etc.) */
 
-    /* 6. Wait for SOSC valid */
-    while(!(IP_SCG->SOSCCSR & SCG_SOSCCSR_SOSCVLD_MASK));
+    /* 6. SOSC valid after the crystal start-up (a few ms): SOSC_isValid() */
+}
+
+bool SOSC_isValid(void)
+{
+    return (IP_SCG->SOSCCSR & SCG_SOSCCSR_SOSCVLD_MASK) != 0u;
 }
 
 void RUN_mode_48MHz(void)
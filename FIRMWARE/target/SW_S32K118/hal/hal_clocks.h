@@ -2,7 +2,11 @@
 #ifndef HAL_CLOCKS_H
 #define HAL_CLOCKS_H
 
+#include <stdbool.h>
+
 void SOSC_init_20MHz (void);
+void SOSC_start_20MHz (void);   /* SOSC_init_20MHz without the wait: poll SOSC_isValid() */
+bool SOSC_isValid (void);
 void RUN_mode_48MHz (void);
 
 #endif /* HAL_CLOCKS_H */
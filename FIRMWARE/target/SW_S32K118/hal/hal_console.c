@@ -0,0 +1,43 @@
+/**
+ * @file hal_console.c
+ * @brief HAL implementation of the command console transport on S32K118 (LPUART0 rings).
+ */
+
+#include "hal_console.h"
+#include "hal_uart.h"
+
+/*======================================================================
+ *  PUBLIC API
+ *====================================================================*/
+
+uint32_t hal_console_read(char *buf, uint32_t size)
+{
+    uint32_t n = 0;
+
+    while (n < size && HAL_UART_GetChar(&buf[n]))
+    {
+        n++;
+    }
+    return n;
+}
+
+void hal_console_write(const char *s, uint32_t len)
+{
+    HAL_UART_Write(s, len);
+}
+
+void hal_console_set_blocking(bool blocking)
+{
+    HAL_UART_SetBlocking(blocking);
+}
+
+void hal_console_flush(void)
+{
+    HAL_UART_Flush();
+}
+
+void hal_console_get_stats(uint32_t *tx_dropped, uint32_t *rx_lost)
+{
+    *tx_dropped = HAL_UART_GetDropped();
+    *rx_lost    = HAL_UART_GetRxLost();
+}
@@ -0,0 +1,109 @@
+/**
+ * @file hal_flash.c
+ * @brief HAL implementation for the P-Flash (FTFC) on S32K118.
+ */
+
+#include "hal_flash.h"
+#include "hal_can.h"
+#include "device_registers.h"
+#include "hal_ramfunc.h"
+#include <stddef.h>
+
+#define FTFC_CMD_PROGRAM_PHRASE  0x07u
+#define FTFC_CMD_ERASE_SECTOR    0x09u
+
+/* FCCOB registers are grouped by four in big-endian order: FCCOB[3] holds FCCOB0 */
+#define FCCOB_CMD      3    /* FCCOB0: command */
+#define FCCOB_ADDR_23  2    /* FCCOB1: address bits 23..16 */
+#define FCCOB_ADDR_15  1    /* FCCOB2: address bits 15..8 */
+#define FCCOB_ADDR_7   0    /* FCCOB3: address bits 7..0 */
+#define FCCOB_DATA     4    /* FCCOB4..B: phrase bytes, stored in memory order from here */
+
+#define FSTAT_ERRORS   (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK | FTFC_FSTAT_MGSTAT0_MASK)
+
+/*======================================================================
+ *  INTERNAL UTILITIES
+ *====================================================================*/
+
+/**
+ * @brief Launches the command loaded in FCCOB and waits for it to complete.
+ *
+ * Runs from RAM: the P-Flash cannot be read while it executes the command,
+ * so interrupts (handlers in flash) are masked and only RAM code runs,
+ * moving CAN frames out of their mailboxes meanwhile.
+ *
+ * @return FSTAT after completion.
+ */
+HAL_RAMFUNC
+static uint8_t flash_run(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+    DISABLE_INTERRUPTS();
+
+    IP_FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;          /* Launch (W1C) */
+    while (!(IP_FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK))
+    {
+        hal_can_rx_stash();
+    }
+
+    if (primask == 0u) ENABLE_INTERRUPTS();
+    return IP_FTFC->FSTAT;
+}
+
+/**
+ * @brief Loads the command and address, clearing the errors of the previous command.
+ */
+static void flash_load(uint8_t cmd, uint32_t addr)
+{
+    while (!(IP_FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK)) {}
+    IP_FTFC->FSTAT = FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK;
+
+    IP_FTFC->FCCOB[FCCOB_CMD]     = cmd;
+    IP_FTFC->FCCOB[FCCOB_ADDR_23] = (uint8_t)(addr >> 16);
+    IP_FTFC->FCCOB[FCCOB_ADDR_15] = (uint8_t)(addr >> 8);
+    IP_FTFC->FCCOB[FCCOB_ADDR_7]  = (uint8_t)addr;
+}
+
+/*======================================================================
+ *  PUBLIC API
+ *====================================================================*/
+
+int hal_flash_init(void)
+{
+    while (!(IP_FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK)) {}
+    IP_FTFC->FSTAT = FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK;
+    return 0;
+}
+
+int hal_flash_erase_sector(uint32_t addr)
+{
+    if ((addr % HAL_FLASH_SECTOR_SIZE) != 0u || addr >= HAL_FLASH_SIZE) return -1;
+
+    flash_load(FTFC_CMD_ERASE_SECTOR, addr);
+    return (flash_run() & FSTAT_ERRORS) ? -2 : 0;
+}
+
+int hal_flash_program(uint32_t addr, const uint8_t *data, uint32_t len)
+{
+    if ((addr % HAL_FLASH_PHRASE_SIZE) != 0u || (len % HAL_FLASH_PHRASE_SIZE) != 0u) return -1;
+    if (addr >= HAL_FLASH_SIZE || len > HAL_FLASH_SIZE - addr) return -1;
+
+    for (uint32_t done = 0; done < len; done += HAL_FLASH_PHRASE_SIZE)
+    {
+        flash_load(FTFC_CMD_PROGRAM_PHRASE, addr + done);
+        for (uint32_t i = 0; i < HAL_FLASH_PHRASE_SIZE; i++)
+        {
+            IP_FTFC->FCCOB[FCCOB_DATA + i] = data[done + i];
+        }
+        if (flash_run() & FSTAT_ERRORS) return -2;
+    }
+    return 0;
+}
+
+const uint8_t *hal_flash_ptr(uint32_t addr)
+{
+    if (addr >= HAL_FLASH_SIZE) return NULL;
+    return (const uint8_t *)(uintptr_t)addr;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file hal_gpio_port.h
+ * @brief S32K118 board pins and GPIO accessors, included by hal_gpio.h.
+ *
+ * @details
+ * The accessors are ::HAL_INLINE: they run from the section of the caller
+ * (a RAM function stays in RAM) and a constant pin folds the switch away.
+ */
+
+#ifndef HAL_GPIO_PORT_H
+#define HAL_GPIO_PORT_H
+
+#include "device_registers.h"   /* Peripheral declarations for S32K118 */
+#include "hal_ramfunc.h"        /* HAL_INLINE */
+
+/* ============================================================================
+ *                           BOARD PIN DEFINITIONS
+ * ========================================================================== */
+
+#define TFT_CS_PIN   0	//PTB0
+#define TFT_DC_PIN   8	//PTC8
+#define TFT_RST_PIN  9	//PTC9
+
+#define LED_Y_PIN	1	//PTA1
+#define LED_R_PIN	5	//PTB5
+
+/*
+ * Buttons are wired to GND and use the MCU's internal pull-up resistors:
+ * released -> pin = 1, pressed -> pin = 0. HAL_GPIO_Read() inverts the
+ * input, so the drivers see 1 = pressed as on the host.
+ */
+#define BTN1_PORT  IP_PORTC     /* UP */
+#define BTN1_GPIO  IP_PTC
+#define BTN1_PIN   16
+
+#define BTN2_PORT  IP_PORTB     /* DOWN */
+#define BTN2_GPIO  IP_PTB
+#define BTN2_PIN   3
+
+#define BTN3_PORT  IP_PORTC     /* DRS */
+#define BTN3_GPIO  IP_PTC
+#define BTN3_PIN   1
+
+#define BTN4_PORT  IP_PORTB     /* PIT LIMITER */
+#define BTN4_GPIO  IP_PTB
+#define BTN4_PIN   4
+
+/*--------------------------PIN ACCESSORS-----------------------------------*/
+
+HAL_INLINE void HAL_GPIO_Write(GPIO_Pin_t pin, uint8_t value)
+{
+    switch (pin) {
+        case GPIO_TFT_CS:  if (value) IP_PTB->PSOR = (1u << TFT_CS_PIN);  else IP_PTB->PCOR = (1u << TFT_CS_PIN);  break;
+        case GPIO_TFT_DC:  if (value) IP_PTC->PSOR = (1u << TFT_DC_PIN);  else IP_PTC->PCOR = (1u << TFT_DC_PIN);  break;
+        case GPIO_TFT_RST: if (value) IP_PTC->PSOR = (1u << TFT_RST_PIN); else IP_PTC->PCOR = (1u << TFT_RST_PIN); break;
+        case GPIO_LED_S1:  if (value) IP_PTA->PSOR = (1u << LED_Y_PIN);   else IP_PTA->PCOR = (1u << LED_Y_PIN);   break;
+        case GPIO_LED_S2:  if (value) IP_PTB->PSOR = (1u << LED_R_PIN);   else IP_PTB->PCOR = (1u << LED_R_PIN);   break;
+        default: break;
+    }
+}
+
+HAL_INLINE void HAL_GPIO_Toggle(GPIO_Pin_t pin)
+{
+    switch (pin) {
+        case GPIO_LED_S1: IP_PTA->PTOR = (1u << LED_Y_PIN); break;
+        case GPIO_LED_S2: IP_PTB->PTOR = (1u << LED_R_PIN); break;
+        default: break;
+    }
+}
+
+HAL_INLINE uint8_t HAL_GPIO_Read(GPIO_Pin_t pin)
+{
+    switch (pin) {
+        case GPIO_BTN_1: return (uint8_t)(((BTN1_GPIO->PDIR >> BTN1_PIN) & 1u) ^ 1u);
+        case GPIO_BTN_2: return (uint8_t)(((BTN2_GPIO->PDIR >> BTN2_PIN) & 1u) ^ 1u);
+        case GPIO_BTN_3: return (uint8_t)(((BTN3_GPIO->PDIR >> BTN3_PIN) & 1u) ^ 1u);
+        case GPIO_BTN_4: return (uint8_t)(((BTN4_GPIO->PDIR >> BTN4_PIN) & 1u) ^ 1u);
+        default: return 0;
+    }
+}
+
+#endif /* HAL_GPIO_PORT_H */
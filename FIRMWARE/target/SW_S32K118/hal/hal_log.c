@@ -0,0 +1,41 @@
+/**
+ * @file hal_log.c
+ * @brief HAL implementation of the tokenized log on S32K118 (records into the UART TX ring).
+ */
+
+#include "hal_log.h"
+#include "hal_uart.h"
+
+/*======================================================================
+ *  PUBLIC API
+ *====================================================================*/
+
+void hal_log_write(const char *fmt, uint32_t n, const hal_log_arg_t *args)
+{
+    uint8_t rec[4u + 4u * HAL_LOG_MAX_ARGS];
+    uint16_t id = (uint16_t)(uintptr_t)fmt;     /* Offset in .log_str (section at address 0) */
+
+    if (n > HAL_LOG_MAX_ARGS) n = HAL_LOG_MAX_ARGS;
+
+    rec[0] = HAL_LOG_MARKER;
+    rec[1] = (uint8_t)n;
+    rec[2] = (uint8_t)id;
+    rec[3] = (uint8_t)(id >> 8);
+
+    uint8_t *p = &rec[4];
+    for (uint32_t i = 0; i < n; i++)
+    {
+        uint32_t v = (uint32_t)args[i];
+        *p++ = (uint8_t)v;
+        *p++ = (uint8_t)(v >> 8);
+        *p++ = (uint8_t)(v >> 16);
+        *p++ = (uint8_t)(v >> 24);
+    }
+
+    HAL_UART_Write(rec, (uint32_t)(p - rec));
+}
+
+void hal_log_frame(const uint8_t *frame, uint32_t len)
+{
+    HAL_UART_Write(frame, len);
+}
@@ -2,6 +2,8 @@
 #include "hal_gpio.h"
 #include "device_registers.h"
 #include "hal_uart.h"
+#include "hal_log.h"
+#include "hal_ramfunc.h"
 
 #define LPSPI_PCC_INDEX   PCC_LPSPI0_INDEX
 #define SCK_PIN   2   /* PTB2 */
@@ -42,7 +44,7 @@ void HAL_SPI_Init(void) {
 
     IP_LPSPI0 -> FCR &= ~LPSPI_FCR_RXWATER_MASK;  				/* RXWATER = 0 The Receive Data Flag is set whenever the number of words in the receive FIFO is greater than 0 */
     IP_LPSPI0 -> FCR &= ~LPSPI_FCR_TXWATER_MASK;  				/* TXWATER = 0 The Transmit Data Flag is set whenever the number of words in the transmit FIFO is equal or less than 0 */
-    HAL_UART_Printf("[SPI] Init Done. CFGR1=0x%X CR=0x%X\r\n", IP_LPSPI0->CFGR1, IP_LPSPI0->CR);
+    HAL_LOG("[SPI] Init Done. CFGR1=0x%X CR=0x%X\r\n", IP_LPSPI0->CFGR1, IP_LPSPI0->CR);
 }
 
 void HAL_SPI_WriteCommand(uint8_t cmd) {
@@ -51,26 +53,11 @@ void HAL_SPI_WriteCommand(uint8_t cmd) {
     HAL_SPI_TransmitByte(cmd);
 }
 
+/* Pixel stream: runs from RAM, HAL_SPI_TransmitByte is inlined (hal_spi_port.h) */
+HAL_RAMFUNC
 void HAL_SPI_WriteData(const uint8_t *data, size_t length) {
     HAL_GPIO_Write(GPIO_TFT_DC, 1); /* Aggiunto per sicurezza */
     for (size_t i = 0; i < length; i++) {
         HAL_SPI_TransmitByte(data[i]);
     }
 }
-
-void HAL_SPI_TransmitByte(uint8_t byte)
-{
-
-	/* Wait for Tx FIFO available */
-	while((IP_LPSPI0 -> SR & LPSPI_SR_TDF_MASK) >> LPSPI_SR_TDF_SHIFT == 0);
-
-	IP_LPSPI0 -> TDR = byte;              					/* Transmit data */
-	IP_LPSPI0 -> SR |= LPSPI_SR_TDF_MASK; 					/* Clear TDF flag */
-
-	/* Wait at least one RxFIFO entry */
-	//while((IP_LPSPI0 -> SR & LPSPI_SR_RDF_MASK) >> LPSPI_SR_RDF_SHIFT == 0);
-
-	//receive = IP_LPSPI0 -> RDR;            				/* Read received data */
-	//IP_LPSPI0 -> SR |= LPSPI_SR_RDF_MASK; 					/* Clear RDF flag */
-
-}
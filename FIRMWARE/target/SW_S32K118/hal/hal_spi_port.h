@@ -0,0 +1,35 @@
+/**
+ * @file hal_spi_port.h
+ * @brief S32K118 LPSPI0 byte accessors, included by hal_spi.h.
+ *
+ * @details
+ * ::HAL_INLINE, so the RAM-resident display byte loops (TFT_LCD_transmit_8bits,
+ * HAL_SPI_WriteData) never call into flash.
+ */
+
+#ifndef HAL_SPI_PORT_H
+#define HAL_SPI_PORT_H
+
+#include "device_registers.h"   /* Peripheral declarations for S32K118 */
+#include "hal_ramfunc.h"        /* HAL_INLINE */
+
+HAL_INLINE void HAL_SPI_TransmitByte(uint8_t byte)
+{
+    while ((IP_LPSPI0->SR & LPSPI_SR_TDF_MASK) == 0u) {
+        /* Wait for Tx FIFO available */
+    }
+    IP_LPSPI0->TDR = byte;                  /* Transmit data */
+    IP_LPSPI0->SR  = LPSPI_SR_TDF_MASK;     /* Clear TDF flag (w1c) */
+}
+
+HAL_INLINE void HAL_SPI_WaitTxDone(void)
+{
+    while ((IP_LPSPI0->FSR & LPSPI_FSR_TXCOUNT_MASK) != 0u) {
+        /* Wait for the FIFO to drain into the shifter */
+    }
+    while ((IP_LPSPI0->SR & LPSPI_SR_MBF_MASK) != 0u) {
+        /* Wait for the last frame */
+    }
+}
+
+#endif /* HAL_SPI_PORT_H */
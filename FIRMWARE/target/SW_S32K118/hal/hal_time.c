@@ -0,0 +1,44 @@
+/**
+ * @file hal_time.c
+ * @brief HAL implementation of the boot microsecond clock on S32K118 (LPIT, chained channels).
+ */
+
+#include "hal_time.h"
+#include "device_registers.h"
+#include "hal_ramfunc.h"
+
+#define LPIT_CLOCK_HZ   48000000u   /* FIRCDIV2: FIRC (48 MHz from reset) divided by 1 */
+#define LPIT_US_MAX     0xFFFFFFFFu /* Channel 1 reload: counts down once per µs */
+
+/*======================================================================
+ *  PUBLIC API
+ *====================================================================*/
+
+void hal_time_init(void)
+{
+    /* FIRCDIV2 is off out of reset; RUN_mode_48MHz() sets the same divider later */
+    IP_SCG->FIRCDIV = (IP_SCG->FIRCDIV & ~SCG_FIRCDIV_FIRCDIV2_MASK) | SCG_FIRCDIV_FIRCDIV2(1);
+
+    IP_PCC->PCCn[PCC_LPIT_INDEX] &= ~PCC_PCCn_CGC_MASK;
+    IP_PCC->PCCn[PCC_LPIT_INDEX] = PCC_PCCn_PCS(3);                    /* FIRCDIV2_CLK */
+    IP_PCC->PCCn[PCC_LPIT_INDEX] |= PCC_PCCn_CGC_MASK;
+
+    /* Module on (also after a jump from the bootloader), keeps counting when halted by the debugger */
+    IP_LPIT0->MCR = LPIT_MCR_M_CEN_MASK | LPIT_MCR_DBG_EN_MASK;
+    IP_LPIT0->TMR[0].TCTRL = 0u;
+    IP_LPIT0->TMR[1].TCTRL = 0u;
+
+    /* Channel 0 expires every µs; channel 1, chained, counts its expiries down */
+    IP_LPIT0->TMR[0].TVAL = (LPIT_CLOCK_HZ / 1000000u) - 1u;
+    IP_LPIT0->TMR[1].TVAL = LPIT_US_MAX;
+    IP_LPIT0->TMR[0].TCTRL = LPIT_TMR_TCTRL_MODE(0);                  /* 32-bit periodic, no interrupt */
+    IP_LPIT0->TMR[1].TCTRL = LPIT_TMR_TCTRL_MODE(0) | LPIT_TMR_TCTRL_CHAIN_MASK;
+    IP_LPIT0->SETTEN = LPIT_SETTEN_SET_T_EN_1_MASK | LPIT_SETTEN_SET_T_EN_0_MASK;
+}
+
+/* In RAM: the CAN timebase reads it from the RX interrupt while the flash is busy */
+HAL_RAMFUNC
+uint32_t hal_time_us(void)
+{
+    return LPIT_US_MAX - IP_LPIT0->TMR[1].CVAL;
+}
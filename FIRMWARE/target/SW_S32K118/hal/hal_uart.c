@@ -4,6 +4,7 @@
  */
 
 #include "hal_uart.h"
+#include "hal_log.h"
 #include "device_registers.h"
 #include <stdio.h>
 #include <stdarg.h>
@@ -18,6 +19,34 @@
 #define UART_TX_PIN     3   /* PTA3 */
 #define UART_RX_PIN     2   /* PTA2 */
 
+/* TX ring: one full debug UI page (~1.5 KB) fits between two 500 ms updates */
+#define UART_TX_RING_SIZE   2048u
+#define UART_TX_WATERMARK   1u      /* TDRE (interrupt) when at most 1 word is left in the 4-word FIFO */
+
+/* RX ring: one console line (polled once per 16 ms slot, ~185 characters per slot at 115200) */
+#define UART_RX_RING_SIZE   256u
+
+/* STAT bits that are configuration, not write-1-to-clear flags */
+#define UART_STAT_CFG_MASK  (LPUART_STAT_MSBF_MASK | LPUART_STAT_RXINV_MASK | LPUART_STAT_RWUID_MASK | \
+                             LPUART_STAT_BRK13_MASK | LPUART_STAT_LBKDE_MASK)
+
+/* Cortex-M0+ NVIC (not described by the device header) */
+#define NVIC_ISER           (*(volatile uint32_t *)0xE000E100u)
+#define NVIC_ICPR           (*(volatile uint32_t *)0xE000E280u)
+
+#define UART_TX_FIFO_COUNT()  ((IP_LPUART0->WATER & LPUART_WATER_TXCOUNT_MASK) >> LPUART_WATER_TXCOUNT_SHIFT)
+
+static char tx_ring[UART_TX_RING_SIZE];
+static volatile uint32_t tx_head = 0;   /* Written by the producer (main loop) */
+static volatile uint32_t tx_tail = 0;   /* Written by the TX interrupt */
+static volatile uint32_t tx_dropped = 0;
+static bool tx_blocking = true;         /* Wait for room instead of dropping (start-up, bootloader) */
+
+static char rx_ring[UART_RX_RING_SIZE];
+static volatile uint32_t rx_head = 0;   /* Written by the RX interrupt */
+static volatile uint32_t rx_tail = 0;   /* Written by the consumer (main loop) */
+static volatile uint32_t rx_lost = 0;   /* Ring full or receiver overrun */
+
 
 /**
  * @brief Configure pin muxing for UART TX/RX.
@@ -36,6 +65,80 @@ static void UART_ConfigPins(void)
     UART_PORT->PCR[UART_RX_PIN] |= PORT_PCR_MUX(6);
 }
 
+/**
+ * @brief Moves characters from the ring into the TX FIFO while it has room.
+ *
+ * Stops the TX interrupt once the ring is empty. Called by the interrupt, or
+ * with interrupts masked.
+ */
+static void UART_TxPump(void)
+{
+    uint32_t tail = tx_tail;
+
+    while (tail != tx_head && UART_TX_FIFO_COUNT() < FEATURE_LPUART_FIFO_SIZE)
+    {
+        IP_LPUART0->DATA = (uint8_t)tx_ring[tail];
+        tail = (tail + 1u) % UART_TX_RING_SIZE;
+    }
+    tx_tail = tail;
+
+    if (tail == tx_head)
+    {
+        IP_LPUART0->CTRL &= ~LPUART_CTRL_TIE_MASK;
+    }
+}
+
+/**
+ * @brief Runs one pump step from thread mode (interrupts masked meanwhile).
+ */
+static void UART_TxPumpLocked(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+    DISABLE_INTERRUPTS();
+    UART_TxPump();
+    if (primask == 0u) ENABLE_INTERRUPTS();
+}
+
+/**
+ * @brief Copies a message into the ring and starts the TX interrupt.
+ *
+ * A message that does not fit is dropped whole (non-blocking mode), so the
+ * log never shows half lines.
+ */
+static void UART_Enqueue(const char *s, uint32_t len)
+{
+    if (len >= UART_TX_RING_SIZE)
+    {
+        tx_dropped += len;
+        return;
+    }
+
+    uint32_t head = tx_head;
+    for (;;)
+    {
+        uint32_t used = (head + UART_TX_RING_SIZE - tx_tail) % UART_TX_RING_SIZE;
+        if (len < UART_TX_RING_SIZE - used) break;          /* One slot stays empty */
+
+        if (!tx_blocking)
+        {
+            tx_dropped += len;
+            return;
+        }
+        UART_TxPumpLocked();                                /* Also progresses with interrupts masked */
+    }
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        tx_ring[head] = s[i];
+        head = (head + 1u) % UART_TX_RING_SIZE;
+    }
+    tx_head = head;
+
+    IP_LPUART0->CTRL |= LPUART_CTRL_TIE_MASK;
+}
+
 
 /**
  * @brief Initializes LPUART0 peripheral.
@@ -53,8 +156,7 @@ void HAL_UART_Init(uint32_t baudrate)
                                 	|  PCC_PCCn_CGC_MASK;     	/* Enable clock for LPUART1 regs */
 
     /* Disable LPUART during configuration */
-    IP_LPUART0->CTRL &= ~LPUART_CTRL_TE_MASK;
-    IP_LPUART0->CTRL &= ~LPUART_CTRL_RE_MASK;
+    IP_LPUART0->CTRL &= ~(LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK | LPUART_CTRL_TIE_MASK);
 
     /* LPUART clock = 48 MHz (FIRCDIV clock) */
     uint32_t uart_clk = 48000000u;
@@ -65,10 +167,19 @@ void HAL_UART_Init(uint32_t baudrate)
     IP_LPUART0->BAUD &= ~LPUART_BAUD_SBR_MASK;
     IP_LPUART0->BAUD |= LPUART_BAUD_SBR(baud_div);
 
-    /* Enable TX and RX */
-    IP_LPUART0->CTRL |= LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK;
+    /* TX FIFO (4 words, enabled while TE=0): one interrupt per ~3 characters */
+    IP_LPUART0->FIFO |= LPUART_FIFO_TXFE_MASK;
+    IP_LPUART0->WATER = LPUART_WATER_TXWATER(UART_TX_WATERMARK);
+
+    tx_head = tx_tail = 0;
+    rx_head = rx_tail = 0;
+    NVIC_ICPR = 1uL << LPUART0_RxTx_IRQn;
+    NVIC_ISER = 1uL << LPUART0_RxTx_IRQn;
 
-    HAL_UART_Printf("[UART] Init @%lu baud: PCC=0x%08lX BAUD=0x%08lX CTRL=0x%08lX\r\n",
+    /* Enable TX and RX, RX interrupt (console input) */
+    IP_LPUART0->CTRL |= LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK | LPUART_CTRL_RIE_MASK;
+
+    HAL_LOG("[UART] Init @%lu baud: PCC=0x%08lX BAUD=0x%08lX CTRL=0x%08lX\r\n",
                         baudrate,
                         (uint32_t)IP_PCC->PCCn[PCC_LPUART0_INDEX],
                         (uint32_t)IP_LPUART0->BAUD,
@@ -76,26 +187,68 @@ void HAL_UART_Init(uint32_t baudrate)
 }
 
 /**
- * @brief Sends a single character over UART.
+ * @brief LPUART0 interrupt: stores received characters, refills the TX FIFO from the ring.
  */
-void HAL_UART_SendChar(char c)
+void LPUART0_RxTx_IRQHandler(void)
 {
-    /* Wait for TX buffer empty */
-    while(!(IP_LPUART0->STAT & LPUART_STAT_TDRE_MASK));
+    uint32_t stat = IP_LPUART0->STAT;
 
-    IP_LPUART0->DATA = (uint8_t)c;
+    if (stat & LPUART_STAT_OR_MASK)
+    {
+        /* A character arrived while DATA was full: count it, clear the flag (w1c) */
+        IP_LPUART0->STAT = (stat & UART_STAT_CFG_MASK) | LPUART_STAT_OR_MASK;
+        rx_lost++;
+    }
+    if (stat & LPUART_STAT_RDRF_MASK)
+    {
+        char c = (char)IP_LPUART0->DATA;
+        uint32_t next = (rx_head + 1u) % UART_RX_RING_SIZE;
+        if (next != rx_tail)
+        {
+            rx_ring[rx_head] = c;
+            rx_head = next;
+        }
+        else
+        {
+            rx_lost++;
+        }
+    }
+
+    if (IP_LPUART0->CTRL & LPUART_CTRL_TIE_MASK)
+    {
+        UART_TxPump();
+    }
+}
+
+/**
+ * @brief Queues a single character.
+ */
+void HAL_UART_SendChar(char c)
+{
+    UART_Enqueue(&c, 1u);
 }
 
 
 /**
- * @brief Sends a string over UART.
+ * @brief Queues a string.
  */
 void HAL_UART_SendString(const char *s)
 {
-    while (*s)
+    uint32_t len = 0;
+
+    while (s[len] != '\0')
     {
-        HAL_UART_SendChar(*s++);
+        len++;
     }
+    UART_Enqueue(s, len);
+}
+
+/**
+ * @brief Queues raw bytes (binary log records).
+ */
+void HAL_UART_Write(const void *data, uint32_t len)
+{
+    UART_Enqueue((const char *)data, len);
 }
 
 /**
@@ -110,6 +263,43 @@ int HAL_UART_Printf(const char *fmt, ...)
     int len = vsnprintf(buffer, sizeof(buffer), fmt, args);
     va_end(args);
 
-    HAL_UART_SendString(buffer);
+    if (len > 0)
+    {
+        UART_Enqueue(buffer, ((uint32_t)len < sizeof(buffer)) ? (uint32_t)len : sizeof(buffer) - 1u);
+    }
     return len;
 }
+
+void HAL_UART_SetBlocking(bool blocking)
+{
+    tx_blocking = blocking;
+}
+
+void HAL_UART_Flush(void)
+{
+    while (tx_tail != tx_head)
+    {
+        UART_TxPumpLocked();
+    }
+    while (!(IP_LPUART0->STAT & LPUART_STAT_TC_MASK)) {}
+}
+
+uint32_t HAL_UART_GetDropped(void)
+{
+    return tx_dropped;
+}
+
+bool HAL_UART_GetChar(char *c)
+{
+    uint32_t tail = rx_tail;
+
+    if (tail == rx_head) return false;
+    *c = rx_ring[tail];
+    rx_tail = (tail + 1u) % UART_RX_RING_SIZE;
+    return true;
+}
+
+uint32_t HAL_UART_GetRxLost(void)
+{
+    return rx_lost;
+}
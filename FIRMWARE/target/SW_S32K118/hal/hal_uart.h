@@ -1,12 +1,23 @@
 /**
  * @file hal_uart.h
  * @brief HAL interface for UART (LPUART0) on NXP S32K118.
+ *
+ * Output goes through a 2 KB TX ring drained by the LPUART0 TX interrupt
+ * (4-word FIFO), so printing only costs the formatting. After Init the
+ * functions wait for room when the ring is full, which keeps the start-up
+ * log complete. The application switches to non-blocking mode before its
+ * control loop: a message that does not fit is then dropped whole and
+ * counted. The functions are meant for thread mode only (one producer).
+ *
+ * Input is stored by the same interrupt in a 256-byte RX ring and read with
+ * HAL_UART_GetChar (the command console, drivers/console.h).
  */
 
 #ifndef HAL_UART_H_
 #define HAL_UART_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <stdarg.h>
 
 
@@ -18,19 +29,27 @@
 void HAL_UART_Init(uint32_t baudrate);
 
 /**
- * @brief Sends a single character over UART.
+ * @brief Queues a single character for transmission.
  *
  * @param c Character to send.
  */
 void HAL_UART_SendChar(char c);
 
 /**
- * @brief Sends a null-terminated string over UART.
+ * @brief Queues a null-terminated string for transmission.
  *
  * @param s Pointer to string.
  */
 void HAL_UART_SendString(const char *s);
 
+/**
+ * @brief Queues raw bytes for transmission (binary records of hal_log).
+ *
+ * @param data Bytes.
+ * @param len  Byte count.
+ */
+void HAL_UART_Write(const void *data, uint32_t len);
+
 /**
  * @brief printf-style printing through UART.
  *
@@ -39,4 +58,41 @@ void HAL_UART_SendString(const char *s);
  */
 int HAL_UART_Printf(const char *fmt, ...);
 
+/**
+ * @brief Selects what happens when the TX ring is full.
+ *
+ * @param blocking true: wait for room (default after Init).
+ *                 false: drop the message and count it (control loop).
+ */
+void HAL_UART_SetBlocking(bool blocking);
+
+/**
+ * @brief Waits until every queued character has left the transmitter.
+ *
+ * Works with interrupts masked. Use before a reset.
+ */
+void HAL_UART_Flush(void);
+
+/**
+ * @brief Returns the number of characters dropped in non-blocking mode.
+ *
+ * @return Total since start-up.
+ */
+uint32_t HAL_UART_GetDropped(void);
+
+/**
+ * @brief Takes one received character, without waiting.
+ *
+ * @param c Destination of the character.
+ * @return true if a character was available.
+ */
+bool HAL_UART_GetChar(char *c);
+
+/**
+ * @brief Returns the number of received characters lost (RX ring full, overrun).
+ *
+ * @return Total since start-up.
+ */
+uint32_t HAL_UART_GetRxLost(void);
+
 #endif /* HAL_UART_H_ */
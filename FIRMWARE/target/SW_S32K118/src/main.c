@@ -14,6 +14,7 @@
 #include "../hal/hal_wdog.h"
 #include "../hal/hal_clocks.h"
 #include "../hal/hal_uart.h"
+#include "../hal/hal_time.h"
 #include <stdio.h>   /* Optional: for debug prints, may be redirected to UART or semihosting */
 
 extern uint32_t SystemCoreClock;  // defined in system_S32K118.c (normally 48MHz)
@@ -28,7 +29,8 @@ int main(void)
 	 * It is necessary to reactive for the final Firmware
 	 */
 	HAL_WDOG_Disable();
-	SOSC_init_20MHz();
+	hal_time_init();       // Boot timestamps count from here
+	/* SOSC is started by the boot sequencer in app_main(), overlapped with the GPIO/input init */
 	RUN_mode_48MHz();
 	SystemCoreClockUpdate(); // (Optional) evaluates the clock register settings and calculates the current core clock.
 	HAL_UART_Init(115200); // Inizialization of the uart